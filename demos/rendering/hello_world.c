@@ -441,6 +441,8 @@ More explicit license information at the end of file.
 	void layout_characters(void) {
 		// Initial X and Y; to be set
 		float x = 0.f, y;
+		// Previous character; for kerning
+		uint32_m prev_c = 0xFFFFFFFF;
 		printf("Setting positions of each graphical character...\n");
 
 		// Loop through each char in text
@@ -456,6 +458,12 @@ More explicit license information at the end of file.
 				}
 			}
 
+			// Apply kerning between the previous character and this one
+			if (prev_c != 0xFFFFFFFF) {
+				x += mutt_funits_to_punits(&font, mutt_get_kerning(&font, chars[prev_c].glyph_id, chars[c].glyph_id), point_size, PPI);
+			}
+			prev_c = c;
+
 			// Set the mid-point ascender/descender values
 			// Doesn't really matter what glyph, so just do
 			// the first one
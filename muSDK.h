@@ -2064,6 +2064,8 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 			// @DOCLINE # mug context
 
+				typedef struct mugAllocator mugAllocator;
+
 				// @DOCLINE mug operates in a context, encapsulated by the type `mugContext`, which has the following members:
 
 				struct mugContext {
@@ -2071,9 +2073,28 @@ All mu libraries included in muSDK have name functions to convert some of their
 					mugResult result;
 					// @DOCLINE * `@NLFT cosa` - the muCOSA context used by the mug context.
 					muCOSAContext cosa;
+					// @DOCLINE * `@NLFT* allocator` - the [allocator](#allocator) used for memory allocated by mug; starting value upon context creation is 0, meaning that `mu_malloc` and `mu_free` are used.
+					mugAllocator* allocator;
 				};
 				typedef struct mugContext mugContext;
 
+				// @DOCLINE ## Allocator
+
+					// @DOCLINE The allocator of a context can be set by the user at any time after its creation, and is represented by the struct `mugAllocator`, which has the following members:
+
+					struct mugAllocator {
+						// @DOCLINE * `@NLFT* allocate` - a function that allocates `size` bytes, returning 0 upon failure; equivalent to `malloc`. Its first parameter is `user`.
+						void* (*allocate)(void* user, size_m size);
+						// @DOCLINE * `@NLFT* deallocate` - a function that frees the memory block `ptr`; equivalent to `free`. Its first parameter is `user`.
+						void (*deallocate)(void* user, void* ptr);
+						// @DOCLINE * `@NLFT* user` - a pointer passed to each function, such as a pointer to an arena.
+						void* user;
+					};
+
+					// @DOCLINE Graphics, object buffers, and textures remember the allocator they were allocated with, and are freed with it upon destruction, so the allocator must stay valid until they're destroyed. The vertex and index data generated when filling object buffers is allocated and freed within the same call, so setting the allocator to a per-frame arena only around those calls means that they never touch the global heap.
+
+					// @DOCLINE > muCOSA allocates its own memory with `mu_malloc` and `mu_free` regardless of the allocator.
+
 				// @DOCLINE ## Creation and destruction
 
 					// @DOCLINE The function `mug_context_create` creates a mug context, defined below: @NLNT
@@ -3633,6 +3654,27 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 				// @DOCLINE All major parts of the mutt API rely on loading a TrueType font and then reading data from it, which is encapsulated in the `muttFont` struct, which is described [later in the lower-level API section](#font-struct). Most casual usage of the mutt API only needs to treat `muttFont` as a handle to the font itself.
 
+				// @DOCLINE ## Custom allocators
+
+					typedef struct muttAllocator muttAllocator;
+
+					// @DOCLINE By default, all memory allocated for a font is allocated with `mu_malloc`, `mu_realloc`, and `mu_free`. A font can instead be loaded with a runtime allocator (see [loading a face](#font-collections)), which is represented by the struct `muttAllocator`, which has the following members:
+
+					struct muttAllocator {
+						// @DOCLINE * `@NLFT* allocate` - a function that allocates `size` bytes, returning 0 upon failure; equivalent to `malloc`. Its first parameter is `user`.
+						void* (*allocate)(void* user, size_m size);
+						// @DOCLINE * `@NLFT* reallocate` - a function that resizes the memory block `ptr` to `size` bytes, returning 0 upon failure; equivalent to `realloc`. Its first parameter is `user`.
+						void* (*reallocate)(void* user, void* ptr, size_m size);
+						// @DOCLINE * `@NLFT* deallocate` - a function that frees the memory block `ptr`; equivalent to `free`. Its first parameter is `user`.
+						void (*deallocate)(void* user, void* ptr);
+						// @DOCLINE * `@NLFT* user` - a pointer passed to each function, such as a pointer to an arena.
+						void* user;
+					};
+
+					// @DOCLINE A font's allocator is used for every allocation related to the font: its tables, temporary memory used by functions that take the font (such as when calculating glyph bounds or converting composite glyphs), the memory of [batch rasterization](#batch-rasterization) threads, and the memory of [atlases](#atlas-api) created for it. Memory is always freed with the same allocator it was allocated with, and the allocator struct must stay valid until the font is deloaded. If the allocator is used by fonts or atlases on multiple threads at once, its functions must be thread-safe.
+
+					// @DOCLINE [Raster scratch](#raster-scratch) memory isn't tied to a font, and is allocated with the allocator set in the scratch itself, which atlases and batch rasterization set to the font's allocator for the scratches they create.
+
 				// @DOCLINE ## Loading a font
 
 					typedef uint32_m muttLoadFlags;
@@ -3644,7 +3686,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 					// @DOCLINE If the result returned by mutt is fatal, the contents of `font` are undefined. If the result returned by mutt isn't fatal, the font has been successfully loaded, and must be deloaded at some point.
 
-					// @DOCLINE Once this function has finished executing, there are no internal dependencies on the pointer to the data given, and can be safely freed.
+					// @DOCLINE Once this function has finished executing, there are no internal dependencies on the pointer to the data given, and can be safely freed, unless the flag [`MUTT_LOAD_NO_COPY`](#font-load-options) is given.
 
 				// @DOCLINE ## Deloading a font
 
@@ -3653,6 +3695,49 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 					// @DOCLINE This function must be called on every successfully loaded font at some point. The contents of `font` are undefined after `mutt_deload` has been called on it.
 
+				// @DOCLINE ## Font collections
+
+					// @DOCLINE A TrueType collection (usually a ".ttc" file) stores several font faces in one file, and mutt supports loading any of them. The amount of faces stored in a font file can be retrieved with the function `mutt_collection_faces`, defined below: @NLNT
+					MUDEF muttResult mutt_collection_faces(muByte* data, uint64_m datalen, uint32_m* num_faces);
+
+					// @DOCLINE If the given data is a single font rather than a collection, `num_faces` is set to 1.
+
+					// @DOCLINE A single face can be loaded with the function `mutt_load_face`, defined below: @NLNT
+					MUDEF muttResult mutt_load_face(muByte* data, uint64_m datalen, uint32_m face_index, muttFont* font, muttLoadFlags load_flags, muttAllocator* allocator);
+
+					// @DOCLINE This function works exactly like `mutt_load`, but loads the face at index `face_index` within the collection, and uses `allocator` as the font's [allocator](#custom-allocators) if it isn't 0; `mutt_load` is equivalent to calling this function with a `face_index` and `allocator` of 0. A face loaded with this function is deloaded with `mutt_deload`.
+
+					// @DOCLINE Faces within a collection can share tables, such as a common glyf and loca table, by pointing to the same table data. To parse such tables only once for every face, several faces can be loaded at once with the function `mutt_load_collection`, defined below: @NLNT
+					MUDEF muttResult mutt_load_collection(muByte* data, uint64_m datalen, muttFont* fonts, uint32_m num_faces, muttLoadFlags load_flags, muttAllocator* allocator);
+
+					// @DOCLINE `fonts` is an array of `num_faces` fonts to be filled in with the first `num_faces` faces of the collection, all using `allocator` (if not 0). When a table of a face is stored at the same location as the same table in a face before it, and so are all of the tables it depends on, the face is given a pointer to the already-loaded table instead of parsing it again; the flags of these tables are set in the `shared_flags` member of the [font struct](#font-struct). Tables aren't shared between faces loaded with [`MUTT_LOAD_LAZY`](#lazy-loading).
+
+					// @DOCLINE If the result returned is fatal, none of the faces are loaded. Otherwise, every face has been successfully loaded, and since faces can point to tables owned by faces before them, they must all be deloaded at once with the function `mutt_deload_collection`, defined below: @NLNT
+					MUDEF void mutt_deload_collection(muttFont* fonts, uint32_m num_faces);
+
+				// @DOCLINE ## Mapping a font file
+
+					// @DOCLINE Instead of reading a font file into memory themselves, the user can map it into memory read-only with the function `mutt_map_file`, defined below: @NLNT
+					MUDEF muttResult mutt_map_file(const char* path, muByte** data, uint64_m* datalen);
+
+					// @DOCLINE `path` is the path to the font file, and `data` and `datalen` are filled in with a pointer to the mapped file and its length in bytes, which can then be given to `mutt_load`. Pages of the file are read from disk as they're accessed, and since the mapping is read-only, every process that maps the same file shares the same physical pages through the operating system's page cache. Paired with [`MUTT_LOAD_NO_COPY`](#font-load-options), this means that the raw data of the glyf table is never copied into memory private to the process.
+
+					// @DOCLINE If the result returned is fatal, `data` and `datalen` are not modified. Otherwise, the mapping must be released at some point (after every font loaded from it has been deloaded) with the function `mutt_unmap_file`, defined below: @NLNT
+					MUDEF void mutt_unmap_file(muByte* data, uint64_m datalen);
+
+					// @DOCLINE Memory-mapping is only implemented for POSIX systems (using `mmap`); on any other system, or if `MUTT_NO_MAP_FILE` is defined before the implementation of mutt, `mutt_map_file` always returns `MUTT_FAILED_MAP_FILE`.
+
+				// @DOCLINE ## Lazy loading
+
+					// @DOCLINE If the [load option](#font-load-options) `MUTT_LOAD_LAZY` is given, `mutt_load` only loads and verifies the [font directory](#font-directory), and each requested table is instead parsed the first time it's needed. Until then, the table's pointer in the [font struct](#font-struct) is 0, its result is `MUTT_TABLE_NOT_LOADED`, and its flag is set in `lazy_flags` rather than `load_flags` or `fail_load_flags`. Because of this, the data given to `mutt_load` must stay valid and unmodified until the font is deloaded.
+
+					// @DOCLINE The functions of mutt that read from a table (such as `mutt_get_glyph`, `mutt_glyph_header`, and `mutt_rglyph_metrics`) parse the tables they need if they haven't been yet, along with the tables that they depend on. Tables can also be parsed manually with the function `mutt_lazy_load`, defined below: @NLNT
+					MUDEF void mutt_lazy_load(muttFont* font, muttLoadFlags load_flags);
+
+					// @DOCLINE `load_flags` indicates which tables to parse; tables that aren't pending in `font->lazy_flags` are ignored, and pending tables that the given tables depend on are also parsed. This must be called before reading from a table's pointer directly, such as for the [name table](#name-table), which isn't used by any function in mutt. Each table is only ever attempted to be parsed once; the result is stored in the font struct just like in non-lazy loading.
+
+					// @DOCLINE Since parsing a table modifies the font struct, a font loaded lazily should only be used by one thread at a time until every table it needs has been parsed. `mutt_raster_glyphs` parses all of the tables it needs before creating any threads.
+
 				// @DOCLINE ## Font load flags
 
 					// @DOCLINE To customize what tables are loaded when loading a TrueType font, the type `muttLoadFlags` exists (typedef for `uint32_m`) whose bits indicate what tables should be loaded. It has the following defined values:
@@ -3667,7 +3752,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					#define MUTT_LOAD_HMTX 0x00000008
 					// @DOCLINE * [0x00000010] `MUTT_LOAD_LOCA` - load the [loca table](#loca-table).
 					#define MUTT_LOAD_LOCA 0x00000010
-					// @DOCLINE * [0x00000020] `MUTT_LOAD_POST` - load the post table.
+					// @DOCLINE * [0x00000020] `MUTT_LOAD_POST` - load the [post table](#post-table).
 					#define MUTT_LOAD_POST 0x00000020
 					// @DOCLINE * [0x00000040] `MUTT_LOAD_NAME` - load the [name table](#name-table).
 					#define MUTT_LOAD_NAME 0x00000040
@@ -3675,6 +3760,12 @@ All mu libraries included in muSDK have name functions to convert some of their
 					#define MUTT_LOAD_GLYF 0x00000080
 					// @DOCLINE * [0x00000100] `MUTT_LOAD_CMAP` - load the [cmap table](#cmap-table).
 					#define MUTT_LOAD_CMAP 0x00000100
+					// @DOCLINE * [0x00000200] `MUTT_LOAD_CMAP_LOOKUP` - build the [cmap lookup table](#cmap-lookup-table) once the cmap table is loaded.
+					#define MUTT_LOAD_CMAP_LOOKUP 0x00000200
+					// @DOCLINE * [0x00000400] `MUTT_LOAD_KERN` - load the [kern table](#kern-table).
+					#define MUTT_LOAD_KERN 0x00000400
+					// @DOCLINE * [0x00000800] `MUTT_LOAD_GPOS` - load the [GPOS table](#gpos-table).
+					#define MUTT_LOAD_GPOS 0x00000800
 
 					// @DOCLINE To see which tables successfully loaded, see the [section covering the font struct](#font-struct).
 
@@ -3685,8 +3776,28 @@ All mu libraries included in muSDK have name functions to convert some of their
 						// @DOCLINE * [0x000001FF] `MUTT_LOAD_REQUIRED` - load the tables required by the TrueType specification (maxp, head, hhea, hmtx, loca, post, name, glyf, and cmap).
 						#define MUTT_LOAD_REQUIRED 0x000001FF
 
-						// @DOCLINE * [0xFFFFFFFF] `MUTT_LOAD_ALL` - loads all tables that could be supported by mutt.
-						#define MUTT_LOAD_ALL 0xFFFFFFFF
+						// @DOCLINE * [0x00000C00] `MUTT_LOAD_KERNING` - load the tables used for [kerning](#kerning) (kern and GPOS).
+						#define MUTT_LOAD_KERNING 0x00000C00
+
+						// @DOCLINE * [0x1FFFFFFF] `MUTT_LOAD_ALL` - loads all tables that could be supported by mutt. This doesn't include any [load options](#font-load-options).
+						#define MUTT_LOAD_ALL 0x1FFFFFFF
+
+					// @DOCLINE ### Font load options
+
+						// @DOCLINE Some bits of `muttLoadFlags` don't indicate a table to load, but rather change how tables are loaded. These are the defined options:
+
+						// @DOCLINE * [0x80000000] `MUTT_LOAD_NO_COPY` - make loaded tables point into the data given to `mutt_load` wherever they can, rather than copying it into memory allocated by mutt. This currently applies to the raw data of the [glyf table](#glyf-table) (`muttGlyf->data`) and the string data of the [name table](#name-table) (`muttName->string_data`) and [post table](#post-table) (`muttPost->string_data`); other tables are converted from big-endian as they're loaded, and are therefore still copied. If this option is used, the data given to `mutt_load` must stay valid and unmodified until the font is deloaded.
+						#define MUTT_LOAD_NO_COPY 0x80000000
+
+						// @DOCLINE * [0x40000000] `MUTT_LOAD_LAZY` - only load the font directory, and parse each requested table the first time it's needed; see the [lazy loading section](#lazy-loading).
+						#define MUTT_LOAD_LAZY 0x40000000
+
+						// @DOCLINE * [0x20000000] `MUTT_LOAD_NO_CHECKSUM` - don't verify the checksum of each table in the [font directory](#font-directory). This should only be used for trusted fonts, as a corrupted table is then only caught by the checks performed when parsing it (if at all).
+						#define MUTT_LOAD_NO_CHECKSUM 0x20000000
+
+						// @DOCLINE If a load option is given, it is set in the `load_flags` member of the [font struct](#font-struct) upon loading.
+
+						// @DOCLINE `MUTT_LOAD_ALL` used to be 0xFFFFFFFF, and was made smaller as load options were added so that it never implies one. Code that passes 0xFFFFFFFF or `~0` as load flags instead of `MUTT_LOAD_ALL` therefore turns on every load option as well, which changes how the font's memory is owned; such code should use `MUTT_LOAD_ALL` instead.
 
 			// @DOCLINE # Low-level API
 
@@ -3704,6 +3815,9 @@ All mu libraries included in muSDK have name functions to convert some of their
 					typedef struct muttName muttName;
 					typedef struct muttGlyf muttGlyf;
 					typedef struct muttCmap muttCmap;
+					typedef struct muttKern muttKern;
+					typedef struct muttGpos muttGpos;
+					typedef struct muttOutlineCache muttOutlineCache;
 
 					// @DOCLINE The font struct, `muttFont`, is the primary way of reading information from TrueType tables, holding pointers to each table's defined data, and is automatically filled using the function [`mutt_load`](#loading-a-font). It has the following members:
 
@@ -3712,6 +3826,16 @@ All mu libraries included in muSDK have name functions to convert some of their
 						muttLoadFlags load_flags;
 						// @DOCLINE * `@NLFT fail_load_flags` - flags indicating which requested tables did not successfully load.
 						muttLoadFlags fail_load_flags;
+						// @DOCLINE * `@NLFT lazy_flags` - flags indicating which requested tables haven't been parsed yet; always 0 unless the font was loaded with [`MUTT_LOAD_LAZY`](#lazy-loading).
+						muttLoadFlags lazy_flags;
+						// @DOCLINE * `@NLFT* data` - the data given to `mutt_load`, which pending tables are parsed from; 0 unless the font was loaded with `MUTT_LOAD_LAZY`.
+						muByte* data;
+						// @DOCLINE * `@NLFT shared_flags` - flags indicating which loaded tables are owned by another face of the same [collection](#font-collections), and therefore aren't deallocated when this font is deloaded.
+						muttLoadFlags shared_flags;
+						// @DOCLINE * `@NLFT* allocator` - the [allocator](#custom-allocators) used for the font's memory; 0 if `mu_malloc`, `mu_realloc`, and `mu_free` are used.
+						muttAllocator* allocator;
+						// @DOCLINE * `@NLFT* outline_cache` - the [outline cache](#outline-cache) of the font; 0 if it doesn't have one.
+						muttOutlineCache* outline_cache;
 
 						// @DOCLINE * `@NLFT* directory` - a pointer to the [font directory](#font-directory).
 						muttDirectory* directory;
@@ -3741,7 +3865,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 						// @DOCLINE * `@NLFT loca_res` - the result of attempting to load the loca table.
 						muttResult loca_res;
 
-						// @DOCLINE * `@NLFT* post` - a pointer to the post table.
+						// @DOCLINE * `@NLFT* post` - a pointer to the [post table](#post-table).
 						muttPost* post;
 						// @DOCLINE * `@NLFT post_res` - the result of attempting to load the post table.
 						muttResult post_res;
@@ -3760,6 +3884,16 @@ All mu libraries included in muSDK have name functions to convert some of their
 						muttCmap* cmap;
 						// @DOCLINE * `@NLFT cmap_res` - the result of attempting to load the cmap table.
 						muttResult cmap_res;
+
+						// @DOCLINE * `@NLFT* kern` - a pointer to the [kern table](#kern-table).
+						muttKern* kern;
+						// @DOCLINE * `@NLFT kern_res` - the result of attempting to load the kern table.
+						muttResult kern_res;
+
+						// @DOCLINE * `@NLFT* gpos` - a pointer to the [GPOS table](#gpos-table).
+						muttGpos* gpos;
+						// @DOCLINE * `@NLFT gpos_res` - the result of attempting to load the GPOS table.
+						muttResult gpos_res;
 					};
 
 					// @DOCLINE For each optionally-loadable table within the `muttFont` struct, there exists two members: one that exists as a pointer to the table, and a result value storing the result of attempting to load the table itself. If the respective result value is fatal, or the user never requested for the table to be loaded, the pointer to the table will be 0. Otherwise, the member will be a valid pointer to the table information.
@@ -3794,7 +3928,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 							uint32_m length;
 						};
 
-						// @DOCLINE The checksum value is not validated for the head table, as the head table itself includes a checksum value.
+						// @DOCLINE The checksum value is not validated for the head table, as the head table itself includes a checksum value, nor for any table if the [load option](#font-load-options) `MUTT_LOAD_NO_CHECKSUM` is given. Checksums are summed using [SIMD](#simd) if available.
 
 				// @DOCLINE ## Maxp table
 
@@ -3924,6 +4058,10 @@ All mu libraries included in muSDK have name functions to convert some of their
 						muttLongHorMetric* hmetrics;
 						// @DOCLINE * `@NLFT* left_side_bearings` - equivalent to "leftSideBearings" in the hmtx table. Its length is equivalent to `maxp->num_glyphs - hhea->number_of_hmetrics`.
 						int16_m* left_side_bearings;
+						// @DOCLINE * `@NLFT* advance_widths` - the advance width of each glyph, expanded from `hmetrics` so that every glyph past its end has the advance width of its last record (or 0 if it has none). Its length is equivalent to `maxp->num_glyphs`.
+						uint16_m* advance_widths;
+						// @DOCLINE * `@NLFT* lsbs` - the left-side bearing of each glyph, taken from `hmetrics` or `left_side_bearings`. Its length is equivalent to `maxp->num_glyphs`.
+						int16_m* lsbs;
 					};
 
 					// @DOCLINE The struct `muttLongHorMetrics` has the following members:
@@ -3937,6 +4075,8 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 					// @DOCLINE All values provided in the `muttHmtx` struct (AKA the values in `muttLongHorMetrics`) are not checked, as virtually all of them have no technically "incorrect" values (from what I'm aware).
 
+					// @DOCLINE `advance_widths` and `lsbs` hold no information that `hmetrics` and `left_side_bearings` don't, but allow the metrics of any glyph to be read without checking which array it's in.
+
 				// @DOCLINE ## Loca table
 
 					// @DOCLINE The union `muttLoca` is used to represent the loca table provided by a TrueType font, stored in the struct `muttFont` as the pointer member "`loca`", and loaded with the flag `MUTT_LOAD_LOCA` (`MUTT_LOAD_MAXP`, `MUTT_LOAD_HEAD`, and `MUTT_LOAD_GLYF` must also be defined). It has the following members:
@@ -3950,6 +4090,79 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 					// @DOCLINE The offsets are verified to be within range of the glyf table, along with all of the other rules within the specification.
 
+				// @DOCLINE ## Post table
+
+					// @DOCLINE The struct `muttPost` is used to represent the post table provided by a TrueType font, stored in the struct `muttFont` as the pointer member "`post`", and loaded with the flag `MUTT_LOAD_POST` (`MUTT_LOAD_MAXP` must also be defined). It has the following members:
+
+					struct muttPost {
+						// @DOCLINE * `@NLFT version_high` - equivalent to the high bytes of "version" in the post table; 1, 2, or 3.
+						uint16_m version_high;
+						// @DOCLINE * `@NLFT version_low` - equivalent to the low bytes of "version" in the post table; 0x5000 for version 2.5, and 0 otherwise.
+						uint16_m version_low;
+						// @DOCLINE * `@NLFT italic_angle_high` - equivalent to the high bytes of "italicAngle" in the post table.
+						int16_m italic_angle_high;
+						// @DOCLINE * `@NLFT italic_angle_low` - equivalent to the low bytes of "italicAngle" in the post table.
+						uint16_m italic_angle_low;
+						// @DOCLINE * `@NLFT underline_position` - equivalent to "underlinePosition" in the post table.
+						int16_m underline_position;
+						// @DOCLINE * `@NLFT underline_thickness` - equivalent to "underlineThickness" in the post table.
+						int16_m underline_thickness;
+						// @DOCLINE * `@NLFT is_fixed_pitch` - equivalent to "isFixedPitch" in the post table; non-zero if the font is monospaced.
+						uint32_m is_fixed_pitch;
+						// @DOCLINE * `@NLFT min_mem_type42` - equivalent to "minMemType42" in the post table.
+						uint32_m min_mem_type42;
+						// @DOCLINE * `@NLFT max_mem_type42` - equivalent to "maxMemType42" in the post table.
+						uint32_m max_mem_type42;
+						// @DOCLINE * `@NLFT min_mem_type1` - equivalent to "minMemType1" in the post table.
+						uint32_m min_mem_type1;
+						// @DOCLINE * `@NLFT max_mem_type1` - equivalent to "maxMemType1" in the post table.
+						uint32_m max_mem_type1;
+						// @DOCLINE * `@NLFT num_glyphs` - the amount of glyphs that have a name; the length of `glyph_name_index`.
+						uint16_m num_glyphs;
+						// @DOCLINE * `@NLFT* glyph_name_index` - the name index of each glyph; equivalent to "glyphNameIndex" in the post table. An index below 258 refers to a [standard Macintosh glyph name](#standard-glyph-names), and any other index refers to `names[index-258]`. 0 if `num_glyphs` is 0.
+						uint16_m* glyph_name_index;
+						// @DOCLINE * `@NLFT num_names` - the amount of names stored within the post table; the length of `names`.
+						uint16_m num_names;
+						// @DOCLINE * `@NLFT** names` - a pointer to each name stored within `string_data`, each being a Pascal string (its first byte being its length, followed by its characters). 0 if `num_names` is 0.
+						muByte** names;
+						// @DOCLINE * `@NLFT* string_data` - the raw string data provided by the post table (version 2 only). All pointers within `names` are pointers to parts of this data.
+						muByte* string_data;
+						// @DOCLINE * `@NLFT lookup_capacity` - the amount of slots in the `lookup` array; always a power of 2 at least twice as large as `num_glyphs`, or 0 if no glyphs have a name.
+						uint32_m lookup_capacity;
+						// @DOCLINE * `@NLFT* lookup` - the [name lookup table](#name-lookup-table). 0 if no glyphs have a name.
+						uint16_m* lookup;
+					};
+
+					// @DOCLINE Version 1 of the post table gives the first 258 glyphs the standard Macintosh glyph names in order, and version 2.5 gives each glyph a standard name by an offset from its ID; both are converted into `glyph_name_index` upon loading, so that it can be read the same way for versions 1, 2, and 2.5. Version 3 has no glyph names, so `num_glyphs` is 0.
+
+					// @DOCLINE Each index in `glyph_name_index` is verified to be in range, and each name within `names` is verified to lie within the table.
+
+					// @DOCLINE ### Name lookup table
+
+						// @DOCLINE The member `lookup` of `muttPost` is a hash table of glyph IDs keyed by glyph name, built when the post table is loaded so that a glyph can be found by its name in a single probe on average, rather than by comparing the name of each glyph. Each slot holds a glyph ID, or 0xFFFF if it's unused. A glyph is stored in the first unused slot starting from the index `mutt_glyph_name_hash(name, length) & (lookup_capacity-1)` and moving forward one slot at a time, wrapping back around to 0 at the end of the array. The function `mutt_glyph_name_hash` is defined below: @NLNT
+						MUDEF uint32_m mutt_glyph_name_hash(const muByte* name, uint8_m length);
+
+						// @DOCLINE If several glyphs share a name, only the one with the lowest glyph ID is stored.
+
+					// @DOCLINE ### Glyph names
+
+						// @DOCLINE The function `mutt_get_glyph_name` retrieves the name of a glyph, defined below: @NLNT
+						MUDEF const muByte* mutt_get_glyph_name(muttFont* font, uint16_m glyph_id, uint8_m* length);
+
+						// @DOCLINE The returned pointer points to the characters of the name, and `length` is set to the amount of characters; the name is not null-terminated. 0 is returned if the post table isn't loaded, or the glyph has no name.
+
+						// @DOCLINE The function `mutt_get_glyph_by_name` retrieves the glyph ID of a glyph by its name, defined below: @NLNT
+						MUDEF uint16_m mutt_get_glyph_by_name(muttFont* font, const muByte* name, uint8_m length);
+
+						// @DOCLINE `name` is the characters of the name (not including a null-terminating character if it has one), and `length` is the amount of characters. 0 is returned if the post table isn't loaded, or no glyph has the given name.
+
+					// @DOCLINE ### Standard glyph names
+
+						// @DOCLINE The function `mutt_standard_glyph_name` returns the standard Macintosh glyph name at a given index, defined below: @NLNT
+						MUDEF const char* mutt_standard_glyph_name(uint16_m index);
+
+						// @DOCLINE The returned string is null-terminated. 0 is returned if `index` is 258 or greater.
+
 				// @DOCLINE ## Name table
 
 					typedef struct muttNameRecord muttNameRecord;
@@ -4042,6 +4255,8 @@ All mu libraries included in muSDK have name functions to convert some of their
 								muByte* data;
 								// @DOCLINE * `@NLFT length` - the length of the data after the header in bytes. If this member is equal to 0, the given glyph has no outline, and should not be called with any functions.
 								uint32_m length;
+								// @DOCLINE * `@NLFT glyph_id` - the glyph ID that the header was retrieved for. This is used to look up the glyph in the font's [outline cache](#outline-cache).
+								uint16_m glyph_id;
 							};
 
 							// @DOCLINE The minimums and maximums for x- and y-coordinates within the glyph header are not checked initially (besides making sure the minimums are less than or equal to the maximums, and that they're within range of the values provided by the head table); if the actual glyph coordinates are not confined within the given minimums and maximums, a non-fatal result will be provided upon loading the simple glyph data. Either way, the header's listed x/y min/max values are overwritten with mutt's upon loading a simple glyph.
@@ -4277,6 +4492,12 @@ All mu libraries included in muSDK have name functions to convert some of their
 						uint16_m num_tables;
 						// @DOCLINE * `@NLFT* encoding_records` - equivalent to "encodingRecords" in the cmap header; an array of each encoding record in the cmap table.
 						muttEncodingRecord* encoding_records;
+						// @DOCLINE * `@NLFT* preferred` - the [preferred encoding record](#preferred-encoding-record) used to convert codepoints to glyph IDs; 0 if there is none.
+						muttEncodingRecord* preferred;
+						// @DOCLINE * `@NLFT* lookup_blocks` - the first level of the [cmap lookup table](#cmap-lookup-table); 0 if it wasn't built.
+						uint16_m* lookup_blocks;
+						// @DOCLINE * `@NLFT* lookup_pages` - the second level of the [cmap lookup table](#cmap-lookup-table); 0 if it wasn't built.
+						uint16_m* lookup_pages;
 					};
 
 					// @DOCLINE The union `muttCmapFormat` represents a cmap format for a cmap encoding record. It has the following members:
@@ -4321,6 +4542,25 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 						// @DOCLINE Both functions return 0 if no equivalent could be found in the conversion process for any cmap encoding record.
 
+						// @DOCLINE The function `mutt_get_glyphs` converts multiple codepoints to glyph IDs, defined below: @NLNT
+						MUDEF void mutt_get_glyphs(muttFont* font, uint32_m* codepoints, size_m count, uint16_m* glyphs);
+
+						// @DOCLINE `glyphs` must have room for `count` glyph IDs, and each glyph ID is equivalent to calling `mutt_get_glyph` on the respective codepoint, but without deciding how to convert codepoints for each one.
+
+					// @DOCLINE ### Preferred encoding record
+
+						// @DOCLINE Upon loading the cmap table, the encoding record best-suited for converting Unicode codepoints is chosen as the preferred encoding record, which `mutt_get_glyph` uses exclusively rather than searching each encoding record. An encoding record is considered to be Unicode if its platform ID is 0 (Unicode), or if its platform ID is 3 (Windows) and its encoding ID is 1 (Unicode BMP) or 10 (Unicode full repertoire). Of the Unicode encoding records that successfully loaded, format 12 is preferred over format 4, which is preferred over format 0; if multiple encoding records are equally preferred, the first one is chosen.
+
+						// @DOCLINE If no Unicode encoding record successfully loaded, `preferred` is 0, and `mutt_get_glyph` searches each encoding record, returning the first non-zero glyph ID.
+
+					// @DOCLINE ### Cmap lookup table
+
+						// @DOCLINE If the flag `MUTT_LOAD_CMAP_LOOKUP` is given when loading a font, a two-level page table is built from the cmap table once it is loaded, which `mutt_get_glyph` uses to convert any codepoint from 0 to 0x10FFFF to a glyph ID in constant time. The table gives the same glyph IDs that `mutt_get_glyph` would without it.
+
+						// @DOCLINE The table is made up of 256-codepoint pages: `lookup_blocks` holds, for each block of 256 codepoints (0x1100 blocks in total), the index of its page, and `lookup_pages` holds each page's glyph IDs one after another. Page 0 is shared by all blocks with no codepoints in the cmap table, and only holds 0, so a codepoint's glyph ID is `lookup_pages[(lookup_blocks[codepoint >> 8] << 8) | (codepoint & 0xFF)]`.
+
+						// @DOCLINE If the table couldn't be built (due to a failed allocation), the cmap table still loads, and `MUTT_LOAD_CMAP_LOOKUP` is set in `fail_load_flags` rather than `load_flags`.
+
 					// @DOCLINE ### Cmap encoding
 
 						// @DOCLINE The function `mutt_cmap_encoding_get_glyph` converts a given codepoint value to a glyph ID value using the given cmap encoding record, defined below: @NLNT
@@ -4390,6 +4630,8 @@ All mu libraries included in muSDK have name functions to convert some of their
 						// @DOCLINE The function `mutt_cmap4_get_glyph` converts a given codepoint value to a glyph ID value using the given format 4 cmap subtable, defined below: @NLNT
 						MUDEF uint16_m mutt_cmap4_get_glyph(muttFont* font, muttCmap4* f4, uint16_m codepoint);
 
+						// @DOCLINE This function binary searches the segments by their end code, which are verified to be incremental upon loading.
+
 						// @DOCLINE The function `mutt_cmap4_get_codepoint` converts a given glyph ID to a codepoint value using the given format 4 cmap subtable, defined below: @NLNT
 						MUDEF uint16_m mutt_cmap4_get_codepoint(muttFont* font, muttCmap4* f4, uint16_m glyph);
 
@@ -4422,11 +4664,128 @@ All mu libraries included in muSDK have name functions to convert some of their
 						// @DOCLINE The function `mutt_cmap12_get_glyph` converts a given codepoint value to a glyph ID value using the given format 12 cmap subtable, defined below: @NLNT
 						MUDEF uint16_m mutt_cmap12_get_glyph(muttFont* font, muttCmap12* f12, uint32_m codepoint);
 
+						// @DOCLINE This function binary searches the groups, which are verified to be incremental and non-overlapping upon loading.
+
 						// @DOCLINE The function `mutt_cmap12_get_codepoint` converts a given glyph ID to a codepoint value using the given format 12 cmap subtable, defined below: @NLNT
 						MUDEF uint32_m mutt_cmap12_get_codepoint(muttFont* font, muttCmap12* f12, uint16_m glyph);
 
 						// @DOCLINE Both functions return 0 if no equivalent could be found in the conversion process.
 
+				// @DOCLINE ## Pair table
+
+					typedef struct muttPairTable muttPairTable;
+					typedef struct muttKernPair muttKernPair;
+
+					// @DOCLINE The struct `muttPairTable` is a hash table of kerning pairs, built when a table holding kerning pairs is loaded so that the kerning of a pair can be found in a single probe on average, rather than by searching through each subtable. It has the following members:
+					struct muttPairTable {
+						// @DOCLINE * `@NLFT count` - the amount of pairs within the table.
+						uint32_m count;
+						// @DOCLINE * `@NLFT capacity` - the amount of slots in the `pairs` array; always a power of 2 at least twice as large as `count`, or 0 if there are no pairs.
+						uint32_m capacity;
+						// @DOCLINE * `@NLFT* pairs` - an array of each slot in the table; 0 if there are no pairs.
+						muttKernPair* pairs;
+					};
+
+					// @DOCLINE The struct `muttKernPair` represents a slot in a pair table, and has the following members:
+					struct muttKernPair {
+						// @DOCLINE * `@NLFT left` - the glyph ID of the left glyph in the pair; 0xFFFF if the slot is unused.
+						uint16_m left;
+						// @DOCLINE * `@NLFT right` - the glyph ID of the right glyph in the pair.
+						uint16_m right;
+						// @DOCLINE * `@NLFT value` - the kerning value of the pair, in FUnits.
+						int16_m value;
+					};
+
+					// @DOCLINE A pair is stored in the first unused or matching slot starting from the index `mutt_pair_hash(left, right) & (capacity-1)` and moving forward one slot at a time, wrapping back around to 0 at the end of the array. The function `mutt_pair_hash` is defined below: @NLNT
+					MUDEF uint32_m mutt_pair_hash(uint16_m left, uint16_m right);
+
+				// @DOCLINE ## Kern table
+
+					// @DOCLINE The struct `muttKern` is used to represent the kern table provided by a TrueType font, stored in the struct `muttFont` as the pointer member "`kern`", and loaded with the flag `MUTT_LOAD_KERN` (`MUTT_LOAD_MAXP` must also be defined). It has the following members:
+
+					struct muttKern {
+						// @DOCLINE * `@NLFT version` - equivalent to "version" in the kern header; 0 for the Windows version of the table, and 0x00010000 for the Apple version.
+						uint32_m version;
+						// @DOCLINE * `@NLFT num_tables` - equivalent to "nTables" in the kern header; the amount of subtables in the kern table.
+						uint32_m num_tables;
+						// @DOCLINE * `@NLFT pairs` - the [pair table](#pair-table) holding the kerning value of each pair of glyphs listed in the kern table.
+						muttPairTable pairs;
+					};
+
+					// @DOCLINE Only format 0 subtables holding horizontal kerning values are read; subtables of other formats, or subtables holding minimum, cross-stream, or variation values, are skipped. The pairs of every read subtable are combined into `pairs` in the order that the subtables are listed, with the value of a pair listed in multiple subtables being the sum of its values, unless the Windows "override" coverage bit is set, in which case the subtable's value replaces it. Pairs with a glyph ID out of range for the font are ignored.
+
+					// @DOCLINE > The "length" of a Windows format 0 subtable is stored as a 16-bit value, which some fonts overflow by listing more than 10,921 pairs in a single subtable. Because of this, the length of a format 0 subtable is calculated from "nPairs" rather than read from its header.
+
+					// @DOCLINE The function `mutt_kern_get_kerning` returns the kerning value of a pair of glyphs using the given kern table, defined below: @NLNT
+					MUDEF int16_m mutt_kern_get_kerning(muttFont* font, muttKern* kern, uint16_m left, uint16_m right);
+
+					// @DOCLINE The returned value is in FUnits, and is 0 if the pair isn't listed.
+
+				// @DOCLINE ## GPOS table
+
+					typedef struct muttPairClass muttPairClass;
+
+					// @DOCLINE The struct `muttGpos` is used to represent the kerning information held in the GPOS table provided by a font, stored in the struct `muttFont` as the pointer member "`gpos`", and loaded with the flag `MUTT_LOAD_GPOS` (`MUTT_LOAD_MAXP` must also be defined). It has the following members:
+
+					struct muttGpos {
+						// @DOCLINE * `@NLFT major_version` - equivalent to "majorVersion" in the GPOS header.
+						uint16_m major_version;
+						// @DOCLINE * `@NLFT minor_version` - equivalent to "minorVersion" in the GPOS header.
+						uint16_m minor_version;
+						// @DOCLINE * `@NLFT num_lookups` - the amount of pair adjustment lookups used for kerning.
+						uint16_m num_lookups;
+						// @DOCLINE * `@NLFT pairs` - a [pair table](#pair-table) holding the kerning value of each pair whose kerning can't be calculated from `pair_classes`.
+						muttPairTable pairs;
+						// @DOCLINE * `@NLFT num_pair_classes` - the amount of class pair adjustment subtables in the `pair_classes` array.
+						uint32_m num_pair_classes;
+						// @DOCLINE * `@NLFT* pair_classes` - an array of each [class pair adjustment subtable](#class-pair-adjustment) used for kerning, in the order that they're applied; 0 if there are none.
+						muttPairClass* pair_classes;
+					};
+
+					// @DOCLINE Only pair adjustment lookups (lookup type 2, including those stored within an extension lookup) referenced by a feature tagged 'kern' are used, and only the "xAdvance" value of the first glyph in each pair is read, since that's what adjusts the spacing between the two glyphs in horizontal text. Lookups are applied in the order they're listed, and the kerning value of a pair is the sum of the value given by each lookup, each lookup giving the value of the first subtable that applies to the pair. Lookup flags and all other lookup types are ignored.
+
+					// @DOCLINE Pairs listed individually (pair adjustment format 1) aren't stored on their own; instead, upon loading, the kerning value of each of these pairs is calculated across every lookup, and stored in `pairs` if it differs from the value calculated from `pair_classes` alone. This means that the kerning value of a pair is always its value in `pairs` if it's in there, and its value calculated from `pair_classes` if not. Glyphs with an ID out of range for the font are ignored.
+
+					// @DOCLINE The function `mutt_gpos_get_kerning` returns the kerning value of a pair of glyphs using the given GPOS table, defined below: @NLNT
+					MUDEF int16_m mutt_gpos_get_kerning(muttFont* font, muttGpos* gpos, uint16_m left, uint16_m right);
+
+					// @DOCLINE The returned value is in FUnits, and is 0 if no lookup applies to the pair.
+
+					// @DOCLINE ### Class pair adjustment
+
+						// @DOCLINE The struct `muttPairClass` represents a pair adjustment format 2 subtable, with its class definitions converted into arrays indexed by glyph ID. It has the following members:
+						struct muttPairClass {
+							// @DOCLINE * `@NLFT lookup` - the index of the subtable's lookup among the pair adjustment lookups used for kerning.
+							uint16_m lookup;
+							// @DOCLINE * `@NLFT first_glyph1` - the glyph ID of the first value in the `class1` array.
+							uint16_m first_glyph1;
+							// @DOCLINE * `@NLFT glyph1_count` - the amount of values in the `class1` array.
+							uint16_m glyph1_count;
+							// @DOCLINE * `@NLFT* class1` - the class of each glyph as the first glyph in a pair, starting from `first_glyph1`; 0xFFFF if the glyph isn't covered by the subtable (or its class is out of range).
+							uint16_m* class1;
+							// @DOCLINE * `@NLFT first_glyph2` - the glyph ID of the first value in the `class2` array.
+							uint16_m first_glyph2;
+							// @DOCLINE * `@NLFT glyph2_count` - the amount of values in the `class2` array.
+							uint16_m glyph2_count;
+							// @DOCLINE * `@NLFT* class2` - the class of each glyph as the second glyph in a pair, starting from `first_glyph2`; 0xFFFF if its class is out of range. Glyphs outside of the array are in class 0.
+							uint16_m* class2;
+							// @DOCLINE * `@NLFT class1_count` - equivalent to "class1Count" in the pair adjustment format 2 subtable.
+							uint16_m class1_count;
+							// @DOCLINE * `@NLFT class2_count` - equivalent to "class2Count" in the pair adjustment format 2 subtable.
+							uint16_m class2_count;
+							// @DOCLINE * `@NLFT* values` - the kerning value of each class pair, in FUnits; the value for a pair of classes is `values[class1*class2_count + class2]`.
+							int16_m* values;
+						};
+
+						// @DOCLINE The subtable applies to a pair if the first glyph's class isn't 0xFFFF and the second glyph's class isn't 0xFFFF.
+
+				// @DOCLINE ## Kerning
+
+					// @DOCLINE The function `mutt_get_kerning` returns the kerning value of a pair of glyphs, defined below: @NLNT
+					MUDEF int16_m mutt_get_kerning(muttFont* font, uint16_m left, uint16_m right);
+
+					// @DOCLINE The returned value is in FUnits, and should be added to the advance width of the left glyph when laying out horizontal text. The [GPOS table](#gpos-table) is used if it's loaded and has any pair adjustment lookups used for kerning; otherwise, the [kern table](#kern-table) is used if it's loaded. 0 is returned if neither table is available, or if the pair has no kerning.
+
 				// @DOCLINE ## User allocated functions
 
 					/* @DOCBEGIN
@@ -5094,6 +5453,118 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// @DOCLINE Rasterizing a glyph is performed with the function `mutt_raster_glyph`, defined below: @NLNT
 					MUDEF muttResult mutt_raster_glyph(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method);
 
+					// @DOCLINE This function is equivalent to calling [`mutt_raster_glyph_info`](#raster-info) with `info` set to 0.
+
+					// @DOCLINE ### Raster info
+
+						typedef struct muttRInfo muttRInfo;
+
+						// @DOCLINE Additional settings for rasterizing a glyph can be given with the function `mutt_raster_glyph_info`, defined below: @NLNT
+						MUDEF muttResult mutt_raster_glyph_info(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method, muttRInfo* info);
+
+						// @DOCLINE `info` can be 0, in which case default values for all settings are used. Otherwise, it is a pointer to the struct `muttRInfo`, which has the following members:
+
+						typedef struct muttRScratch muttRScratch;
+
+						struct muttRInfo {
+							// @DOCLINE * `@NLFT tolerance` - the maximum distance, in pixels, that any line used to approximate a curve in the glyph is allowed to stray from the curve. Curves are split into more lines the more curved they are at the glyph's pixel scale, up to a maximum of 64 lines per curve; a lower tolerance gives smoother curves at the cost of more lines to rasterize. A value of 0 or less uses the default value `MUTTR_DEFAULT_TOLERANCE`.
+							float tolerance;
+							// @DOCLINE * `@NLFT* scratch` - the [scratch memory](#raster-scratch) to use for rasterization. A value of 0 makes rasterization allocate and free its own memory.
+							muttRScratch* scratch;
+							// @DOCLINE * `@NLFT sdf_range` - the distance, in pixels, from the outline of the glyph at which a [signed distance field](#signed-distance-fields) value reaches being fully inside or outside of the glyph. A value of 0 or less uses the default value `MUTTR_DEFAULT_SDF_RANGE`. This is ignored by all other methods.
+							float sdf_range;
+							// @DOCLINE * `@NLFT lcd_filter[5]` - the weights of the FIR filter applied to the subpixels of [LCD subpixel rendering](#lcd-subpixel-rendering), from two subpixels to the left to two subpixels to the right. The weights are divided by their sum, so they don't need to add up to any particular value. If every weight is 0, the default filter `MUTTR_LCD_FILTER_DEFAULT` is used. This is ignored by all other methods.
+							uint8_m lcd_filter[5];
+							// @DOCLINE * `@NLFT fixed` - whether or not to rasterize with [fixed-point math](#fixed-point-rasterization) rather than floating-point math. This is ignored by methods without a fixed-point version, which are all methods other than full-pixel bi-level, anti-aliased, and area coverage rasterization.
+							muBool fixed;
+						};
+
+						// @DOCLINE The macro `MUTTR_DEFAULT_TOLERANCE` is the default tolerance used, defined below: @NLNT
+						#define MUTTR_DEFAULT_TOLERANCE (1.f/16.f)
+
+						// @DOCLINE The macro `MUTTR_DEFAULT_SDF_RANGE` is the default SDF range used, defined below: @NLNT
+						#define MUTTR_DEFAULT_SDF_RANGE 4.f
+
+						// @DOCLINE The following LCD filters are defined as array initializers, and can be copied into `lcd_filter`:
+
+						// @DOCLINE * `MUTTR_LCD_FILTER_DEFAULT` - the default filter, which removes most color fringing at the cost of some sharpness; the same weights as FreeType's default LCD filter.
+						#define MUTTR_LCD_FILTER_DEFAULT { 0x08, 0x4D, 0x56, 0x4D, 0x08 }
+						// @DOCLINE * `MUTTR_LCD_FILTER_LIGHT` - a lighter filter that keeps more sharpness, but leaves more color fringing; the same weights as FreeType's light LCD filter.
+						#define MUTTR_LCD_FILTER_LIGHT { 0x00, 0x55, 0x56, 0x55, 0x00 }
+						// @DOCLINE * `MUTTR_LCD_FILTER_NONE` - no filtering; each subpixel uses its own coverage. This gives the sharpest result, but with strong color fringing.
+						#define MUTTR_LCD_FILTER_NONE { 0x00, 0x00, 0x01, 0x00, 0x00 }
+
+					// @DOCLINE ### Raster scratch
+
+						// @DOCLINE Rasterization needs temporary memory, whose size depends on the glyph, bitmap, and method. By default, this memory is allocated and freed on every call, but a scratch, represented by the struct `muttRScratch`, can be given via [raster info](#raster-info) to keep this memory between calls, making rasterization perform no allocations once the scratch is large enough. It has the following members:
+
+						struct muttRScratch {
+							// @DOCLINE * `@NLFT size` - the size of `data`, in bytes.
+							size_m size;
+							// @DOCLINE * `@NLFT* data` - the memory of the scratch, allocated with `allocator`.
+							muByte* data;
+							// @DOCLINE * `@NLFT* allocator` - the [allocator](#custom-allocators) used for `data`; 0 if `mu_malloc` and `mu_free` are used.
+							muttAllocator* allocator;
+						};
+
+						// @DOCLINE A scratch must be zero-initialized before its first use (such as with `MU_ZERO_STRUCT`), and is grown automatically when a rasterization call needs more memory than it holds. A scratch must not be used by more than one rasterization call at a time; for multi-threaded rasterization, each thread should use its own scratch.
+
+						// @DOCLINE The function `mutt_rscratch_reserve` ensures that a scratch holds at least a given amount of memory, defined below: @NLNT
+						MUDEF muttResult mutt_rscratch_reserve(muttRScratch* scratch, size_m size);
+
+						// @DOCLINE If the scratch needs to grow, its old contents are not kept. Upon a fatal result, the scratch holds no memory.
+
+						// @DOCLINE The function `mutt_rscratch_free` frees the memory held by a scratch, defined below: @NLNT
+						MUDEF void mutt_rscratch_free(muttRScratch* scratch);
+
+						// @DOCLINE After this function, the scratch holds no memory, and can still be used again.
+
+						// @DOCLINE The function `mutt_raster_glyph_scratch` returns the amount of scratch memory needed to rasterize a glyph with the given arguments, defined below: @NLNT
+						MUDEF size_m mutt_raster_glyph_scratch(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method, muttRInfo* info);
+
+						// @DOCLINE This value can be used to reserve scratch memory ahead of time. 0 is returned if the method is unknown; 0 can also be returned for a known method if rasterizing the glyph needs no memory, such as a glyph with no contours rasterized with `MUTTR_FULL_PIXEL_BI_LEVEL`.
+
+					// @DOCLINE ### Raster spans
+
+						// @DOCLINE Rather than filling a bitmap, a glyph can be rasterized to horizontal spans of pixels with the same coverage value, which can be blended directly onto a larger surface without an intermediate bitmap, and without needing to initialize any pixels beforehand. A span is represented by the struct `muttRSpan`, which has the following members:
+
+						struct muttRSpan {
+							// @DOCLINE * `@NLFT x0` - the x-coordinate of the first pixel of the span, in pixels.
+							uint32_m x0;
+							// @DOCLINE * `@NLFT x1` - the x-coordinate of the pixel after the last pixel of the span, in pixels; always greater than `x0`.
+							uint32_m x1;
+							// @DOCLINE * `@NLFT y` - the y-coordinate of the row of the span, in pixels, with 0 being the top row (the same row order as a bitmap).
+							uint32_m y;
+							// @DOCLINE * `@NLFT coverage` - how much each pixel of the span is inside of the glyph, from 1 (barely inside) to 255 (fully inside).
+							uint8_m coverage;
+						};
+						typedef struct muttRSpan muttRSpan;
+
+						// @DOCLINE The coverage of each span is the value that the pixels would have if the glyph were rasterized to a bitmap with the channels `MUTTR_R` and the in/out color `MUTTR_BW`. Pixels that are fully outside of the glyph aren't given a span.
+
+						// @DOCLINE Where the spans go is given by the struct `muttRSpans`, which has the following members:
+
+						struct muttRSpans {
+							// @DOCLINE * `@NLFT callback` - a function called for each span, with `user` and a pointer to the span, which is only valid for the duration of the call. If this is 0, the spans are written to `spans` instead.
+							void (*callback)(void* user, muttRSpan* span);
+							// @DOCLINE * `@NLFT* user` - a pointer given to `callback`.
+							void* user;
+							// @DOCLINE * `@NLFT* spans` - the buffer that the spans are written to if `callback` is 0.
+							muttRSpan* spans;
+							// @DOCLINE * `@NLFT capacity` - the amount of spans that `spans` can hold.
+							uint32_m capacity;
+							// @DOCLINE * `@NLFT count` - the amount of spans output by rasterization; filled in by the rasterization call.
+							uint32_m count;
+						};
+						typedef struct muttRSpans muttRSpans;
+
+						// @DOCLINE The function `mutt_raster_glyph_spans` rasterizes a glyph to spans, defined below: @NLNT
+						MUDEF muttResult mutt_raster_glyph_spans(muttRGlyph* glyph, uint32_m width, uint32_m height, muttRMethod method, muttRInfo* info, muttRSpans* spans);
+
+						// @DOCLINE `width` and `height` are the dimensions of the area being rasterized, which should be calculated the same way as for a bitmap; no span is given outside of them. The spans are given row by row from the bottom row to the top row, and from left to right within each row, with no spans overlapping. Only the full-pixel bi-level, anti-aliased, and area coverage methods can be used, with `MUTT_UNSUPPORTED_SPAN_METHOD` returned for any other known method. The same scratch memory is needed as for rasterizing to a bitmap of the given dimensions with `MUTTR_R` (see `mutt_raster_glyph_scratch`).
+
+						// @DOCLINE If `callback` is 0 and more spans were output than `capacity`, only the first `capacity` spans are written, `count` is still set to the total amount of spans, and the non-fatal result `MUTT_RASTER_SPANS_FULL` is returned; the call can then be repeated with a buffer that holds at least `count` spans.
+
 					// @DOCLINE ### Raster method
 
 						// @DOCLINE The type `muttRMethod` (typedef for `uint16_m`) represents what rasterization method to use when rasterizing a glyph. It has the following defined values:
@@ -5106,6 +5577,16 @@ All mu libraries included in muSDK have name functions to convert some of their
 						#define MUTTR_FULL_PIXEL_AA4X4 0x0002
 						// @DOCLINE * [0x0003] `MUTTR_FULL_PIXEL_AA8X8` - [full-pixel](#full-pixel) eight-by-eight [anti-aliased](#anti-aliasing) rasterization.
 						#define MUTTR_FULL_PIXEL_AA8X8 0x0003
+						// @DOCLINE * [0x0004] `MUTTR_FULL_PIXEL_AREA` - [full-pixel](#full-pixel) [area coverage](#area-coverage) rasterization.
+						#define MUTTR_FULL_PIXEL_AREA 0x0004
+						// @DOCLINE * [0x0005] `MUTTR_SDF` - [signed distance field](#signed-distance-fields) generation.
+						#define MUTTR_SDF 0x0005
+						// @DOCLINE * [0x0006] `MUTTR_MSDF` - [multi-channel signed distance field](#multi-channel-signed-distance-fields) generation.
+						#define MUTTR_MSDF 0x0006
+						// @DOCLINE * [0x0007] `MUTTR_LCD_RGB` - [LCD subpixel](#lcd-subpixel-rendering) rasterization for displays whose subpixels are ordered red, green, blue from left to right.
+						#define MUTTR_LCD_RGB 0x0007
+						// @DOCLINE * [0x0008] `MUTTR_LCD_BGR` - [LCD subpixel](#lcd-subpixel-rendering) rasterization for displays whose subpixels are ordered blue, green, red from left to right.
+						#define MUTTR_LCD_BGR 0x0008
 
 						// @DOCLINE Most of the terms used to describe these rendering methods are taken from terms used in [The Raster Tragedy](http://rastertragedy.com).
 
@@ -5123,6 +5604,42 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 						// @DOCLINE The amount of samples per pixel in the x- and y-direction is controlled by its dimensions, splitting up the pixel into multiple sub-pixels to then be individually calculated. For example, two-by-two anti-aliasing implies taking two samples on the x- and y-axis per pixel, so the top-leftest pixel (coordinates (0.5, 0.5)) would be split up into coordinates (0.25, 0.25), (0.75, 0.25), (0.25, 0.75), and (0.75, 0.75), in no particular order, and individually calculated & averaged for the final pixel value.
 
+						// @DOCLINE For the full-pixel methods, each row of pixels is only calculated between the first and last edge of the glyph within it; the pixels before that range and past it are filled in bulk, and rows without any edges are filled entirely at once. This means that the cost of rasterizing a glyph depends mostly on its outline rather than on the size of the bitmap it's rasterized into.
+
+					// @DOCLINE ### Area coverage
+
+						// @DOCLINE Area coverage rasterization calculates the exact area of each pixel that is inside of the glyph, rather than approximating it with samples like [anti-aliasing](#anti-aliasing) does. This is done by accumulating the signed area that each line of the glyph covers in each pixel, and then summing these values across each row of pixels. The result is generally higher quality than eight-by-eight anti-aliasing while usually being faster than all anti-aliased methods, since each line only needs to be processed once.
+
+						// @DOCLINE Because the area of overlapping contours is summed and clamped rather than checked with the non-zero winding number rule per sample, pixels where contours of opposite direction overlap only partially can be slightly lighter than they would be with other methods.
+
+					// @DOCLINE ### Signed distance fields
+
+						// @DOCLINE A signed distance field (SDF) stores, for the center of each pixel, the distance to the closest point on the outline of the glyph, being more inside the further inside the glyph the pixel is, and vice versa. The distance is calculated exactly from each line and Bezier of the glyph, rather than the lines used to approximate curves in other methods. Because the outline can be reconstructed by bilinearly sampling the field and thresholding it at the halfway value, one small SDF can be rendered at many sizes, making it well-suited for glyphs in a texture atlas that are scaled.
+
+						// @DOCLINE The value of each pixel is the halfway value offset by the distance divided by twice the [SDF range](#raster-info), clamped; a pixel that is the SDF range or further inside of the glyph is fully inside, and vice versa. Whether or not a pixel is inside of the glyph is determined with the non-zero winding number rule, like other methods.
+
+						// @DOCLINE Since the field extends past the outline, the bitmap should be larger than the glyph by at least the SDF range on every side, with the points of the rglyph offset by it, so that the field isn't cut off.
+
+					// @DOCLINE ### Multi-channel signed distance fields
+
+						// @DOCLINE A multi-channel signed distance field (MSDF) is a variation of an SDF that keeps sharp corners when scaled up, which a regular SDF rounds off. Each line/Bezier of a contour is assigned to two or three of the red, green, and blue channels such that the lines/Beziers on both sides of a corner only share one channel, and each channel stores the signed [pseudo-distance](https://github.com/Chlumsky/msdfgen) to the closest line/Bezier assigned to it. The outline is then reconstructed by thresholding the median of the three channels.
+
+						// @DOCLINE With `MUTTR_RGBA`, the alpha channel stores the regular SDF. With `MUTTR_R`, the regular SDF is generated instead. The sign of each channel is determined from the direction of the line/Bezier, assuming that outer contours go clockwise, as required by TrueType; glyphs with overlapping or wrongly-directed contours may have artifacts.
+
+					// @DOCLINE ### LCD subpixel rendering
+
+						// @DOCLINE LCD subpixel rendering makes use of each pixel of an LCD being made up of three horizontally-arranged subpixels of different colors, treating them as three separate samples to triple the horizontal resolution of the glyph. The [area coverage](#area-coverage) of each subpixel is calculated, and a FIR filter (set by `lcd_filter` in [raster info](#raster-info)) is then run over the row of subpixels to reduce color fringing, giving each channel of a pixel its own coverage value. This makes small text noticeably sharper horizontally without rasterizing it at a larger size.
+
+						// @DOCLINE Since each channel holds a different value, this method is meant to be used with `MUTTR_RGB` or `MUTTR_RGBA`, and the result should be blended per channel (rather than through a single alpha value) onto a surface that's shown on a display with the matching subpixel order. With `MUTTR_RGBA`, the alpha channel holds the highest coverage value of the three channels. With `MUTTR_R`, the single channel holds the average of the three, which is just a horizontally-filtered area coverage.
+
+						// @DOCLINE The filter spreads coverage at most two subpixels to the left and right, which is less than a pixel, so the usual 1-pixel offset for [bleeding](#raster-bleeding) is enough to keep it within the bitmap.
+
+					// @DOCLINE ### Fixed-point rasterization
+
+						// @DOCLINE By default, rasterization is calculated with floating-point math, whose results can differ slightly between compilers, compiler settings, and CPUs (such as from fused multiply-adds), and which is slow on CPUs without a strong FPU. With `fixed` set in [raster info](#raster-info), the full-pixel bi-level, anti-aliased, and area coverage methods instead convert each point of the rglyph to 24.8 fixed-point (a precision of 1/256 of a pixel) and do all further work, including splitting curves into lines, with integer math. For the same rglyph and arguments, the resulting bitmap is then the same bit-for-bit on any platform, which makes it usable for comparing against reference images and as the key of a cache.
+
+						// @DOCLINE The fixed-point versions of these methods follow the same rules as their floating-point counterparts, but a line is only considered to be crossed by a horizontal ray if the ray is at or above its bottom point and below its top point, which counts each point where two lines meet exactly once without any need for epsilons. Because of this and the rounding of points, the results can differ from floating-point rasterization by a pixel value here and there. Coordinates must be within about 4,000,000 pixels from 0.
+
 					// @DOCLINE ### Raster bleeding
 
 						// @DOCLINE Some rasterization methods have a possibility of setting pixels as (at least partially) inside of the glyph that aren't mathematically inside of the glyph to any degree, but are one pixel away from another pixel that *is* (at least partially) inside of the glyph. This effect is called "bleeding", and can cause pixels to be inside of the glyph that are outside of the range of the glyph's coordinates.
@@ -5160,6 +5677,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 							// @DOCLINE The maximum amount of memory that will be needed for converting a simple glyph to a raster glyph for a given font, in bytes, is provided by the function `mutt_simple_rglyph_max`, defined below: @NLNT
 							MUDEF uint32_m mutt_simple_rglyph_max(muttFont* font);
 
+						// @DOCLINE #### Simple glyph to rglyph with subpixel offset
+
+							// @DOCLINE The function `mutt_simple_rglyph_subpixel` converts a simple glyph to an rglyph with a [subpixel offset](#subpixel-positioning), defined below: @NLNT
+							MUDEF muttResult mutt_simple_rglyph_subpixel(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_x, float subpixel_y, muByte* data, uint32_m* written);
+
+							// @DOCLINE This function works exactly like `mutt_simple_rglyph`, which is equivalent to calling this function with `subpixel_x` and `subpixel_y` set to 0.
+
 					// @DOCLINE ### Composite glyph to rglyph
 
 						// @DOCLINE The function `mutt_composite_rglyph` converts a composite glyph to an rglyph, defined below: @NLNT
@@ -5178,6 +5702,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 							// @DOCLINE The maximum amount of memory that will be needed for converting a composite glyph to a raster glyph for a given font, in bytes, is provided by the function `mutt_composite_rglyph_max`, defined below: @NLNT
 							MUDEF uint32_m mutt_composite_rglyph_max(muttFont* font);
 
+						// @DOCLINE #### Composite glyph to rglyph with subpixel offset
+
+							// @DOCLINE The function `mutt_composite_rglyph_subpixel` converts a composite glyph to an rglyph with a [subpixel offset](#subpixel-positioning), defined below: @NLNT
+							MUDEF muttResult mutt_composite_rglyph_subpixel(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_x, float subpixel_y, muByte* data);
+
+							// @DOCLINE This function works exactly like `mutt_composite_rglyph`, which is equivalent to calling this function with `subpixel_x` and `subpixel_y` set to 0.
+
 					// @DOCLINE ### Glyph header to rglyph
 
 						// @DOCLINE The function `mutt_header_rglyph` converts a glyph header to a glyph, defined below: @NLNT
@@ -5196,6 +5727,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 							// @DOCLINE This function rather returns (the sum of `mutt_simple_glyph_max_size` and `mutt_simple_rglyph_max`) or (the sum of `mutt_composite_glyph_max_size` and `mutt_composite_rglyph_max`), whichever is greater. All the table loading requirements of these functions apply.
 
+						// @DOCLINE #### Glyph header to rglyph with subpixel offset
+
+							// @DOCLINE The function `mutt_header_rglyph_subpixel` converts a glyph header to an rglyph with a [subpixel offset](#subpixel-positioning), defined below: @NLNT
+							MUDEF muttResult mutt_header_rglyph_subpixel(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_x, float subpixel_y, muByte* data, uint32_m* written);
+
+							// @DOCLINE This function works exactly like `mutt_header_rglyph`, which is equivalent to calling this function with `subpixel_x` and `subpixel_y` set to 0. A glyph in the [outline cache](#outline-cache) is cached in FUnits, so it can be converted at any subpixel offset.
+
 					// @DOCLINE ### TrueType metrics to rglyph metrics
 
 						// @DOCLINE The function `mutt_rglyph_metrics` fills in the metric information about a TrueType-to-rglyph conversion, converting the TrueType glyph's metrics to the pixel-unit equivalents for the rglyph, defined below: @NLNT
@@ -5203,6 +5741,18 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 						// @DOCLINE The values `rglyph->ascender`, `rglyph->descender`, `rglyph->lsb`, and `rglyph->advance_width` are filled in. `glyph_id` must be a valid glyph ID. The x/y min/max values within `header` must be accurate.
 
+						// @DOCLINE The metrics of an rglyph converted with a [subpixel offset](#subpixel-positioning) are filled in with the function `mutt_rglyph_metrics_subpixel`, defined below: @NLNT
+						MUDEF void mutt_rglyph_metrics_subpixel(muttFont* font, muttGlyphHeader* header, uint16_m glyph_id, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_y);
+
+						// @DOCLINE `subpixel_y` must be the y-offset that the rglyph was converted with; the ascender and descender are moved by it. The horizontal metrics don't depend on the offset, so there is no x-offset parameter. `mutt_rglyph_metrics` is equivalent to calling this function with `subpixel_y` set to 0.
+
+					// @DOCLINE ### Bulk advances
+
+						// @DOCLINE The function `mutt_glyph_advances` retrieves the advance widths and left-side bearings of several glyphs at once, in pixel units, defined below: @NLNT
+						MUDEF void mutt_glyph_advances(muttFont* font, uint16_m* glyph_ids, uint32_m count, float point_size, float ppi, float* advances, float* lsbs);
+
+						// @DOCLINE `advances` and `lsbs` must be arrays of length `count`, and are filled with the advance width and left-side bearing of each glyph in `glyph_ids`, which must all be valid glyph IDs. `lsbs` can be 0 if left-side bearings aren't needed. The values given are the same as the ones given by [`mutt_rglyph_metrics`](#truetype-metrics-to-rglyph-metrics), but no glyph header is needed, and the conversion from FUnits is performed on several values at once with [SIMD](#simd) if available. The head, hhea, and hmtx tables must be loaded.
+
 					// @DOCLINE ### TrueType x/y min/max to rglyph x/y max
 
 						// @DOCLINE The function `mutt_funits_punits_min_max` converts a set of x/y min/max values, in FUnits (usually retrieved from loading a simple/composite glyph, with said values being stored in the header), to what an rglyph's x/y maximum values will be when converting it to an rglyph, defined below: @NLNT
@@ -5214,114 +5764,480 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 						// @DOCLINE * If the glyph is composite and it has been loaded, both in header form and in `muttCompositeGlyph` form, the x/y min/max values still haven't been validated, since `mutt_composite_glyph` does not check coordinate values; the assuredly correct x/y min/max values for a composite glyph can be retrieved with the function [`mutt_composite_glyph_min_max`](#composite-min-max).
 
-			// @DOCLINE # Result
+						// @DOCLINE The x/y max values of an rglyph converted with a [subpixel offset](#subpixel-positioning) are calculated with the function `mutt_funits_punits_min_max_subpixel`, defined below: @NLNT
+						MUDEF void mutt_funits_punits_min_max_subpixel(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_x, float subpixel_y);
 
-				// @DOCLINE The type `muttResult` (typedef for `uint32_m`) is defined to represent how a task went. Result values can be "fatal" (meaning that the task completely failed to execute, and the program will continue as if the task had never been attempted), "non-fatal" (meaning that the task partially failed, but was still able to complete the task), and "successful" (meaning that the task fully succeeded).
+						// @DOCLINE `mutt_funits_punits_min_max` is equivalent to calling this function with `subpixel_x` and `subpixel_y` set to 0.
 
-				// @DOCLINE ## Result values
+					// @DOCLINE ### Subpixel positioning
 
-				// @DOCLINE The following values are defined for `muttResult` (all values not explicitly stated as being fatal, non-fatal, or successful are assumed to be fatal):
+						// @DOCLINE When converting a TrueType glyph to an rglyph, its coordinates are offset so that its x/y minimum lands exactly 1 pixel from the left/bottom of the bitmap (to account for [bleeding](#raster-bleeding)). On its own, this means that a glyph can only be drawn at whole-pixel positions, and laying out text rounds the position of each glyph, with the rounding error building up across a line of text.
 
-				// @DOCLINE ### General result values
-				// 0 -> 63 //
+						// @DOCLINE The "subpixel" variants of the conversion functions take an extra x- and y-offset (`subpixel_x` and `subpixel_y`), in pixels, that is added to the coordinates of the glyph, moving it right and up within the bitmap. These offsets should be within the range [0, 1), with the whole-pixel part of the glyph's position being handled by where the bitmap is placed; `x_max` and `y_max` grow by the offsets, so the bitmap's dimensions should be calculated from them as usual.
 
-					// @DOCLINE * `MUTT_SUCCESS` - the task was successfully completed; real value 0.
-					#define MUTT_SUCCESS 0
-					// @DOCLINE * `MUTT_FAILED_MALLOC` - a call to malloc failed, implying insufficient available memory to perform the task.
-					#define MUTT_FAILED_MALLOC 1
-					// @DCOLINE * `MUTT_FAILED_REALLOC` - a call to realloc failed, implying insufficient available memory to perform the task.
-					#define MUTT_FAILED_REALLOC 2
-					// @DOCLINE * `MUTT_FAILED_FIND_TABLE` - the table could not be located, and is likely not included in the font file.
-					#define MUTT_FAILED_FIND_TABLE 3
+						// @DOCLINE Since every different offset needs its own rasterization, offsets are usually quantized to a few steps per pixel so that rasterized glyphs can be cached and reused. The function `mutt_subpixel_split` splits a position into a whole-pixel part and a quantized subpixel offset, defined below: @NLNT
+						MUDEF float mutt_subpixel_split(float position, uint8_m steps, int32_m* whole);
 
-				// @DOCLINE ### Directory result values
-				// 64 -> 127 //
+						// @DOCLINE `position` is rounded to the nearest multiple of `1/steps`, `whole` is set to the floor of the result, and the remaining fraction (a multiple of `1/steps` within the range [0, 1)) is returned, to be given as the subpixel offset. `steps` being 0 is treated as 1. The macro `MUTT_SUBPIXEL_STEPS` is a recommended amount of steps, defined below: @NLNT
+						#define MUTT_SUBPIXEL_STEPS 4
 
-					// @DOCLINE * `MUTT_INVALID_DIRECTORY_LENGTH` - the length of the table directory was invalid. This is the first check performed on the length of the font file data, meaning that if this result is given, it is likely that the data given is not font file data.
-					#define MUTT_INVALID_DIRECTORY_LENGTH 64
-					// @DOCLINE * `MUTT_INVALID_DIRECTORY_SFNT_VERSION` - the value of "sfntVersion" in the table directory was invalid/unsupported. This is the first check performed on the values within the font file data, meaning that if this result is given, it is likely that the data given is not TrueType font file data. This can also be triggered by the TrueType font using CFF data, which is currently unsupported.
-					#define MUTT_INVALID_DIRECTORY_SFNT_VERSION 65
-					// @DOCLINE * `MUTT_INVALID_DIRECTORY_NUM_TABLES` - the value of "numTables" in the table directory was invalid; the number of tables must be at least 9 to store all tables required in TrueType.
-					#define MUTT_INVALID_DIRECTORY_NUM_TABLES 66
-					// @DOCLINE * `MUTT_INVALID_DIRECTORY_RECORD_OFFSET` - the value of "offset" in a table record within the table directory was out of range.
-					#define MUTT_INVALID_DIRECTORY_RECORD_OFFSET 67
-					// @DOCLINE * `MUTT_INVALID_DIRECTORY_RECORD_LENGTH` - the value of "length" in a table record within the table directory was out of range.
-					#define MUTT_INVALID_DIRECTORY_RECORD_LENGTH 68
-					// @DOCLINE * `MUTT_INVALID_DIRECTORY_RECORD_CHECKSUM` - the value of "checksum" in a table record within the table directory was invalid, implying that the table data was incorrect.
-					#define MUTT_INVALID_DIRECTORY_RECORD_CHECKSUM 69
-					// @DOCLINE * `MUTT_INVALID_DIRECTORY_RECORD_TABLE_TAG` - the table tag of a table within the table directory was a duplicate of a previous one.
-					#define MUTT_INVALID_DIRECTORY_RECORD_TABLE_TAG 70
-					// @DOCLINE * `MUTT_MISSING_DIRECTORY_RECORD_TABLE_TAGS` - one or more tables required by TrueType standards could not be found in the table directory.
-					#define MUTT_MISSING_DIRECTORY_RECORD_TABLE_TAGS 71
+						// @DOCLINE The index of the quantized offset (the returned value multiplied by `steps`) can be used as part of a key for caching rasterized glyphs.
 
-				// @DOCLINE ### Maxp result values
-				// 128 -> 191 //
+				// @DOCLINE ## Outline cache
 
-					// @DOCLINE * `MUTT_INVALID_MAXP_LENGTH` - the length of the maxp table was invalid.
-					#define MUTT_INVALID_MAXP_LENGTH 128
-					// @DOCLINE * `MUTT_INVALID_MAXP_VERSION` - the version of the maxp table given was invalid/unsupported. This likely means that the font has a CFF/CFF2 font outline, which is currently unsupported.
-					#define MUTT_INVALID_MAXP_VERSION 129
-					// @DOCLINE * `MUTT_INVALID_MAXP_NUM_GLYPHS` - the value for "numGlyphs" given in the maxp table was invalid.
-					#define MUTT_INVALID_MAXP_NUM_GLYPHS 130
-					// @DOCLINE * `MUTT_INVALID_MAXP_MAX_ZONES` - the value for "maxZones" given in the maxp table was invalid.
-					#define MUTT_INVALID_MAXP_MAX_ZONES 131
+					typedef struct muttOutlineCacheStats muttOutlineCacheStats;
 
-				// @DOCLINE ### Head result values
-				// 192 -> 255 //
+					// @DOCLINE Converting a glyph header to an rglyph involves decoding the glyph's outline from the glyf table every time, which for composite glyphs means decoding every one of its components as well. A font can optionally be given an outline cache, which holds the decoded outlines of recently-converted glyphs in font units, keyed by glyph ID, so that converting the same glyph again (at any point size and PPI) skips decoding it entirely.
 
-					// @DOCLINE * `MUTT_INVALID_HEAD_LENGTH` - the length of the head table was invalid.
-					#define MUTT_INVALID_HEAD_LENGTH 192
-					// @DOCLINE * `MUTT_INVALID_HEAD_VERSION` - the version indicated for the head table was invalid/unsupported.
-					#define MUTT_INVALID_HEAD_VERSION 193
-					// @DOCLINE * `MUTT_INVALID_HEAD_MAGIC_NUMBER` - the value for the magic number in the head table was invalid.
-					#define MUTT_INVALID_HEAD_MAGIC_NUMBER 194
-					// @DOCLINE * `MUTT_INVALID_HEAD_UNITS_PER_EM` - the value for the units per em in the head table was not within the correct range of 16 to 16384.
-					#define MUTT_INVALID_HEAD_UNITS_PER_EM 195
-					// @DOCLINE * `MUTT_INVALID_HEAD_X_MIN_COORDINATES` - the value "xMin" in the head table was not within the valid TrueType grid coordinate range of -16384 to 16383.
-					#define MUTT_INVALID_HEAD_X_MIN_COORDINATES 196
-					// @DOCLINE * `MUTT_INVALID_HEAD_Y_MIN_COORDINATES` - the value "yMin" in the head table was not within the valid TrueType grid coordinate range of -16384 to 16383.
-					#define MUTT_INVALID_HEAD_Y_MIN_COORDINATES 197
-					// @DOCLINE * `MUTT_INVALID_HEAD_X_MAX_COORDINATES` - the value "xMax" in the head table was not within the valid TrueType grid coordinate range of -16384 to 16383.
-					#define MUTT_INVALID_HEAD_X_MAX_COORDINATES 198
-					// @DOCLINE * `MUTT_INVALID_HEAD_Y_MAX_COORDINATES` - the value "yMax" in the head table was not within the valid TrueType grid coordinate range of -16384 to 16383.
-					#define MUTT_INVALID_HEAD_Y_MAX_COORDINATES 199
-					// @DOCLINE * `MUTT_INVALID_HEAD_X_MIN_MAX` - the value established minimum x-value within the head table was greater than the established maximum x-value.
-					#define MUTT_INVALID_HEAD_X_MIN_MAX 200
-					// @DOCLINE * `MUTT_INVALID_HEAD_Y_MIN_MAX` - the value established minimum y-value within the head table was greater than the established maximum y-value.
-					#define MUTT_INVALID_HEAD_Y_MIN_MAX 201
-					// @DOCLINE * `MUTT_INVALID_HEAD_INDEX_TO_LOC_FORMAT` - the value for "indexToLocFormat" within the head table was invalid/unsupported; it was not one of the expected values 0 (Offset16) or 1 (Offset32).
-					#define MUTT_INVALID_HEAD_INDEX_TO_LOC_FORMAT 202
-					// @DOCLINE * `MUTT_INVALID_HEAD_GLYPH_DATA_FORMAT` - the value for "glyphDataFormat" within the head table was invalid/unsupported; it was not the expected value 0.
-					#define MUTT_INVALID_HEAD_GLYPH_DATA_FORMAT 203
+					// @DOCLINE The function `mutt_outline_cache_create` gives a font an outline cache, defined below: @NLNT
+					MUDEF muttResult mutt_outline_cache_create(muttFont* font, uint32_m budget);
 
-				// @DOCLINE ### Hhea result values
-				// 256 -> 319 //
+					// @DOCLINE `budget` is the maximum amount of memory, in bytes, that the cached outlines can take up; once adding an outline would go over it, the least-recently-used outlines are removed until it fits, and outlines that are larger than the entire budget are never cached. The cache also allocates a lookup array of one pointer per glyph in the font, which isn't counted towards the budget. If the font already has an outline cache, it is destroyed first. The maxp table must be loaded.
 
-					// @DOCLINE * `MUTT_INVALID_HHEA_LENGTH` - the length of the hhea table was invalid.
-					#define MUTT_INVALID_HHEA_LENGTH 256
-					// @DOCLINE * `MUTT_INVALID_HHEA_VERSION` - the version indicated for the hhea table was invalid/unsupported.
-					#define MUTT_INVALID_HHEA_VERSION 257
-					// @DOCLINE * `MUTT_INVALID_HHEA_METRIC_DATA_FORMAT` - the value for "metricDataFormat" within the hhea table was invalid/unsupported; it was not the expected value 0.
-					#define MUTT_INVALID_HHEA_METRIC_DATA_FORMAT 258
-					// @DOCLINE * `MUTT_INVALID_HHEA_NUMBER_OF_HMETRICS` - the value for "numberOfHMetrics" within the hhea table was invalid; numberOfHMetrics must be less than or equal to "numGlyphs" in order to generate a valid array length for "leftSideBearings" within hmtx.
-					#define MUTT_INVALID_HHEA_NUMBER_OF_HMETRICS 259
-					// @DOCLINE * `MUTT_HHEA_REQUIRES_MAXP` - the maxp table rather failed to load or was not requested for loading, and hhea requires maxp to be loaded.
-					#define MUTT_HHEA_REQUIRES_MAXP 260
+					// @DOCLINE Once created, the cache is used automatically by [`mutt_header_rglyph`](#glyph-header-to-rglyph), and thus by [batch rasterization](#batch-rasterization) and the [atlas API](#atlas-api); a cached glyph is only used if its header's `glyph_id` and `data` members match the ones it was cached with. Access to the cache is guarded by a lock (unless `MUTT_NO_THREADS` is defined), so it can be used by several threads at once. The cache is destroyed automatically by `mutt_deload`, and can be destroyed beforehand with the function `mutt_outline_cache_destroy`, defined below: @NLNT
+					MUDEF void mutt_outline_cache_destroy(muttFont* font);
 
-				// @DOCLINE ### Hmtx result values
-				// 320 -> 383 //
+					// @DOCLINE ### Outline cache statistics
 
-					// @DOCLINE * `MUTT_INVALID_HMTX_LENGTH` - the length of the hmtx table was invalid.
-					#define MUTT_INVALID_HMTX_LENGTH 320
-					// @DOCLINE * `MUTT_HMTX_REQUIRES_MAXP` - the maxp table rather failed to load or was not requested for loading, and hmtx requires maxp to be loaded.
-					#define MUTT_HMTX_REQUIRES_MAXP 321
-					// @DOCLINE * `MUTT_HMTX_REQUIRES_HHEA` - the hhea table rather failed to load or was not requested for loading, and hmtx requires hhea to be loaded.
-					#define MUTT_HMTX_REQUIRES_HHEA 322
+						// @DOCLINE The function `mutt_outline_cache_stats` retrieves statistics about a font's outline cache, defined below: @NLNT
+						MUDEF void mutt_outline_cache_stats(muttFont* font, muttOutlineCacheStats* stats);
 
-				// @DOCLINE ### Loca result values
-				// 384 -> 447 //
+						// @DOCLINE The statistics are represented by the struct `muttOutlineCacheStats`, which has the following members:
 
-					// @DOCLINE * `MUTT_INVALID_LOCA_LENGTH` - the length of the loca table was invalid.
+						struct muttOutlineCacheStats {
+							// @DOCLINE * `@NLFT hits` - the amount of conversions that used a cached outline.
+							uint64_m hits;
+							// @DOCLINE * `@NLFT misses` - the amount of conversions that had to decode the outline.
+							uint64_m misses;
+							// @DOCLINE * `@NLFT evictions` - the amount of outlines removed to stay within the budget.
+							uint64_m evictions;
+							// @DOCLINE * `@NLFT entries` - the amount of outlines currently cached.
+							uint32_m entries;
+							// @DOCLINE * `@NLFT memory` - the amount of memory currently taken up by the cached outlines, in bytes.
+							uint32_m memory;
+							// @DOCLINE * `@NLFT budget` - the budget given when the cache was created.
+							uint32_m budget;
+						};
+
+						// @DOCLINE If the font has no outline cache, all members of `stats` are set to 0.
+
+				// @DOCLINE ## Batch rasterization
+
+					typedef struct muttRJob muttRJob;
+
+					// @DOCLINE Several TrueType glyphs can be converted and rasterized at once across multiple threads with the function `mutt_raster_glyphs`, defined below: @NLNT
+					MUDEF muttResult mutt_raster_glyphs(muttFont* font, muttRJob* jobs, uint32_m job_count, muttRMethod method, muttRInfo* info, uint32_m thread_count);
+
+					// @DOCLINE Each job is represented by the struct `muttRJob`, which has the following members:
+
+					struct muttRJob {
+						// @DOCLINE * `@NLFT glyph_id` - the glyph ID of the glyph to rasterize. This must be a valid glyph ID.
+						uint16_m glyph_id;
+						// @DOCLINE * `@NLFT point_size` - the [point size](#font-units-to-pixel-units) to rasterize the glyph at.
+						float point_size;
+						// @DOCLINE * `@NLFT ppi` - the [PPI](#font-units-to-pixel-units) to rasterize the glyph at.
+						float ppi;
+						// @DOCLINE * `@NLFT* bitmap` - the bitmap to rasterize the glyph onto. Its dimensions can be calculated with [`mutt_funits_punits_min_max`](#truetype-x-y-min-max-to-rglyph-x-y-max) before the call.
+						muttRBitmap* bitmap;
+						// @DOCLINE * `@NLFT result` - the result of the job, filled in by `mutt_raster_glyphs`.
+						muttResult result;
+					};
+
+					// @DOCLINE For each job, the glyph's header is retrieved, converted to an rglyph with [`mutt_header_rglyph`](#glyph-header-to-rglyph), and rasterized onto `bitmap` with `method` and `info`; glyphs with no contours leave the bitmap unmodified. The result of each job is stored in its `result` member, and a fatal result for one job does not stop the others.
+
+					// @DOCLINE The jobs are split across `thread_count` threads, each of which uses its own memory and [scratch](#raster-scratch), so `info->scratch` is ignored; all threads only read from `font`. A `thread_count` of 0 or 1 performs all jobs on the calling thread. Threads are created with the Win32 API on Windows and with POSIX threads elsewhere (which may need to be linked, such as with `-lpthread`), and if thread creation fails, the affected jobs are performed on the calling thread. Defining `MUTT_NO_THREADS` before the implementation of mutt makes all jobs always be performed on the calling thread.
+
+					// @DOCLINE The threads are created and joined within each call, which costs about as much as rasterizing a few small glyphs, so `mutt_raster_glyphs` is only worth calling with multiple threads for large batches, such as all of the glyphs of a font at once, rather than for a few glyphs at a time. Because of this, fewer threads than `thread_count` are used if needed so that each thread performs at least `MUTT_BATCH_MIN_JOBS` jobs, defined below: @NLNT
+					#ifndef MUTT_BATCH_MIN_JOBS
+						#define MUTT_BATCH_MIN_JOBS 16
+					#endif
+
+					// @DOCLINE This macro can be defined before the inclusion of mutt to change it, and must be at least 1. A batch of fewer than `2*MUTT_BATCH_MIN_JOBS` jobs is performed entirely on the calling thread.
+
+					// @DOCLINE A fatal result is only returned by `mutt_raster_glyphs` itself if memory needed for the threads couldn't be allocated, in which case no jobs were performed. The tables required for `mutt_header_rglyph` and `mutt_glyph_header` must be loaded.
+
+			// @DOCLINE # Atlas API
+
+				// @DOCLINE The atlas API is built on top of the [raster API](#raster-api), and has the ability to rasterize TrueType glyphs at a given size and pack them into one or more fixed-size bitmaps, called "pages", which can then be uploaded as textures. Glyphs can be added to an atlas at any time, so that the atlas can grow as new glyphs are needed.
+
+				// @DOCLINE ## Atlas struct
+
+					typedef struct muttAtlasInfo muttAtlasInfo;
+					typedef struct muttAtlasPage muttAtlasPage;
+					typedef struct muttAtlasGlyph muttAtlasGlyph;
+					typedef struct muttAtlas muttAtlas;
+
+					// @DOCLINE The settings of an atlas are given by the struct `muttAtlasInfo`, which has the following members:
+
+					struct muttAtlasInfo {
+						// @DOCLINE * `@NLFT page_width` - the width of each page, in pixels.
+						uint32_m page_width;
+						// @DOCLINE * `@NLFT page_height` - the height of each page, in pixels.
+						uint32_m page_height;
+						// @DOCLINE * `@NLFT channels` - the [channels](#raster-channels) of each page.
+						muttRChannels channels;
+						// @DOCLINE * `@NLFT io_color` - the [in/out color](#raster-in-out-color) of each page.
+						muttRIOColor io_color;
+						// @DOCLINE * `@NLFT method` - the [raster method](#raster-method) used to rasterize each glyph.
+						muttRMethod method;
+						// @DOCLINE * `@NLFT point_size` - the [point size](#font-units-to-pixel-units) that each glyph is rasterized at.
+						float point_size;
+						// @DOCLINE * `@NLFT ppi` - the [PPI](#font-units-to-pixel-units) that each glyph is rasterized at.
+						float ppi;
+						// @DOCLINE * `@NLFT padding` - the amount of pixels left empty between each glyph on a page.
+						uint32_m padding;
+					};
+
+					// @DOCLINE An atlas is represented by the struct `muttAtlas`, which has the following members:
+
+					struct muttAtlas {
+						// @DOCLINE * `@NLFT info` - the settings of the atlas.
+						muttAtlasInfo info;
+						// @DOCLINE * `@NLFT* font` - the font that glyphs are rasterized from.
+						muttFont* font;
+						// @DOCLINE * `@NLFT num_pages` - the number of pages.
+						uint32_m num_pages;
+						// @DOCLINE * `@NLFT* pages` - each page.
+						muttAtlasPage* pages;
+						// @DOCLINE * `@NLFT num_glyphs` - the number of glyphs within the atlas.
+						uint32_m num_glyphs;
+						// @DOCLINE * `@NLFT* glyphs` - each glyph within the atlas.
+						muttAtlasGlyph* glyphs;
+						// @DOCLINE * `@NLFT* lookup` - for each glyph ID in the font, its index in `glyphs` plus 1, or 0 if it isn't in the atlas.
+						uint32_m* lookup;
+						// @DOCLINE * `@NLFT glyph_capacity` - the amount of glyphs that `glyphs` has room for.
+						uint32_m glyph_capacity;
+						// @DOCLINE * `@NLFT* rdata` - memory used for converting glyphs to rglyphs.
+						muByte* rdata;
+						// @DOCLINE * `@NLFT scratch` - the [scratch](#raster-scratch) used for rasterizing glyphs.
+						muttRScratch scratch;
+					};
+
+					// @DOCLINE A page is represented by the struct `muttAtlasPage`, which has the following members:
+
+					struct muttAtlasPage {
+						// @DOCLINE * `@NLFT* pixels` - the pixel data of the page, stored from left to right, top to bottom, with a stride of `page_width` times the amount of channels.
+						uint8_m* pixels;
+						// @DOCLINE * `@NLFT dirty` - whether or not the page has been modified; this is set to `MU_TRUE` by mutt when glyphs are added to the page, and is meant to be set back to `MU_FALSE` by the user once the page has been uploaded.
+						muBool dirty;
+						// @DOCLINE * `@NLFT num_nodes` - the number of skyline nodes.
+						uint32_m num_nodes;
+						// @DOCLINE * `@NLFT* nodes` - the skyline nodes, with 3 values per node: x-position, height, and width. This is used internally for packing.
+						uint32_m* nodes;
+					};
+
+					// @DOCLINE Each glyph within an atlas is represented by the struct `muttAtlasGlyph`, which has the following members:
+
+					struct muttAtlasGlyph {
+						// @DOCLINE * `@NLFT glyph_id` - the glyph ID.
+						uint16_m glyph_id;
+						// @DOCLINE * `@NLFT page` - the index of the page that the glyph is on.
+						uint32_m page;
+						// @DOCLINE * `@NLFT x` - the x-position of the left of the glyph's bitmap on the page, in pixels.
+						uint32_m x;
+						// @DOCLINE * `@NLFT y` - the y-position of the top of the glyph's bitmap on the page, in pixels.
+						uint32_m y;
+						// @DOCLINE * `@NLFT width` - the width of the glyph's bitmap, in pixels.
+						uint32_m width;
+						// @DOCLINE * `@NLFT height` - the height of the glyph's bitmap, in pixels.
+						uint32_m height;
+						// @DOCLINE * `@NLFT uv[4]` - the texture coordinates of the glyph's bitmap on the page, in the order of left, top, right, and bottom, ranging from 0 to 1.
+						float uv[4];
+						// @DOCLINE * `@NLFT x_max` - the maximum x-value of the glyph's rglyph.
+						float x_max;
+						// @DOCLINE * `@NLFT y_max` - the maximum y-value of the glyph's rglyph.
+						float y_max;
+						// @DOCLINE * `@NLFT ascender` - the ascender of the glyph, as given by `mutt_rglyph_metrics`.
+						float ascender;
+						// @DOCLINE * `@NLFT descender` - the descender of the glyph, as given by `mutt_rglyph_metrics`.
+						float descender;
+						// @DOCLINE * `@NLFT lsb` - the left-side bearing of the glyph, as given by `mutt_rglyph_metrics`.
+						float lsb;
+						// @DOCLINE * `@NLFT advance_width` - the advance width of the glyph, as given by `mutt_rglyph_metrics`.
+						float advance_width;
+					};
+
+					// @DOCLINE Glyphs with no contours (such as a space) are still added to the atlas for their metrics, but have a width and height of 0.
+
+				// @DOCLINE ## Create atlas
+
+					// @DOCLINE The function `mutt_atlas_create` creates an atlas for a font, defined below: @NLNT
+					MUDEF muttResult mutt_atlas_create(muttFont* font, muttAtlas* atlas, muttAtlasInfo* info);
+
+					// @DOCLINE The atlas starts with no pages or glyphs. The font must stay loaded for as long as the atlas exists, and the maxp, head, hhea, hmtx, loca, and glyf tables must be loaded.
+
+				// @DOCLINE ## Destroy atlas
+
+					// @DOCLINE The function `mutt_atlas_destroy` frees all memory used by an atlas, defined below: @NLNT
+					MUDEF void mutt_atlas_destroy(muttAtlas* atlas);
+
+				// @DOCLINE ## Add glyphs to atlas
+
+					// @DOCLINE The function `mutt_atlas_add_glyphs` rasterizes and packs glyphs into an atlas, defined below: @NLNT
+					MUDEF muttResult mutt_atlas_add_glyphs(muttAtlas* atlas, uint16_m* glyph_ids, uint32_m count);
+
+					// @DOCLINE Glyphs that are already within the atlas are skipped. The new glyphs are packed tallest-first with a skyline packer onto the first page that has room for them, and a new page is created if no page does. Each page that a glyph is added to is marked as dirty.
+
+					// @DOCLINE If a glyph fails to be added, it is skipped and the other glyphs are still added, and the result of the last glyph that failed is returned. Pointers into `glyphs` are invalidated by this function.
+
+					// @DOCLINE The function `mutt_atlas_add_codepoints` adds the glyphs for a range of codepoints to an atlas via `mutt_get_glyph`, defined below: @NLNT
+					MUDEF muttResult mutt_atlas_add_codepoints(muttAtlas* atlas, uint32_m first, uint32_m last);
+
+					// @DOCLINE All codepoints from `first` to `last` (inclusive) are added, which requires the cmap table to be loaded. Codepoints that don't have a glyph in the font add glyph 0 instead.
+
+				// @DOCLINE ## Get glyph from atlas
+
+					// @DOCLINE The function `mutt_atlas_get` retrieves a glyph within an atlas, defined below: @NLNT
+					MUDEF muttAtlasGlyph* mutt_atlas_get(muttAtlas* atlas, uint16_m glyph_id);
+
+					// @DOCLINE 0 is returned if the glyph isn't within the atlas. The pointer returned is invalidated when glyphs are added to the atlas.
+
+			// @DOCLINE # Bitmap cache API
+
+				// @DOCLINE The bitmap cache API is built on top of the [raster API](#raster-api), and holds individually-rasterized TrueType glyphs so that a glyph that's drawn repeatedly only needs to be rasterized once. Unlike an [atlas](#atlas-api), a bitmap cache isn't tied to one font or size, holds each glyph in its own bitmap, and has a memory budget that it stays within by evicting glyphs that haven't been used recently. A bitmap cache can be used by several threads at once.
+
+				// @DOCLINE ## Bitmap cache struct
+
+					typedef struct muttBitmapCacheInfo muttBitmapCacheInfo;
+					typedef struct muttBitmapCache muttBitmapCache;
+					typedef struct muttCachedGlyph muttCachedGlyph;
+					typedef struct muttBitmapCacheStats muttBitmapCacheStats;
+
+					// @DOCLINE The settings of a bitmap cache are given by the struct `muttBitmapCacheInfo`, which has the following members:
+
+					struct muttBitmapCacheInfo {
+						// @DOCLINE * `@NLFT budget` - the maximum amount of memory, in bytes, that the cached glyphs can take up.
+						uint32_m budget;
+						// @DOCLINE * `@NLFT channels` - the [channels](#raster-channels) of each glyph's bitmap.
+						muttRChannels channels;
+						// @DOCLINE * `@NLFT io_color` - the [in/out color](#raster-in-out-color) of each glyph's bitmap.
+						muttRIOColor io_color;
+						// @DOCLINE * `@NLFT subpixels` - the amount of horizontal subpixel positions that each glyph can be rasterized at; 0 or 1 means that glyphs are always rasterized at whole-pixel positions.
+						uint32_m subpixels;
+					};
+
+					// @DOCLINE A bitmap cache is represented by the struct `muttBitmapCache`, whose contents are internal to mutt.
+
+					// @DOCLINE Each glyph within a bitmap cache is represented by the struct `muttCachedGlyph`, which has the following members:
+
+					struct muttCachedGlyph {
+						// @DOCLINE * `@NLFT* font` - the font that the glyph was rasterized from.
+						muttFont* font;
+						// @DOCLINE * `@NLFT glyph_id` - the glyph ID.
+						uint16_m glyph_id;
+						// @DOCLINE * `@NLFT point_size` - the [point size](#font-units-to-pixel-units) that the glyph was rasterized at.
+						float point_size;
+						// @DOCLINE * `@NLFT ppi` - the [PPI](#font-units-to-pixel-units) that the glyph was rasterized at.
+						float ppi;
+						// @DOCLINE * `@NLFT method` - the [raster method](#raster-method) that the glyph was rasterized with.
+						muttRMethod method;
+						// @DOCLINE * `@NLFT subpixel` - the horizontal subpixel position that the glyph was rasterized at, from 0 to the cache's `subpixels` minus 1.
+						uint32_m subpixel;
+						// @DOCLINE * `@NLFT x_offset` - the horizontal offset, in pixels, that the glyph was rasterized at, being `subpixel` divided by the cache's `subpixels`.
+						float x_offset;
+						// @DOCLINE * `@NLFT bitmap` - the bitmap that the glyph was rasterized onto. Its pixels are owned by the cache.
+						muttRBitmap bitmap;
+						// @DOCLINE * `@NLFT x_max` - the maximum x-value of the glyph's rglyph, including `x_offset`.
+						float x_max;
+						// @DOCLINE * `@NLFT y_max` - the maximum y-value of the glyph's rglyph.
+						float y_max;
+						// @DOCLINE * `@NLFT ascender` - the ascender of the glyph, as given by `mutt_rglyph_metrics`.
+						float ascender;
+						// @DOCLINE * `@NLFT descender` - the descender of the glyph, as given by `mutt_rglyph_metrics`.
+						float descender;
+						// @DOCLINE * `@NLFT lsb` - the left-side bearing of the glyph, as given by `mutt_rglyph_metrics`.
+						float lsb;
+						// @DOCLINE * `@NLFT advance_width` - the advance width of the glyph, as given by `mutt_rglyph_metrics`.
+						float advance_width;
+						// @DOCLINE * `@NLFT result` - the result of rasterizing the glyph.
+						muttResult result;
+					};
+
+					// @DOCLINE Glyphs with no contours (such as a space) are still cached for their metrics, but have a bitmap width and height of 0 and no pixels.
+
+				// @DOCLINE ## Create bitmap cache
+
+					// @DOCLINE The function `mutt_bitmap_cache_create` creates a bitmap cache, defined below: @NLNT
+					MUDEF muttResult mutt_bitmap_cache_create(muttBitmapCacheInfo* info, muttAllocator* allocator, muttBitmapCache** cache);
+
+					// @DOCLINE Upon a non-fatal result, `cache` is set to a pointer to the new bitmap cache, which starts with no glyphs. `allocator` is the [allocator](#custom-allocators) used for all of the cache's memory, and can be 0 to use `mu_malloc`, `mu_realloc`, and `mu_free`.
+
+				// @DOCLINE ## Destroy bitmap cache
+
+					// @DOCLINE The function `mutt_bitmap_cache_destroy` frees all memory used by a bitmap cache, defined below: @NLNT
+					MUDEF void mutt_bitmap_cache_destroy(muttBitmapCache* cache);
+
+					// @DOCLINE No glyphs retrieved from the cache may still be in use when it is destroyed.
+
+				// @DOCLINE ## Get glyph from bitmap cache
+
+					// @DOCLINE The function `mutt_bitmap_cache_get` retrieves a rasterized glyph from a bitmap cache, rasterizing it if it isn't already cached, defined below: @NLNT
+					MUDEF muttResult mutt_bitmap_cache_get(muttBitmapCache* cache, muttFont* font, uint16_m glyph_id, float point_size, float ppi, muttRMethod method, float x_offset, muttCachedGlyph** glyph);
+
+					// @DOCLINE Glyphs are cached by `font`, `glyph_id`, `point_size`, `ppi`, `method`, and their subpixel position, which is the fractional part of `x_offset` rounded down to a multiple of one over the cache's `subpixels`. Upon a non-fatal result, `glyph` is set to a pointer to the cached glyph, which is rasterized and converted the same way that an [atlas](#atlas-api) does, with its points moved right by its `x_offset`. The tables required for the atlas API must be loaded.
+
+					// @DOCLINE The glyph is rasterized without holding the cache's lock, so several threads can rasterize different glyphs at once. If the glyph couldn't be cached without going over the cache's budget (which can happen if the glyph is larger than the budget, or if every other glyph is in use), it is still given, but is freed once it's released rather than being kept.
+
+				// @DOCLINE ## Release glyph from bitmap cache
+
+					// @DOCLINE Each glyph given by `mutt_bitmap_cache_get` is kept from being evicted until it is released with the function `mutt_bitmap_cache_release`, defined below: @NLNT
+					MUDEF void mutt_bitmap_cache_release(muttBitmapCache* cache, muttCachedGlyph* glyph);
+
+					// @DOCLINE `glyph` must not be used after it has been released.
+
+				// @DOCLINE ## Remove font from bitmap cache
+
+					// @DOCLINE Since a font is identified within a bitmap cache by its pointer, all of a font's glyphs must be removed from a cache before the font is deloaded, which is performed with the function `mutt_bitmap_cache_remove_font`, defined below: @NLNT
+					MUDEF void mutt_bitmap_cache_remove_font(muttBitmapCache* cache, muttFont* font);
+
+					// @DOCLINE Glyphs of the font that are still in use are freed once they're released.
+
+				// @DOCLINE ## Bitmap cache eviction
+
+					// @DOCLINE When adding a glyph would put a bitmap cache over its budget, glyphs are evicted using the CLOCK algorithm: the cache cycles through its glyphs, evicting the first one that isn't in use and hasn't been retrieved since the last time it was passed over. This approximates evicting the least-recently-used glyph without needing to reorder glyphs upon each retrieval.
+
+				// @DOCLINE ## Bitmap cache statistics
+
+					// @DOCLINE The function `mutt_bitmap_cache_stats` retrieves statistics about a bitmap cache, defined below: @NLNT
+					MUDEF void mutt_bitmap_cache_stats(muttBitmapCache* cache, muttBitmapCacheStats* stats);
+
+					// @DOCLINE The statistics are represented by the struct `muttBitmapCacheStats`, which has the following members:
+
+					struct muttBitmapCacheStats {
+						// @DOCLINE * `@NLFT hits` - the amount of retrievals of glyphs that were already cached.
+						uint64_m hits;
+						// @DOCLINE * `@NLFT misses` - the amount of retrievals that had to rasterize the glyph.
+						uint64_m misses;
+						// @DOCLINE * `@NLFT evictions` - the amount of glyphs evicted to stay within the budget.
+						uint64_m evictions;
+						// @DOCLINE * `@NLFT entries` - the amount of glyphs currently cached.
+						uint32_m entries;
+						// @DOCLINE * `@NLFT memory` - the amount of memory currently taken up by the cached glyphs, in bytes.
+						uint32_m memory;
+						// @DOCLINE * `@NLFT budget` - the budget given when the cache was created.
+						uint32_m budget;
+					};
+
+			// @DOCLINE # Result
+
+				// @DOCLINE The type `muttResult` (typedef for `uint32_m`) is defined to represent how a task went. Result values can be "fatal" (meaning that the task completely failed to execute, and the program will continue as if the task had never been attempted), "non-fatal" (meaning that the task partially failed, but was still able to complete the task), and "successful" (meaning that the task fully succeeded).
+
+				// @DOCLINE ## Result values
+
+				// @DOCLINE The following values are defined for `muttResult` (all values not explicitly stated as being fatal, non-fatal, or successful are assumed to be fatal):
+
+				// @DOCLINE ### General result values
+				// 0 -> 63 //
+
+					// @DOCLINE * `MUTT_SUCCESS` - the task was successfully completed; real value 0.
+					#define MUTT_SUCCESS 0
+					// @DOCLINE * `MUTT_FAILED_MALLOC` - a call to malloc failed, implying insufficient available memory to perform the task.
+					#define MUTT_FAILED_MALLOC 1
+					// @DCOLINE * `MUTT_FAILED_REALLOC` - a call to realloc failed, implying insufficient available memory to perform the task.
+					#define MUTT_FAILED_REALLOC 2
+					// @DOCLINE * `MUTT_FAILED_FIND_TABLE` - the table could not be located, and is likely not included in the font file.
+					#define MUTT_FAILED_FIND_TABLE 3
+					// @DOCLINE * `MUTT_FAILED_OPEN_FILE` - a file could not be opened, or its size could not be retrieved.
+					#define MUTT_FAILED_OPEN_FILE 4
+					// @DOCLINE * `MUTT_FAILED_MAP_FILE` - a file could not be mapped into memory, either because the call to map it failed, the file was empty or too large to map, or mapping files isn't supported on the current system.
+					#define MUTT_FAILED_MAP_FILE 5
+					// @DOCLINE * `MUTT_TABLE_NOT_LOADED` - the table was requested with [`MUTT_LOAD_LAZY`](#lazy-loading) and hasn't been parsed yet.
+					#define MUTT_TABLE_NOT_LOADED 6
+
+				// @DOCLINE ### Directory result values
+				// 64 -> 127 //
+
+					// @DOCLINE * `MUTT_INVALID_DIRECTORY_LENGTH` - the length of the table directory was invalid. This is the first check performed on the length of the font file data, meaning that if this result is given, it is likely that the data given is not font file data.
+					#define MUTT_INVALID_DIRECTORY_LENGTH 64
+					// @DOCLINE * `MUTT_INVALID_DIRECTORY_SFNT_VERSION` - the value of "sfntVersion" in the table directory was invalid/unsupported. This is the first check performed on the values within the font file data, meaning that if this result is given, it is likely that the data given is not TrueType font file data. This can also be triggered by the TrueType font using CFF data, which is currently unsupported.
+					#define MUTT_INVALID_DIRECTORY_SFNT_VERSION 65
+					// @DOCLINE * `MUTT_INVALID_DIRECTORY_NUM_TABLES` - the value of "numTables" in the table directory was invalid; the number of tables must be at least 9 to store all tables required in TrueType.
+					#define MUTT_INVALID_DIRECTORY_NUM_TABLES 66
+					// @DOCLINE * `MUTT_INVALID_DIRECTORY_RECORD_OFFSET` - the value of "offset" in a table record within the table directory was out of range.
+					#define MUTT_INVALID_DIRECTORY_RECORD_OFFSET 67
+					// @DOCLINE * `MUTT_INVALID_DIRECTORY_RECORD_LENGTH` - the value of "length" in a table record within the table directory was out of range.
+					#define MUTT_INVALID_DIRECTORY_RECORD_LENGTH 68
+					// @DOCLINE * `MUTT_INVALID_DIRECTORY_RECORD_CHECKSUM` - the value of "checksum" in a table record within the table directory was invalid, implying that the table data was incorrect.
+					#define MUTT_INVALID_DIRECTORY_RECORD_CHECKSUM 69
+					// @DOCLINE * `MUTT_INVALID_DIRECTORY_RECORD_TABLE_TAG` - the table tag of a table within the table directory was a duplicate of a previous one.
+					#define MUTT_INVALID_DIRECTORY_RECORD_TABLE_TAG 70
+					// @DOCLINE * `MUTT_MISSING_DIRECTORY_RECORD_TABLE_TAGS` - one or more tables required by TrueType standards could not be found in the table directory.
+					#define MUTT_MISSING_DIRECTORY_RECORD_TABLE_TAGS 71
+					// @DOCLINE * `MUTT_INVALID_COLLECTION_LENGTH` - the length of the collection header was invalid.
+					#define MUTT_INVALID_COLLECTION_LENGTH 72
+					// @DOCLINE * `MUTT_INVALID_COLLECTION_VERSION` - the value of "majorVersion" in the collection header was invalid/unsupported.
+					#define MUTT_INVALID_COLLECTION_VERSION 73
+					// @DOCLINE * `MUTT_INVALID_COLLECTION_FACE_INDEX` - the requested face index was out of range for the amount of faces within the font data.
+					#define MUTT_INVALID_COLLECTION_FACE_INDEX 74
+
+				// @DOCLINE ### Maxp result values
+				// 128 -> 191 //
+
+					// @DOCLINE * `MUTT_INVALID_MAXP_LENGTH` - the length of the maxp table was invalid.
+					#define MUTT_INVALID_MAXP_LENGTH 128
+					// @DOCLINE * `MUTT_INVALID_MAXP_VERSION` - the version of the maxp table given was invalid/unsupported. This likely means that the font has a CFF/CFF2 font outline, which is currently unsupported.
+					#define MUTT_INVALID_MAXP_VERSION 129
+					// @DOCLINE * `MUTT_INVALID_MAXP_NUM_GLYPHS` - the value for "numGlyphs" given in the maxp table was invalid.
+					#define MUTT_INVALID_MAXP_NUM_GLYPHS 130
+					// @DOCLINE * `MUTT_INVALID_MAXP_MAX_ZONES` - the value for "maxZones" given in the maxp table was invalid.
+					#define MUTT_INVALID_MAXP_MAX_ZONES 131
+
+				// @DOCLINE ### Head result values
+				// 192 -> 255 //
+
+					// @DOCLINE * `MUTT_INVALID_HEAD_LENGTH` - the length of the head table was invalid.
+					#define MUTT_INVALID_HEAD_LENGTH 192
+					// @DOCLINE * `MUTT_INVALID_HEAD_VERSION` - the version indicated for the head table was invalid/unsupported.
+					#define MUTT_INVALID_HEAD_VERSION 193
+					// @DOCLINE * `MUTT_INVALID_HEAD_MAGIC_NUMBER` - the value for the magic number in the head table was invalid.
+					#define MUTT_INVALID_HEAD_MAGIC_NUMBER 194
+					// @DOCLINE * `MUTT_INVALID_HEAD_UNITS_PER_EM` - the value for the units per em in the head table was not within the correct range of 16 to 16384.
+					#define MUTT_INVALID_HEAD_UNITS_PER_EM 195
+					// @DOCLINE * `MUTT_INVALID_HEAD_X_MIN_COORDINATES` - the value "xMin" in the head table was not within the valid TrueType grid coordinate range of -16384 to 16383.
+					#define MUTT_INVALID_HEAD_X_MIN_COORDINATES 196
+					// @DOCLINE * `MUTT_INVALID_HEAD_Y_MIN_COORDINATES` - the value "yMin" in the head table was not within the valid TrueType grid coordinate range of -16384 to 16383.
+					#define MUTT_INVALID_HEAD_Y_MIN_COORDINATES 197
+					// @DOCLINE * `MUTT_INVALID_HEAD_X_MAX_COORDINATES` - the value "xMax" in the head table was not within the valid TrueType grid coordinate range of -16384 to 16383.
+					#define MUTT_INVALID_HEAD_X_MAX_COORDINATES 198
+					// @DOCLINE * `MUTT_INVALID_HEAD_Y_MAX_COORDINATES` - the value "yMax" in the head table was not within the valid TrueType grid coordinate range of -16384 to 16383.
+					#define MUTT_INVALID_HEAD_Y_MAX_COORDINATES 199
+					// @DOCLINE * `MUTT_INVALID_HEAD_X_MIN_MAX` - the value established minimum x-value within the head table was greater than the established maximum x-value.
+					#define MUTT_INVALID_HEAD_X_MIN_MAX 200
+					// @DOCLINE * `MUTT_INVALID_HEAD_Y_MIN_MAX` - the value established minimum y-value within the head table was greater than the established maximum y-value.
+					#define MUTT_INVALID_HEAD_Y_MIN_MAX 201
+					// @DOCLINE * `MUTT_INVALID_HEAD_INDEX_TO_LOC_FORMAT` - the value for "indexToLocFormat" within the head table was invalid/unsupported; it was not one of the expected values 0 (Offset16) or 1 (Offset32).
+					#define MUTT_INVALID_HEAD_INDEX_TO_LOC_FORMAT 202
+					// @DOCLINE * `MUTT_INVALID_HEAD_GLYPH_DATA_FORMAT` - the value for "glyphDataFormat" within the head table was invalid/unsupported; it was not the expected value 0.
+					#define MUTT_INVALID_HEAD_GLYPH_DATA_FORMAT 203
+
+				// @DOCLINE ### Hhea result values
+				// 256 -> 319 //
+
+					// @DOCLINE * `MUTT_INVALID_HHEA_LENGTH` - the length of the hhea table was invalid.
+					#define MUTT_INVALID_HHEA_LENGTH 256
+					// @DOCLINE * `MUTT_INVALID_HHEA_VERSION` - the version indicated for the hhea table was invalid/unsupported.
+					#define MUTT_INVALID_HHEA_VERSION 257
+					// @DOCLINE * `MUTT_INVALID_HHEA_METRIC_DATA_FORMAT` - the value for "metricDataFormat" within the hhea table was invalid/unsupported; it was not the expected value 0.
+					#define MUTT_INVALID_HHEA_METRIC_DATA_FORMAT 258
+					// @DOCLINE * `MUTT_INVALID_HHEA_NUMBER_OF_HMETRICS` - the value for "numberOfHMetrics" within the hhea table was invalid; numberOfHMetrics must be less than or equal to "numGlyphs" in order to generate a valid array length for "leftSideBearings" within hmtx.
+					#define MUTT_INVALID_HHEA_NUMBER_OF_HMETRICS 259
+					// @DOCLINE * `MUTT_HHEA_REQUIRES_MAXP` - the maxp table rather failed to load or was not requested for loading, and hhea requires maxp to be loaded.
+					#define MUTT_HHEA_REQUIRES_MAXP 260
+
+				// @DOCLINE ### Hmtx result values
+				// 320 -> 383 //
+
+					// @DOCLINE * `MUTT_INVALID_HMTX_LENGTH` - the length of the hmtx table was invalid.
+					#define MUTT_INVALID_HMTX_LENGTH 320
+					// @DOCLINE * `MUTT_HMTX_REQUIRES_MAXP` - the maxp table rather failed to load or was not requested for loading, and hmtx requires maxp to be loaded.
+					#define MUTT_HMTX_REQUIRES_MAXP 321
+					// @DOCLINE * `MUTT_HMTX_REQUIRES_HHEA` - the hhea table rather failed to load or was not requested for loading, and hmtx requires hhea to be loaded.
+					#define MUTT_HMTX_REQUIRES_HHEA 322
+
+				// @DOCLINE ### Loca result values
+				// 384 -> 447 //
+
+					// @DOCLINE * `MUTT_INVALID_LOCA_LENGTH` - the length of the loca table was invalid.
 					#define MUTT_INVALID_LOCA_LENGTH 284
 					// @DOCLINE * `MUTT_INVALID_LOCA_OFFSET` - an offset in the loca table was invalid. This could mean that the offset's range was invalid for the glyf table, or that the rule of incremental offsets was violated.
 					#define MUTT_INVALID_LOCA_OFFSET 285
@@ -5462,6 +6378,81 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// @DOCLINE * `MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2` - the process of converting a composite glyph to an rglyph failed because a simple glyph had an argument2 value giving a point number that was out of range for the child glyph.
 					#define MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2 646
 
+					// @DOCLINE * `MUTT_UNSUPPORTED_SPAN_METHOD` - the given raster method can't be used to rasterize a glyph to [spans](#raster-spans).
+					#define MUTT_UNSUPPORTED_SPAN_METHOD 647
+
+					// @DOCLINE * `MUTT_RASTER_SPANS_FULL` - more spans were output than the span buffer could hold; see [raster spans](#raster-spans). This is non-fatal, as the spans that fit are still written.
+					#define MUTT_RASTER_SPANS_FULL 648
+
+				// @DOCLINE ### Atlas result values
+				// 704 -> 767 //
+
+					// @DOCLINE * `MUTT_ATLAS_GLYPH_TOO_LARGE` - a glyph couldn't be added to an atlas because its bitmap is larger than a page. This is non-fatal, as the other glyphs are still added.
+					#define MUTT_ATLAS_GLYPH_TOO_LARGE 704
+
+					// @DOCLINE * `MUTT_INVALID_ATLAS_PAGE_DIMENSIONS` - the page width or height given for an atlas was 0.
+					#define MUTT_INVALID_ATLAS_PAGE_DIMENSIONS 705
+
+					// @DOCLINE * `MUTT_INVALID_ATLAS_GLYPH_ID` - a glyph ID given to be added to an atlas was out of range for the font.
+					#define MUTT_INVALID_ATLAS_GLYPH_ID 706
+
+				// @DOCLINE ### Bitmap cache result values
+				// 768 -> 831 //
+
+					// @DOCLINE * `MUTT_INVALID_BITMAP_CACHE_GLYPH_ID` - a glyph ID given to be retrieved from a bitmap cache was out of range for the font.
+					#define MUTT_INVALID_BITMAP_CACHE_GLYPH_ID 768
+
+				// @DOCLINE ### Kern result values
+				// 832 -> 895 //
+
+					// @DOCLINE * `MUTT_INVALID_KERN_LENGTH` - the length of the kern table was invalid/insufficient to define the data needed.
+					#define MUTT_INVALID_KERN_LENGTH 832
+					// @DOCLINE * `MUTT_INVALID_KERN_VERSION` - the version of the kern table was invalid/unsupported.
+					#define MUTT_INVALID_KERN_VERSION 833
+					// @DOCLINE * `MUTT_INVALID_KERN_SUBTABLE_LENGTH` - the length of a kern subtable was invalid, or the subtable extended past the end of the kern table.
+					#define MUTT_INVALID_KERN_SUBTABLE_LENGTH 834
+
+					// @DOCLINE * `MUTT_KERN_REQUIRES_MAXP` - the maxp table rather failed to load or was not requested for loading, and kern requires maxp to be loaded.
+					#define MUTT_KERN_REQUIRES_MAXP 895
+
+				// @DOCLINE ### GPOS result values
+				// 896 -> 959 //
+
+					// @DOCLINE * `MUTT_INVALID_GPOS_LENGTH` - the length of the GPOS table was invalid/insufficient to define the data needed.
+					#define MUTT_INVALID_GPOS_LENGTH 896
+					// @DOCLINE * `MUTT_INVALID_GPOS_VERSION` - the version of the GPOS table was invalid/unsupported.
+					#define MUTT_INVALID_GPOS_VERSION 897
+					// @DOCLINE * `MUTT_INVALID_GPOS_FEATURE_LIST` - the feature list of the GPOS table, or a 'kern' feature table within it, was out of range for the table, or referenced a lookup index that was out of range.
+					#define MUTT_INVALID_GPOS_FEATURE_LIST 898
+					// @DOCLINE * `MUTT_INVALID_GPOS_LOOKUP_LIST` - the lookup list of the GPOS table was out of range for the table.
+					#define MUTT_INVALID_GPOS_LOOKUP_LIST 899
+					// @DOCLINE * `MUTT_INVALID_GPOS_LOOKUP` - a lookup table used for kerning, or an extension subtable within it, was out of range for the GPOS table or had an invalid format.
+					#define MUTT_INVALID_GPOS_LOOKUP 900
+					// @DOCLINE * `MUTT_INVALID_GPOS_PAIR_POS` - a pair adjustment subtable was out of range for the GPOS table or had an invalid format.
+					#define MUTT_INVALID_GPOS_PAIR_POS 901
+					// @DOCLINE * `MUTT_INVALID_GPOS_COVERAGE` - a coverage table used by a pair adjustment subtable was out of range for the GPOS table or had an invalid format.
+					#define MUTT_INVALID_GPOS_COVERAGE 902
+					// @DOCLINE * `MUTT_INVALID_GPOS_CLASS_DEF` - a class definition table used by a pair adjustment subtable was out of range for the GPOS table or had an invalid format.
+					#define MUTT_INVALID_GPOS_CLASS_DEF 903
+
+					// @DOCLINE * `MUTT_GPOS_REQUIRES_MAXP` - the maxp table rather failed to load or was not requested for loading, and GPOS requires maxp to be loaded.
+					#define MUTT_GPOS_REQUIRES_MAXP 959
+
+				// @DOCLINE ### Post result values
+				// 960 -> 1023 //
+
+					// @DOCLINE * `MUTT_INVALID_POST_LENGTH` - the length of the post table was invalid/insufficient to define the data needed.
+					#define MUTT_INVALID_POST_LENGTH 960
+					// @DOCLINE * `MUTT_INVALID_POST_VERSION` - the version of the post table was invalid/unsupported.
+					#define MUTT_INVALID_POST_VERSION 961
+					// @DOCLINE * `MUTT_INVALID_POST_NUM_GLYPHS` - the value for "numGlyphs" in the post table was not equal to "numGlyphs" in the maxp table.
+					#define MUTT_INVALID_POST_NUM_GLYPHS 962
+					// @DOCLINE * `MUTT_INVALID_POST_GLYPH_NAME_INDEX` - a glyph name index (or offset for version 2.5) in the post table referred to a name that doesn't exist.
+					#define MUTT_INVALID_POST_GLYPH_NAME_INDEX 963
+
+					// @DOCLINE * `MUTT_POST_REQUIRES_MAXP` - the maxp table rather failed to load or was not requested for loading, and post requires maxp to be loaded.
+					#define MUTT_POST_REQUIRES_MAXP 1023
+
 				// @DOCLINE ## Check if result is fatal
 
 					// @DOCLINE The function `mutt_result_is_fatal` returns whether or not a given `muttResult` value is fatal, defined below: @NLNT
@@ -5482,6 +6473,20 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 					#endif
 
+			// @DOCLINE # SIMD
+
+				// @DOCLINE Some performance-critical loops within mutt have SIMD implementations, which are chosen at compile time based on what instruction sets the compiler is targeting:
+
+				// @DOCLINE * AVX2 - used if `__AVX2__` is defined.
+
+				// @DOCLINE * SSE2 - used if `__SSE2__` or `_M_X64` is defined, or if `_M_IX86_FP` is at least 2.
+
+				// @DOCLINE * NEON - used if `__ARM_NEON`, `__ARM_NEON__`, or `_M_ARM64` is defined.
+
+				// @DOCLINE If none of these are available, a scalar implementation is used. All SIMD implementations are turned off, always using the scalar implementation, if `MUTT_NO_SIMD` is defined before the implementation of mutt.
+
+				// @DOCLINE Currently, SIMD implementations exist for converting coverage values to pixels (including the expansion to RGB/RGBA channels), for summing the accumulated area of [area coverage rasterization](#area-coverage), for calculating the checksums of tables when loading a font, and for converting the metrics given by [`mutt_glyph_advances`](#bulk-advances) to pixel units.
+
 			// @DOCLINE # C standard library dependencies
 
 				// @DOCLINE mutt has several C standard library dependencies, all of which are overridable by defining them before the inclusion of its header. The following is a list of those dependencies.
@@ -5536,7 +6541,12 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 				#if !defined(mu_fabsf) || \
 					!defined(mu_roundf) || \
-					!defined(mu_ceilf)
+					!defined(mu_ceilf) || \
+					!defined(mu_floorf) || \
+					!defined(mu_sqrtf) || \
+					!defined(mu_cbrtf) || \
+					!defined(mu_cosf) || \
+					!defined(mu_acosf)
 
 					// @DOCLINE ## `math.h` dependencies
 					#include <math.h>
@@ -5556,6 +6566,31 @@ All mu libraries included in muSDK have name functions to convert some of their
 						#define mu_ceilf ceilf
 					#endif
 
+					// @DOCLINE * `mu_floorf` - equivalent to `floorf`.
+					#ifndef mu_floorf
+						#define mu_floorf floorf
+					#endif
+
+					// @DOCLINE * `mu_sqrtf` - equivalent to `sqrtf`.
+					#ifndef mu_sqrtf
+						#define mu_sqrtf sqrtf
+					#endif
+
+					// @DOCLINE * `mu_cbrtf` - equivalent to `cbrtf`.
+					#ifndef mu_cbrtf
+						#define mu_cbrtf cbrtf
+					#endif
+
+					// @DOCLINE * `mu_cosf` - equivalent to `cosf`.
+					#ifndef mu_cosf
+						#define mu_cosf cosf
+					#endif
+
+					// @DOCLINE * `mu_acosf` - equivalent to `acosf`.
+					#ifndef mu_acosf
+						#define mu_acosf acosf
+					#endif
+
 				#endif /* math.h */
 
 			MU_CPP_EXTERN_END
@@ -12467,12 +13502,29 @@ All mu libraries included in muSDK have name functions to convert some of their
 					context->result = MUG_SUCCESS;
 				}
 
+				// Default allocator
+				context->allocator = 0;
+
 				// Set context
 				if (set_context) {
 					mug_context_set(context);
 				}
 			}
 
+			// Allocates memory with an allocator, or mu_malloc if there is none
+			void* mug_Malloc(mugAllocator* allocator, size_m size) {
+				return (allocator) ?(allocator->allocate(allocator->user, size)) :(mu_malloc(size));
+			}
+
+			// Frees memory with an allocator, or mu_free if there is none
+			void mug_Free(mugAllocator* allocator, void* ptr) {
+				if (allocator) {
+					allocator->deallocate(allocator->user, ptr);
+				} else {
+					mu_free(ptr);
+				}
+			}
+
 			// Destroy context
 			MUDEF void mug_context_destroy(mugContext* context) {
 				// Destroy muCOSA context
@@ -12514,6 +13566,8 @@ All mu libraries included in muSDK have name functions to convert some of their
 			struct mug_Graphic {
 				// The context used by the graphic
 				mugContext* context;
+				// The allocator the graphic was allocated with
+				mugAllocator* allocator;
 				// Graphic system
 				muGraphicSystem system;
 				// Inner-API data
@@ -12841,25 +13895,28 @@ All mu libraries included in muSDK have name functions to convert some of their
 					GLuint handle;
 					// The format type (like GL_TEXTURE_2D for example)
 					GLenum target;
+					// The allocator the texture was allocated with
+					mugAllocator* allocator;
 				};
 				typedef struct mugGL_Texture mugGL_Texture;
 
 				// Creates a texture
 				// 2D: dim[2]
 				// 2D-array: dim[3]
-				mugGL_Texture* mugGL_texture_create(mugResult* result, mugTextureInfo* info, uint32_m* dim, muByte* data) {
+				mugGL_Texture* mugGL_texture_create(mugAllocator* allocator, mugResult* result, mugTextureInfo* info, uint32_m* dim, muByte* data) {
 					// Allocate the texture container
-					mugGL_Texture* tex = (mugGL_Texture*)mu_malloc(sizeof(mugGL_Texture));
+					mugGL_Texture* tex = (mugGL_Texture*)mug_Malloc(allocator, sizeof(mugGL_Texture));
 					if (!tex) {
 						MU_SET_RESULT(result, MUG_FAILED_MALLOC)
 						return 0;
 					}
+					tex->allocator = allocator;
 
 					// Generate texture
 					glGenTextures(1, &tex->handle);
 					if (!tex->handle) {
 						MU_SET_RESULT(result, MUG_GL_FAILED_GENERATE_TEXTURE)
-						mu_free(tex);
+						mug_Free(allocator, tex);
 						return 0;
 					}
 
@@ -12911,7 +13968,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// Destroy texture
 					glDeleteTextures(1, &tex->handle);
 					// Free container
-					mu_free(tex);
+					mug_Free(tex->allocator, tex);
 					// Return null
 					return 0;
 				}
@@ -12967,6 +14024,9 @@ All mu libraries included in muSDK have name functions to convert some of their
 					void (*render)(mugGL_ObjBuffer*);
 					// Same but subrenders
 					void (*subrender)(uint32_m o, uint32_m c);
+
+					// The allocator the buffer was allocated with
+					mugAllocator* allocator;
 				};
 
 				// Checks if a given buffer is the expected size
@@ -12980,7 +14040,8 @@ All mu libraries included in muSDK have name functions to convert some of their
 				}
 
 				// Fills a buffer; obj can be null to just size buffer
-				mugResult mugGL_objects_fill(mugGL_ObjBuffer* buf, void* obj) {
+				// (Vertex/index data is allocated with allocator)
+				mugResult mugGL_objects_fill(mugAllocator* allocator, mugGL_ObjBuffer* buf, void* obj) {
 					// Bind VAO
 					glBindVertexArray(buf->vao);
 
@@ -12988,7 +14049,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					if (obj)
 					{
 						// Allocate vertexes
-						GLfloat* vertexes = (GLfloat*)mu_malloc(buf->vbuf_size);
+						GLfloat* vertexes = (GLfloat*)mug_Malloc(allocator, buf->vbuf_size);
 						if (!vertexes) {
 							glBindVertexArray(0);
 							return MUG_FAILED_MALLOC;
@@ -13002,7 +14063,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 						glBufferData(GL_ARRAY_BUFFER, buf->vbuf_size, vertexes, GL_DYNAMIC_DRAW);
 
 						// Free vertex data
-						mu_free(vertexes);
+						mug_Free(allocator, vertexes);
 
 						// Ensure buffer is expected size
 						if (!mugGL_buffer_size_check(GL_ARRAY_BUFFER, buf->vbuf_size)) {
@@ -13021,7 +14082,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					if (buf->fill_indexes && !buf->index_filled)
 					{
 						// Allocate indexes
-						GLuint* indexes = (GLuint*)mu_malloc(buf->ibuf_size);
+						GLuint* indexes = (GLuint*)mug_Malloc(allocator, buf->ibuf_size);
 						if (!indexes) {
 							glBindBuffer(GL_ARRAY_BUFFER, 0);
 							glBindVertexArray(0);
@@ -13036,7 +14097,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 						glBufferData(GL_ELEMENT_ARRAY_BUFFER, buf->ibuf_size, indexes, GL_STATIC_DRAW);
 
 						// Free index data
-						mu_free(indexes);
+						mug_Free(allocator, indexes);
 
 						// Ensure buffer is expected size
 						if (!mugGL_buffer_size_check(GL_ELEMENT_ARRAY_BUFFER, buf->ibuf_size)) {
@@ -13059,7 +14120,8 @@ All mu libraries included in muSDK have name functions to convert some of their
 				}
 
 				// Fills a portion of a buffer; obj cannot be null
-				mugResult mugGL_objects_subfill(mugGL_ObjBuffer* buf, uint32_m obj_offset, uint32_m obj_count, void* obj) {
+				// (Vertex data is allocated with allocator)
+				mugResult mugGL_objects_subfill(mugAllocator* allocator, mugGL_ObjBuffer* buf, uint32_m obj_offset, uint32_m obj_count, void* obj) {
 					// Bind VAO
 					glBindVertexArray(buf->vao);
 
@@ -13070,7 +14132,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 						uint32_m data_offset = obj_offset*buf->bv_per_obj;
 
 						// Allocate vertexes
-						GLfloat* vertexes = (GLfloat*)mu_malloc(data_size);
+						GLfloat* vertexes = (GLfloat*)mug_Malloc(allocator, data_size);
 						if (!vertexes) {
 							glBindVertexArray(0);
 							return MUG_FAILED_MALLOC;
@@ -13084,7 +14146,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 						glBufferSubData(GL_ARRAY_BUFFER, data_offset, data_size, vertexes);
 
 						// Free vertex data
-						mu_free(vertexes);
+						mug_Free(allocator, vertexes);
 					}
 
 					// Describe data
@@ -13107,7 +14169,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 				// Creates a given buffer
 				// All fields besides OpenGL objects should be set within buf by now
-				mugResult mugGL_objects_create(mugGL_ObjBuffer* buf, void* obj) {
+				mugResult mugGL_objects_create(mugAllocator* allocator, mugGL_ObjBuffer* buf, void* obj) {
 					// Generate VBO
 					glGenBuffers(1, &buf->vbo);
 					if (!buf->vbo) {
@@ -13132,7 +14194,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					}
 
 					// Fill buffer
-					mugResult res = mugGL_objects_fill(buf, obj);
+					mugResult res = mugGL_objects_fill(allocator, buf, obj);
 					if (mug_result_is_fatal(res)) {
 						mugGL_objects_destroy(buf);
 						return res;
@@ -13143,7 +14205,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 				// Resizes a given buffer
 				// Buffer's contents are unknown after this if data is NULL
-				mugResult mugGL_objects_resize(mugGL_ObjBuffer* buf, uint32_m obj_count, void* obj) {
+				mugResult mugGL_objects_resize(mugAllocator* allocator, mugGL_ObjBuffer* buf, uint32_m obj_count, void* obj) {
 					// Set count + other related variables
 					uint32_m prev_count = buf->obj_count;
 					buf->obj_count = obj_count;
@@ -13152,7 +14214,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					buf->index_filled = MU_FALSE;
 
 					// Perform a fill
-					mugResult res = mugGL_objects_fill(buf, obj);
+					mugResult res = mugGL_objects_fill(allocator, buf, obj);
 					// If fatally failed, set things back to what they were
 					if (mug_result_is_fatal(res)) {
 						buf->obj_count = prev_count;
@@ -14758,7 +15820,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 				// Loads a valid OpenGL context
 				mugResult mugGL_init_context(mug_Graphic* gfx) {
 					// Allocate inner GL context
-					gfx->p = mu_malloc(sizeof(mugGL_Context));
+					gfx->p = mug_Malloc(gfx->allocator, sizeof(mugGL_Context));
 					if (!gfx->p) {
 						return MUG_FAILED_MALLOC;
 					}
@@ -14768,7 +15830,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// Create OpenGL context
 					mugResult res = mugGraphicGL_create(gfx);
 					if (mug_result_is_fatal(res)) {
-						mu_free(gfx->p);
+						mug_Free(gfx->allocator, gfx->p);
 						return res;
 					}
 
@@ -14778,7 +15840,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// Load OpenGL functions
 					mugGL_load_func_context = &gfx->context->cosa;
 					if (!gladLoadGL((GLADloadfunc)mugGL_load_func)) {
-						mu_free(gfx->p);
+						mug_Free(gfx->allocator, gfx->p);
 						mugGraphicGL_destroy(gfx);
 						return MUG_GL_FAILED_LOAD;
 					}
@@ -14801,7 +15863,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 				// Deloads a valid OpenGL context
 				void mugGL_term_context(mug_Graphic* gfx) {
 					// Free inner context
-					mu_free(gfx->p);
+					mug_Free(gfx->allocator, gfx->p);
 					// Destroy OpenGL context
 					mugGraphicGL_destroy(gfx);
 				}
@@ -14952,7 +16014,8 @@ All mu libraries included in muSDK have name functions to convert some of their
 						}
 
 						// Allocate struct
-						mugGL_ObjBuffer* buf = (mugGL_ObjBuffer*)mu_malloc(sizeof(mugGL_ObjBuffer));
+						mugAllocator* allocator = gfx->context->allocator;
+						mugGL_ObjBuffer* buf = (mugGL_ObjBuffer*)mug_Malloc(allocator, sizeof(mugGL_ObjBuffer));
 						if (!buf) {
 							MU_SET_RESULT(result, MUG_FAILED_MALLOC)
 							return 0;
@@ -14963,12 +16026,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 						if (res != MUG_SUCCESS) {
 							MU_SET_RESULT(result, res)
 							if (mug_result_is_fatal(res)) {
-								mu_free(buf);
+								mug_Free(allocator, buf);
 								return 0;
 							}
 						}
 
 						// Fill other calculatable info
+						buf->allocator = allocator;
 						buf->obj_count = obj_count;
 						buf->vbuf_size = obj_count*buf->bv_per_obj;
 						if (buf->fill_indexes) {
@@ -14976,11 +16040,11 @@ All mu libraries included in muSDK have name functions to convert some of their
 						}
 
 						// Create buffers
-						res = mugGL_objects_create(buf, obj);
+						res = mugGL_objects_create(allocator, buf, obj);
 						if (res != MUG_SUCCESS) {
 							MU_SET_RESULT(result, res)
 							if (mug_result_is_fatal(res)) {
-								mu_free(buf);
+								mug_Free(allocator, buf);
 								return 0;
 							}
 						}
@@ -14993,7 +16057,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 						// Destroy inner buffers
 						mugGL_objects_destroy(buf);
 						// Free malloc'd data
-						mu_free(buf);
+						mug_Free(buf->allocator, buf);
 						// Return null
 						return 0;
 					}
@@ -15098,7 +16162,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 				mugGraphic_destroy(ingfx);
 
 				// Free graphic
-				mu_free(ingfx);
+				mug_Free(ingfx->allocator, ingfx);
 
 				// Return null
 				return 0;
@@ -15110,18 +16174,20 @@ All mu libraries included in muSDK have name functions to convert some of their
 			// Create graphic via window
 			MUDEF muGraphic mug_graphic_create_window(mugContext* context, mugResult* result, muGraphicSystem system, muWindowInfo* info) {
 				// Allocate handle to graphics
-				mug_Graphic* gfx = (mug_Graphic*)mu_malloc(sizeof(mug_Graphic));
+				mugAllocator* allocator = context->allocator;
+				mug_Graphic* gfx = (mug_Graphic*)mug_Malloc(allocator, sizeof(mug_Graphic));
 				if (!gfx) {
 					MU_SET_RESULT(result, MUG_FAILED_MALLOC);
 					return 0;
 				}
+				gfx->allocator = allocator;
 
 				// Create window graphic
 				mugResult res = mugGraphic_window_create(context, info, gfx, system);
 				if (res != MUG_SUCCESS) {
 					MU_SET_RESULT(result, res)
 					if (mug_result_is_fatal(res)) {
-						mu_free(gfx);
+						mug_Free(allocator, gfx);
 						return 0;
 					}
 				}
@@ -15133,7 +16199,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 						// Destroy graphic
 						mugGraphic_destroy(gfx);
 						// Free graphic
-						mu_free(gfx);
+						mug_Free(allocator, gfx);
 						// Return failure value
 						MU_SET_RESULT(result, MUG_UNKNOWN_GRAPHIC_SYSTEM)
 						return 0;
@@ -15150,7 +16216,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 								MU_SET_RESULT(result, res)
 								if (mug_result_is_fatal(res)) {
 									mugGraphic_destroy(gfx);
-									mu_free(gfx);
+									mug_Free(allocator, gfx);
 									return 0;
 								}
 							}
@@ -15430,7 +16496,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// OpenGL
 					#ifdef MU_SUPPORT_OPENGL
 						case MU_GRAPHIC_OPENGL: {
-							mugResult res = mugGL_objects_fill((mugGL_ObjBuffer*)objs, data);
+							mugResult res = mugGL_objects_fill(context->allocator, (mugGL_ObjBuffer*)objs, data);
 							if (res != MUG_SUCCESS) {
 								MU_SET_RESULT(result, res)
 							}
@@ -15454,7 +16520,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					#ifdef MU_SUPPORT_OPENGL
 						case MU_GRAPHIC_OPENGL: {
 							mugGraphicGL_bind(igfx);
-							mugResult res = mugGL_objects_subfill((mugGL_ObjBuffer*)objs, offset, count, data);
+							mugResult res = mugGL_objects_subfill(context->allocator, (mugGL_ObjBuffer*)objs, offset, count, data);
 							if (res != MUG_SUCCESS) {
 								MU_SET_RESULT(result, res)
 							}
@@ -15501,7 +16567,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					#ifdef MU_SUPPORT_OPENGL
 						case MU_GRAPHIC_OPENGL: {
 							mugGraphicGL_bind(igfx);
-							return mugGL_texture_create(result, info, dim, data);
+							return mugGL_texture_create(context->allocator, result, info, dim, data);
 						} break;
 					#endif
 				}
@@ -15739,28 +16805,184 @@ All mu libraries included in muSDK have name functions to convert some of their
 	// Standard inclusion:
 	#else
 	#ifdef MUTT_IMPLEMENTATION
+		// SIMD instruction set recognition
+		#ifndef MUTT_NO_SIMD
+			#if defined(__AVX2__)
+				#define MUTT_SIMD_AVX2
+				#include <immintrin.h>
+			#endif
+			#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				#define MUTT_SIMD_SSE2
+				#include <emmintrin.h>
+			#endif
+			#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+				#define MUTT_SIMD_NEON
+				#include <arm_neon.h>
+			#endif
+		#endif
+
+		// Thread support
+		#ifndef MUTT_NO_THREADS
+			#if defined(MU_WIN32)
+				#define MUTT_THREADS_WIN32
+				#include <windows.h>
+			#elif defined(MU_LINUX) || defined(__unix__) || defined(__APPLE__)
+				#define MUTT_THREADS_PTHREAD
+				#include <pthread.h>
+			#endif
+		#endif
+
+		// File mapping support
+		#ifndef MUTT_NO_MAP_FILE
+			#if defined(MU_LINUX) || defined(__unix__) || defined(__APPLE__)
+				#define MUTT_MAP_FILE_POSIX
+				#include <sys/mman.h>
+				#include <sys/stat.h>
+				#include <fcntl.h>
+				#include <unistd.h>
+			#endif
+		#endif
+
 		MU_CPP_EXTERN_START
 
-		/* Lower-level API */
+		// Parses lazily-loaded tables if any of them are still pending
+		#define MUTT_LAZY_LOAD(font, flags) if ((font)->lazy_flags & (flags)) { mutt_lazy_load(font, flags); }
+		// Tables needed to read a glyph
+		#define MUTT_LAZY_GLYPH (MUTT_LOAD_MAXP | MUTT_LOAD_HEAD | MUTT_LOAD_LOCA | MUTT_LOAD_GLYF)
+		// Tables needed to read glyph metrics
+		#define MUTT_LAZY_METRICS (MUTT_LOAD_HEAD | MUTT_LOAD_HHEA | MUTT_LOAD_HMTX)
+		// Load flags that indicate a table (rather than something built from one)
+		#define MUTT_TABLE_FLAGS (MUTT_LOAD_REQUIRED | MUTT_LOAD_KERNING)
 
-			/* Checksum logic */
+		/* Allocation */
 
-				// Verfifies the checksum of a given table
-				muBool mutt_VerifyTableChecksum(muByte* table, uint32_m length, uint32_m checksum) {
-					// Initial vars
-					uint32_m current_checksum = 0;
-					uint32_m off = length%4;
+			// Allocates memory with a font's allocator, or mu_malloc if there is none
+			void* mutt_Malloc(muttAllocator* allocator, size_m size) {
+				return (allocator) ?(allocator->allocate(allocator->user, size)) :(mu_malloc(size));
+			}
 
-					// Calculate end of table
-					muByte* end = &table[length];
+			// Reallocates memory with a font's allocator, or mu_realloc if there is none
+			void* mutt_Realloc(muttAllocator* allocator, void* ptr, size_m size) {
+				return (allocator) ?(allocator->reallocate(allocator->user, ptr, size)) :(mu_realloc(ptr, size));
+			}
 
-					// Go through each u32 in the table data
-					while (table < end) {
-						// Handle if we're cutting into the end of the table unevenly:
-						if (off != 0 && (table+4) >= end) {
-							// 16-bit
-							if (off == 2) {
-								current_checksum += MU_RBEU16(table) << 16;
+			// Frees memory with a font's allocator, or mu_free if there is none
+			void mutt_Free(muttAllocator* allocator, void* ptr) {
+				if (allocator) {
+					allocator->deallocate(allocator->user, ptr);
+				} else {
+					mu_free(ptr);
+				}
+			}
+
+		/* Locking */
+
+			// Lock for memory that's shared between threads
+			#if defined(MUTT_THREADS_WIN32)
+			typedef CRITICAL_SECTION muttLock;
+			#elif defined(MUTT_THREADS_PTHREAD)
+			typedef pthread_mutex_t muttLock;
+			#else
+			typedef muBool muttLock;
+			#endif
+
+			void mutt_LockInit(muttLock* lock) {
+				#if defined(MUTT_THREADS_WIN32)
+				InitializeCriticalSection(lock);
+				#elif defined(MUTT_THREADS_PTHREAD)
+				pthread_mutex_init(lock, 0);
+				#else
+				*lock = MU_FALSE;
+				#endif
+			}
+
+			void mutt_Lock(muttLock* lock) {
+				#if defined(MUTT_THREADS_WIN32)
+				EnterCriticalSection(lock);
+				#elif defined(MUTT_THREADS_PTHREAD)
+				pthread_mutex_lock(lock);
+				#else
+				*lock = MU_TRUE;
+				#endif
+			}
+
+			void mutt_Unlock(muttLock* lock) {
+				#if defined(MUTT_THREADS_WIN32)
+				LeaveCriticalSection(lock);
+				#elif defined(MUTT_THREADS_PTHREAD)
+				pthread_mutex_unlock(lock);
+				#else
+				*lock = MU_FALSE;
+				#endif
+			}
+
+			void mutt_LockFree(muttLock* lock) {
+				#if defined(MUTT_THREADS_WIN32)
+				DeleteCriticalSection(lock);
+				#elif defined(MUTT_THREADS_PTHREAD)
+				pthread_mutex_destroy(lock);
+				#else
+				if (lock) {}
+				#endif
+			}
+
+		/* Lower-level API */
+
+			/* Checksum logic */
+
+				// Verfifies the checksum of a given table
+				muBool mutt_VerifyTableChecksum(muByte* table, uint32_m length, uint32_m checksum) {
+					// Initial vars
+					uint32_m current_checksum = 0;
+					uint32_m off = length%4;
+
+					// Calculate end of table
+					muByte* end = &table[length];
+
+					// Sum big-endian u32s in bulk, byte-swapping each lane
+					// (Addition is mod 2^32 in each lane, so lanes are summed once at the end)
+					#if defined(MUTT_SIMD_AVX2)
+					__m256i swap8 = _mm256_setr_epi8(3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12, 3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12);
+					__m256i sum8 = _mm256_setzero_si256();
+					for (; table+32 <= end; table += 32) {
+						sum8 = _mm256_add_epi32(sum8, _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)table), swap8));
+					}
+					uint32_m lanes8[8];
+					_mm256_storeu_si256((__m256i*)lanes8, sum8);
+					for (uint8_m l = 0; l < 8; ++l) {
+						current_checksum += lanes8[l];
+					}
+					#endif
+
+					#if defined(MUTT_SIMD_SSE2)
+					__m128i sum4 = _mm_setzero_si128();
+					for (; table+16 <= end; table += 16) {
+						__m128i x = _mm_loadu_si128((__m128i*)table);
+						// Swap bytes within 16-bit halves, then swap the halves
+						x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+						x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2,3,0,1)), _MM_SHUFFLE(2,3,0,1));
+						sum4 = _mm_add_epi32(sum4, x);
+					}
+					uint32_m lanes4[4];
+					_mm_storeu_si128((__m128i*)lanes4, sum4);
+					current_checksum += lanes4[0] + lanes4[1] + lanes4[2] + lanes4[3];
+					#elif defined(MUTT_SIMD_NEON)
+					uint32x4_t sum4 = vdupq_n_u32(0);
+					for (; table+16 <= end; table += 16) {
+						sum4 = vaddq_u32(sum4, vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(table))));
+					}
+					current_checksum += vgetq_lane_u32(sum4, 0) + vgetq_lane_u32(sum4, 1) + vgetq_lane_u32(sum4, 2) + vgetq_lane_u32(sum4, 3);
+					#endif
+
+					// Scalar for the remainder
+
+					// Go through each u32 in the table data
+					while (table < end) {
+						// Handle if we're cutting into the end of the table unevenly:
+						if (off != 0 && (table+4) >= end) {
+							// 16-bit
+							if (off == 2) {
+								current_checksum += MU_RBEU16(table) << 16;
 							}
 							// 24-bit
 							else if (off == 3) {
@@ -15789,15 +17011,69 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 			/* Table directory */
 
-				// Loads the table directory
+				// Gets the amount of faces within font data
+				muttResult mutt_CollectionFaces(muByte* data, uint64_m datalen, uint32_m* num_faces) {
+					// Single font if not tagged 'ttcf'
+					if (datalen < 4 || MU_RBEU32(data) != 0x74746366) {
+						*num_faces = 1;
+						return MUTT_SUCCESS;
+					}
+
+					// Verify min. length for ttcTag, versions, and numFonts
+					if (datalen < 12) {
+						return MUTT_INVALID_COLLECTION_LENGTH;
+					}
+					// Verify majorVersion
+					uint16_m major_version = MU_RBEU16(data+4);
+					if (major_version != 1 && major_version != 2) {
+						return MUTT_INVALID_COLLECTION_VERSION;
+					}
+					// Read numFonts and verify length for tableDirectoryOffsets
+					*num_faces = MU_RBEU32(data+8);
+					if (datalen < 12+((uint64_m)*num_faces)*4) {
+						return MUTT_INVALID_COLLECTION_LENGTH;
+					}
+					return MUTT_SUCCESS;
+				}
+
+				// Gets the offset of a face's table directory within font data
+				muttResult mutt_FaceOffset(muByte* data, uint64_m datalen, uint32_m face_index, uint32_m* offset) {
+					// Single font: only face 0 exists, whose directory is at the start
+					if (datalen < 4 || MU_RBEU32(data) != 0x74746366) {
+						if (face_index != 0) {
+							return MUTT_INVALID_COLLECTION_FACE_INDEX;
+						}
+						*offset = 0;
+						return MUTT_SUCCESS;
+					}
+
+					// Get face count
+					uint32_m num_faces;
+					muttResult res = mutt_CollectionFaces(data, datalen, &num_faces);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+					// Verify face index
+					if (face_index >= num_faces) {
+						return MUTT_INVALID_COLLECTION_FACE_INDEX;
+					}
+
+					// Read offset from tableDirectoryOffsets
+					*offset = MU_RBEU32(data+12+face_index*4);
+					return MUTT_SUCCESS;
+				}
+
+				// Loads the table directory at a given offset
 				// Note: if fails, still call mutt_DeloadTableDirectory
-				muttResult mutt_LoadTableDirectory(muttDirectory* dir, muByte* data, uint64_m datalen) {
+				muttResult mutt_LoadTableDirectory(muttFont* font, muttDirectory* dir, muByte* data, uint64_m datalen, uint32_m offset, muBool verify_checksums) {
+					// (Table record offsets are relative to the start of the file)
 					muByte* orig_data = data;
 
 					// Verify min. length
-					if (datalen < 12) {
+					if (datalen < ((uint64_m)offset)+12) {
 						return MUTT_INVALID_DIRECTORY_LENGTH;
 					}
+					data += offset;
 
 					// Read & verify sfntVersion
 					if (MU_RBEU32(data) != 0x00010000) {
@@ -15812,12 +17088,12 @@ All mu libraries included in muSDK have name functions to convert some of their
 					}
 
 					// Verify length based on numTables
-					if (datalen < (uint64_m)(12+(dir->num_tables*16))) {
+					if (datalen < ((uint64_m)offset)+(uint64_m)(12+(dir->num_tables*16))) {
 						return MUTT_INVALID_DIRECTORY_LENGTH;
 					}
 
 					// Allocate table records
-					dir->records = (muttTableRecord*)mu_malloc(sizeof(muttTableRecord)*dir->num_tables);
+					dir->records = (muttTableRecord*)mutt_Malloc(font->allocator, sizeof(muttTableRecord)*dir->num_tables);
 					if (!dir->records) {
 						return MUTT_FAILED_MALLOC;
 					}
@@ -15876,7 +17152,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 						// Verify checksum
 						// Note: we're not performing this for head, its checksum HAS a checksum in it so it's weird
-						if (rec->table_tag_u32 != 0x68656164 &&
+						if (verify_checksums && rec->table_tag_u32 != 0x68656164 &&
 							!mutt_VerifyTableChecksum(&orig_data[rec->offset], rec->length, rec->checksum)
 						) {
 							return MUTT_INVALID_DIRECTORY_RECORD_CHECKSUM;
@@ -15895,10 +17171,10 @@ All mu libraries included in muSDK have name functions to convert some of their
 				}
 
 				// Deloads the table directory
-				void mutt_DeloadTableDirectory(muttDirectory* dir) {
+				void mutt_DeloadTableDirectory(muttFont* font, muttDirectory* dir) {
 					// Free table records if they exist
 					if (dir->records) {
-						mu_free(dir->records);
+						mutt_Free(font->allocator, dir->records);
 					}
 				}
 
@@ -15907,40 +17183,40 @@ All mu libraries included in muSDK have name functions to convert some of their
 				// Loads the maxp table
 				muttResult mutt_LoadMaxp(muttFont* font, muByte* data, uint32_m datalen) {
 					// Allocate maxp
-					muttMaxp* maxp = (muttMaxp*)mu_malloc(sizeof(muttMaxp));
+					muttMaxp* maxp = (muttMaxp*)mutt_Malloc(font->allocator, sizeof(muttMaxp));
 					if (!maxp) {
 						return MUTT_FAILED_MALLOC;
 					}
 
 					// Verify min. length for version
 					if (datalen < 4) {
-						mu_free(maxp);
+						mutt_Free(font->allocator, maxp);
 						return MUTT_INVALID_MAXP_LENGTH;
 					}
 
 					// Version high
 					maxp->version_high = MU_RBEU16(data);
 					if (maxp->version_high != 0x0001) {
-						mu_free(maxp);
+						mutt_Free(font->allocator, maxp);
 						return MUTT_INVALID_MAXP_VERSION;
 					}
 					// Version low
 					maxp->version_low = MU_RBEU16(data+2);
 					if (maxp->version_low != 0x0000) {
-						mu_free(maxp);
+						mutt_Free(font->allocator, maxp);
 						return MUTT_INVALID_MAXP_VERSION;
 					}
 
 					// Verify min. length
 					if (datalen < 32) {
-						mu_free(maxp);
+						mutt_Free(font->allocator, maxp);
 						return MUTT_INVALID_MAXP_LENGTH;
 					}
 
 					// numGlyphs
 					maxp->num_glyphs = MU_RBEU16(data+4);
 					if (maxp->num_glyphs < 2) {
-						mu_free(maxp);
+						mutt_Free(font->allocator, maxp);
 						return MUTT_INVALID_MAXP_NUM_GLYPHS;
 					}
 
@@ -15955,7 +17231,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// maxZones
 					maxp->max_zones = MU_RBEU16(data+14);
 					if (maxp->max_zones != 1 && maxp->max_zones != 2) {
-						mu_free(maxp);
+						mutt_Free(font->allocator, maxp);
 						return MUTT_INVALID_MAXP_MAX_ZONES;
 					}
 					// maxTwilightPoints
@@ -15982,26 +17258,26 @@ All mu libraries included in muSDK have name functions to convert some of their
 				// Loads the head table
 				muttResult mutt_LoadHead(muttFont* font, muByte* data, uint32_m datalen) {
 					// Allocate head
-					muttHead* head = (muttHead*)mu_malloc(sizeof(muttHead));
+					muttHead* head = (muttHead*)mutt_Malloc(font->allocator, sizeof(muttHead));
 					if (!head) {
 						return MUTT_FAILED_MALLOC;
 					}
 
 					// Verify min. length for version
 					if (datalen < 4) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_LENGTH;
 					}
 
 					// Verify version
 					if (MU_RBEU16(data) != 1 || MU_RBEU16(data+2) != 0) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_VERSION;
 					}
 
 					// Verify min. length for rest of table
 					if (datalen < 54) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_LENGTH;
 					}
 
@@ -16013,7 +17289,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 					// magicNumber
 					if (MU_RBEU32(data+12) != 0x5F0F3CF5) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_MAGIC_NUMBER;
 					}
 
@@ -16023,7 +17299,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// unitsPerEm
 					head->units_per_em = MU_RBEU16(data+18);
 					if (head->units_per_em < 16 || head->units_per_em > 16384) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_UNITS_PER_EM;
 					}
 
@@ -16034,32 +17310,32 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// xMin + yMin
 					head->x_min = MU_RBES16(data+36);
 					if (head->x_min < -16384 || head->x_min > 16383) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_X_MIN_COORDINATES;
 					}
 					head->y_min = MU_RBES16(data+38);
 					if (head->y_min < -16384 || head->y_min > 16383) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_Y_MIN_COORDINATES;
 					}
 					// xMax + yMax
 					head->x_max = MU_RBES16(data+40);
 					if (head->x_max < -16384 || head->x_max > 16383) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_X_MAX_COORDINATES;
 					}
 					head->y_max = MU_RBES16(data+42);
 					if (head->y_max < -16384 || head->y_max > 16383) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_Y_MAX_COORDINATES;
 					}
 					// + Verify min/max
 					if (head->x_min > head->x_max) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_X_MIN_MAX;
 					}
 					if (head->y_min > head->y_max) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_Y_MIN_MAX;
 					}
 
@@ -16072,13 +17348,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// indexToLocFormat
 					head->index_to_loc_format = MU_RBES16(data+50);
 					if (head->index_to_loc_format != 0 && head->index_to_loc_format != 1) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_INDEX_TO_LOC_FORMAT;
 					}
 
 					// glyphDataFormat
 					if (MU_RBES16(data+52) != 0) {
-						mu_free(head);
+						mutt_Free(font->allocator, head);
 						return MUTT_INVALID_HEAD_GLYPH_DATA_FORMAT;
 					}
 
@@ -16090,26 +17366,26 @@ All mu libraries included in muSDK have name functions to convert some of their
 				// Req: maxp
 				muttResult mutt_LoadHhea(muttFont* font, muByte* data, uint32_m datalen) {
 					// Allocate hhea
-					muttHhea* hhea = (muttHhea*)mu_malloc(sizeof(muttHhea));
+					muttHhea* hhea = (muttHhea*)mutt_Malloc(font->allocator, sizeof(muttHhea));
 					if (!hhea) {
 						return MUTT_FAILED_MALLOC;
 					}
 
 					// Verify min. length for version
 					if (datalen < 4) {
-						mu_free(hhea);
+						mutt_Free(font->allocator, hhea);
 						return MUTT_INVALID_HHEA_LENGTH;
 					}
 
 					// Verify version
 					if (MU_RBEU16(data) != 1 || MU_RBEU16(data+2) != 0) {
-						mu_free(hhea);
+						mutt_Free(font->allocator, hhea);
 						return MUTT_INVALID_HHEA_VERSION;
 					}
 
 					// Verify min. length
 					if (datalen < 36) {
-						mu_free(hhea);
+						mutt_Free(font->allocator, hhea);
 						return MUTT_INVALID_HHEA_LENGTH;
 					}
 
@@ -16133,7 +17409,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 					// metricDataFormat
 					if (MU_RBES16(data+32) != 0) {
-						mu_free(hhea);
+						mutt_Free(font->allocator, hhea);
 						return MUTT_INVALID_HHEA_METRIC_DATA_FORMAT;
 					}
 
@@ -16141,7 +17417,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 					hhea->number_of_hmetrics = MU_RBEU16(data+34);
 					// - numGlyphs-numberOfHMetrics must be valid for leftSideBearings in hmtx
 					if (hhea->number_of_hmetrics > font->maxp->num_glyphs) {
-						mu_free(hhea);
+						mutt_Free(font->allocator, hhea);
 						return MUTT_INVALID_HHEA_NUMBER_OF_HMETRICS;
 					}
 
@@ -16153,7 +17429,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 				// Loads the hmtx table
 				// Req: maxp, hhea
-				void mutt_DeloadHmtx(muttHmtx* hmtx);
+				void mutt_DeloadHmtx(muttFont* font, muttHmtx* hmtx);
 				muttResult mutt_LoadHmtx(muttFont* font, muByte* data, uint32_m datalen) {
 					// Verify length
 					if (datalen <
@@ -16166,21 +17442,23 @@ All mu libraries included in muSDK have name functions to convert some of their
 					}
 
 					// Allocate
-					muttHmtx* hmtx = (muttHmtx*)mu_malloc(sizeof(muttHmtx));
+					muttHmtx* hmtx = (muttHmtx*)mutt_Malloc(font->allocator, sizeof(muttHmtx));
 					if (!hmtx) {
-						// mutt_DeloadHmtx(hmtx);
+						// mutt_DeloadHmtx(font, hmtx);
 						return MUTT_FAILED_MALLOC;
 					}
 					hmtx->hmetrics = 0;
 					hmtx->left_side_bearings = 0;
+					hmtx->advance_widths = 0;
+					hmtx->lsbs = 0;
 
 					// Allocate hMetrics
 					if (font->hhea->number_of_hmetrics == 0) {
 						hmtx->hmetrics = 0;
 					} else {
-						hmtx->hmetrics = (muttLongHorMetric*)mu_malloc(sizeof(muttLongHorMetric)*font->hhea->number_of_hmetrics);
+						hmtx->hmetrics = (muttLongHorMetric*)mutt_Malloc(font->allocator, sizeof(muttLongHorMetric)*font->hhea->number_of_hmetrics);
 						if (!hmtx->hmetrics) {
-							mutt_DeloadHmtx(hmtx);
+							mutt_DeloadHmtx(font, hmtx);
 							return MUTT_FAILED_MALLOC;
 						}
 					}
@@ -16190,9 +17468,9 @@ All mu libraries included in muSDK have name functions to convert some of their
 					if (lsb_len == 0) {
 						hmtx->left_side_bearings = 0;
 					} else {
-						hmtx->left_side_bearings = (int16_m*)mu_malloc(lsb_len*2);
+						hmtx->left_side_bearings = (int16_m*)mutt_Malloc(font->allocator, lsb_len*2);
 						if (!hmtx->left_side_bearings) {
-							mutt_DeloadHmtx(hmtx);
+							mutt_DeloadHmtx(font, hmtx);
 							return MUTT_FAILED_MALLOC;
 						}
 					}
@@ -16215,31 +17493,59 @@ All mu libraries included in muSDK have name functions to convert some of their
 						data += 2;
 					}
 
+					// Expand into per-glyph arrays
+					if (font->maxp->num_glyphs != 0) {
+						// - Allocate
+						hmtx->advance_widths = (uint16_m*)mutt_Malloc(font->allocator, font->maxp->num_glyphs*2);
+						hmtx->lsbs = (int16_m*)mutt_Malloc(font->allocator, font->maxp->num_glyphs*2);
+						if (!hmtx->advance_widths || !hmtx->lsbs) {
+							mutt_DeloadHmtx(font, hmtx);
+							return MUTT_FAILED_MALLOC;
+						}
+						// - Glyphs within hMetrics
+						for (uint16_m h = 0; h < font->hhea->number_of_hmetrics; ++h) {
+							hmtx->advance_widths[h] = hmtx->hmetrics[h].advance_width;
+							hmtx->lsbs[h] = hmtx->hmetrics[h].lsb;
+						}
+						// - Glyphs within leftSideBearings (advance width is last advance width)
+						uint16_m last_advance = (font->hhea->number_of_hmetrics > 0) ?(hmtx->hmetrics[font->hhea->number_of_hmetrics-1].advance_width) :(0);
+						for (uint16_m l = 0; l < lsb_len; ++l) {
+							hmtx->advance_widths[font->hhea->number_of_hmetrics+l] = last_advance;
+							hmtx->lsbs[font->hhea->number_of_hmetrics+l] = hmtx->left_side_bearings[l];
+						}
+					}
+
 					font->hmtx = hmtx;
 					return MUTT_SUCCESS;
 				}
 
 				// Deloads the hmtx table
-				void mutt_DeloadHmtx(muttHmtx* hmtx) {
+				void mutt_DeloadHmtx(muttFont* font, muttHmtx* hmtx) {
 					if (hmtx) {
 						if (hmtx->hmetrics) {
-							mu_free(hmtx->hmetrics);
+							mutt_Free(font->allocator, hmtx->hmetrics);
 						}
 						if (hmtx->left_side_bearings) {
-							mu_free(hmtx->left_side_bearings);
+							mutt_Free(font->allocator, hmtx->left_side_bearings);
+						}
+						if (hmtx->advance_widths) {
+							mutt_Free(font->allocator, hmtx->advance_widths);
 						}
-						mu_free(hmtx);
+						if (hmtx->lsbs) {
+							mutt_Free(font->allocator, hmtx->lsbs);
+						}
+						mutt_Free(font->allocator, hmtx);
 					}
 				}
 
 				// Loads the loca table
 				// Req: maxp, head, glyf
-				void mutt_DeloadLoca(muttLoca* loca);
+				void mutt_DeloadLoca(muttFont* font, muttLoca* loca);
 				muttResult mutt_LoadLoca(muttFont* font, muByte* data, uint32_m datalen) {
 					// Allocate
-					muttLoca* loca = (muttLoca*)mu_malloc(sizeof(muttLoca));
+					muttLoca* loca = (muttLoca*)mutt_Malloc(font->allocator, sizeof(muttLoca));
 					if (!loca) {
-						// mutt_DeloadLoca(loca);
+						// mutt_DeloadLoca(font, loca);
 						return MUTT_FAILED_MALLOC;
 					}
 					mu_memset(loca, 0, sizeof(muttLoca));
@@ -16252,13 +17558,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 					if (font->head->index_to_loc_format == MUTT_OFFSET_16) {
 						// - Verify 16-bit length
 						if (datalen < offsets*2) {
-							mutt_DeloadLoca(loca);
+							mutt_DeloadLoca(font, loca);
 							return MUTT_INVALID_LOCA_LENGTH;
 						}
 						// - Allocate
-						loca->offsets16 = (uint16_m*)mu_malloc(offsets*2);
+						loca->offsets16 = (uint16_m*)mutt_Malloc(font->allocator, offsets*2);
 						if (!loca->offsets16) {
-							mutt_DeloadLoca(loca);
+							mutt_DeloadLoca(font, loca);
 							return MUTT_FAILED_MALLOC;
 						}
 					}
@@ -16266,13 +17572,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 					else {
 						// - Verify 32-bit length
 						if (datalen < offsets*4) {
-							mutt_DeloadLoca(loca);
+							mutt_DeloadLoca(font, loca);
 							return MUTT_INVALID_LOCA_LENGTH;
 						}
 						// - Allocate
-						loca->offsets32 = (uint32_m*)mu_malloc(offsets*4);
+						loca->offsets32 = (uint32_m*)mutt_Malloc(font->allocator, offsets*4);
 						if (!loca->offsets32) {
-							mutt_DeloadLoca(loca);
+							mutt_DeloadLoca(font, loca);
 							return MUTT_FAILED_MALLOC;
 						}
 					}
@@ -16286,13 +17592,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 							data += 2;
 							// Verify incremental order
 							if (o > 0 && loca->offsets16[o-1] > loca->offsets16[o]) {
-								mutt_DeloadLoca(loca);
+								mutt_DeloadLoca(font, loca);
 								return MUTT_INVALID_LOCA_OFFSET;
 							}
 							// Verify offset is within range of glyf
 							uint32_m offset = ((uint32_m)loca->offsets16[o]) * 2;
 							if (offset > font->glyf->len) {
-								mutt_DeloadLoca(loca);
+								mutt_DeloadLoca(font, loca);
 								return MUTT_INVALID_LOCA_OFFSET;
 							}
 						}
@@ -16305,12 +17611,12 @@ All mu libraries included in muSDK have name functions to convert some of their
 							data += 4;
 							// Verify incremental order
 							if (o > 0 && loca->offsets32[o-1] > loca->offsets32[o]) {
-								mutt_DeloadLoca(loca);
+								mutt_DeloadLoca(font, loca);
 								return MUTT_INVALID_LOCA_OFFSET;
 							}
 							// Verify offset is within range of glyf
 							if (loca->offsets32[o] > font->glyf->len) {
-								mutt_DeloadLoca(loca);
+								mutt_DeloadLoca(font, loca);
 								return MUTT_INVALID_LOCA_OFFSET;
 							}
 						}
@@ -16321,42 +17627,388 @@ All mu libraries included in muSDK have name functions to convert some of their
 				}
 
 				// Deloads the loca table
-				void mutt_DeloadLoca(muttLoca* loca) {
+				void mutt_DeloadLoca(muttFont* font, muttLoca* loca) {
 					if (loca) {
 						// I THINK this works with 32 as well...
 						if (loca->offsets16) {
-							mu_free(loca->offsets16);
+							mutt_Free(font->allocator, loca->offsets16);
+						}
+						mutt_Free(font->allocator, loca);
+					}
+				}
+
+				// Standard Macintosh glyph names, in order
+				static const char* mutt_MacGlyphNames[258] = {
+					".notdef", ".null", "nonmarkingreturn", "space", "exclam", "quotedbl", "numbersign", "dollar",
+					"percent", "ampersand", "quotesingle", "parenleft", "parenright", "asterisk", "plus", "comma",
+					"hyphen", "period", "slash", "zero", "one", "two", "three", "four",
+					"five", "six", "seven", "eight", "nine", "colon", "semicolon", "less",
+					"equal", "greater", "question", "at", "A", "B", "C", "D",
+					"E", "F", "G", "H", "I", "J", "K", "L",
+					"M", "N", "O", "P", "Q", "R", "S", "T",
+					"U", "V", "W", "X", "Y", "Z", "bracketleft", "backslash",
+					"bracketright", "asciicircum", "underscore", "grave", "a", "b", "c", "d",
+					"e", "f", "g", "h", "i", "j", "k", "l",
+					"m", "n", "o", "p", "q", "r", "s", "t",
+					"u", "v", "w", "x", "y", "z", "braceleft", "bar",
+					"braceright", "asciitilde", "Adieresis", "Aring", "Ccedilla", "Eacute", "Ntilde", "Odieresis",
+					"Udieresis", "aacute", "agrave", "acircumflex", "adieresis", "atilde", "aring", "ccedilla",
+					"eacute", "egrave", "ecircumflex", "edieresis", "iacute", "igrave", "icircumflex", "idieresis",
+					"ntilde", "oacute", "ograve", "ocircumflex", "odieresis", "otilde", "uacute", "ugrave",
+					"ucircumflex", "udieresis", "dagger", "degree", "cent", "sterling", "section", "bullet",
+					"paragraph", "germandbls", "registered", "copyright", "trademark", "acute", "dieresis", "notequal",
+					"AE", "Oslash", "infinity", "plusminus", "lessequal", "greaterequal", "yen", "mu",
+					"partialdiff", "summation", "product", "pi", "integral", "ordfeminine", "ordmasculine", "Omega",
+					"ae", "oslash", "questiondown", "exclamdown", "logicalnot", "radical", "florin", "approxequal",
+					"Delta", "guillemotleft", "guillemotright", "ellipsis", "nonbreakingspace", "Agrave", "Atilde", "Otilde",
+					"OE", "oe", "endash", "emdash", "quotedblleft", "quotedblright", "quoteleft", "quoteright",
+					"divide", "lozenge", "ydieresis", "Ydieresis", "fraction", "currency", "guilsinglleft", "guilsinglright",
+					"fi", "fl", "daggerdbl", "periodcentered", "quotesinglbase", "quotedblbase", "perthousand", "Acircumflex",
+					"Ecircumflex", "Aacute", "Edieresis", "Egrave", "Iacute", "Icircumflex", "Idieresis", "Igrave",
+					"Oacute", "Ocircumflex", "apple", "Ograve", "Uacute", "Ucircumflex", "Ugrave", "dotlessi",
+					"circumflex", "tilde", "macron", "breve", "dotaccent", "ring", "cedilla", "hungarumlaut",
+					"ogonek", "caron", "Lslash", "lslash", "Scaron", "scaron", "Zcaron", "zcaron",
+					"brokenbar", "Eth", "eth", "Yacute", "yacute", "Thorn", "thorn", "minus",
+					"multiply", "onesuperior", "twosuperior", "threesuperior", "onehalf", "onequarter", "threequarters", "franc",
+					"Gbreve", "gbreve", "Idotaccent", "Scedilla", "scedilla", "Cacute", "cacute", "Ccaron",
+					"ccaron", "dcroat"
+				};
+
+				MUDEF const char* mutt_standard_glyph_name(uint16_m index) {
+					if (index >= 258) {
+						return 0;
+					}
+					return mutt_MacGlyphNames[index];
+				}
+
+				MUDEF uint32_m mutt_glyph_name_hash(const muByte* name, uint8_m length) {
+					// (FNV-1a)
+					uint32_m h = 0x811C9DC5;
+					for (uint8_m i = 0; i < length; ++i) {
+						h = (h ^ name[i]) * 0x01000193;
+					}
+					return h;
+				}
+
+				// Gets the name of a glyph from a loaded post table; 0 if it has none
+				const muByte* mutt_PostGlyphName(muttPost* post, uint16_m glyph_id, uint8_m* length) {
+					if (glyph_id >= post->num_glyphs) {
+						return 0;
+					}
+					uint16_m index = post->glyph_name_index[glyph_id];
+
+					// Standard name
+					if (index < 258) {
+						const char* name = mutt_MacGlyphNames[index];
+						uint8_m len = 0;
+						while (name[len]) {
+							++len;
+						}
+						*length = len;
+						return (const muByte*)name;
+					}
+
+					// Name stored in post (Pascal string)
+					muByte* name = post->names[index-258];
+					*length = name[0];
+					return name+1;
+				}
+
+				// Returns whether or not two names are the same
+				muBool mutt_GlyphNamesEqual(const muByte* a, uint8_m a_len, const muByte* b, uint8_m b_len) {
+					if (a_len != b_len) {
+						return MU_FALSE;
+					}
+					for (uint8_m i = 0; i < a_len; ++i) {
+						if (a[i] != b[i]) {
+							return MU_FALSE;
+						}
+					}
+					return MU_TRUE;
+				}
+
+				// Reads the names of a version 2 post table
+				// (Data is the start of the string data)
+				muttResult mutt_LoadPostNames(muttFont* font, muttPost* post, muByte* data, uint32_m datalen, muBool borrowed) {
+					// Count names
+					// (Names past index 32767 are reserved, so they're never referenced)
+					uint32_m num_names = 0;
+					uint32_m offset = 0;
+					while (offset < datalen && num_names < 32768-258) {
+						offset += 1 + data[offset];
+						// - Verify name is within the table
+						if (offset > datalen) {
+							return MUTT_INVALID_POST_LENGTH;
+						}
+						++num_names;
+					}
+					if (num_names == 0) {
+						return MUTT_SUCCESS;
+					}
+					post->num_names = (uint16_m)num_names;
+
+					// Allocate and fill string data (if necessary)
+					if (borrowed) {
+						post->string_data = data;
+					} else {
+						post->string_data = (muByte*)mutt_Malloc(font->allocator, offset);
+						if (!post->string_data) {
+							return MUTT_FAILED_MALLOC;
+						}
+						mu_memcpy(post->string_data, data, offset);
+					}
+
+					// Allocate and fill name pointers
+					post->names = (muByte**)mutt_Malloc(font->allocator, sizeof(muByte*)*num_names);
+					if (!post->names) {
+						return MUTT_FAILED_MALLOC;
+					}
+					offset = 0;
+					for (uint32_m n = 0; n < num_names; ++n) {
+						post->names[n] = post->string_data+offset;
+						offset += 1 + post->string_data[offset];
+					}
+					return MUTT_SUCCESS;
+				}
+
+				// Builds the name lookup table of a post table
+				muttResult mutt_LoadPostLookup(muttFont* font, muttPost* post) {
+					if (post->num_glyphs == 0) {
+						return MUTT_SUCCESS;
+					}
+
+					// Allocate, keeping the table at most half full, and marking every
+					// slot as unused
+					uint32_m capacity = 8;
+					while (capacity < ((uint32_m)post->num_glyphs)*2) {
+						capacity <<= 1;
+					}
+					post->lookup = (uint16_m*)mutt_Malloc(font->allocator, sizeof(uint16_m)*capacity);
+					if (!post->lookup) {
+						return MUTT_FAILED_MALLOC;
+					}
+					mu_memset(post->lookup, 0xFF, sizeof(uint16_m)*capacity);
+					post->lookup_capacity = capacity;
+
+					// Add each glyph
+					uint32_m mask = capacity-1;
+					for (uint16_m g = 0; g < post->num_glyphs; ++g) {
+						uint8_m len;
+						const muByte* name = mutt_PostGlyphName(post, g, &len);
+						uint32_m i = mutt_glyph_name_hash(name, len) & mask;
+
+						// Find unused slot, skipping if a glyph before it has the same name
+						muBool duplicate = MU_FALSE;
+						while (post->lookup[i] != 0xFFFF) {
+							uint8_m other_len;
+							const muByte* other = mutt_PostGlyphName(post, post->lookup[i], &other_len);
+							if (mutt_GlyphNamesEqual(name, len, other, other_len)) {
+								duplicate = MU_TRUE;
+								break;
+							}
+							i = (i+1) & mask;
+						}
+						if (!duplicate) {
+							post->lookup[i] = g;
+						}
+					}
+					return MUTT_SUCCESS;
+				}
+
+				// Loads the post table
+				void mutt_DeloadPost(muttFont* font, muttPost* post, muBool borrowed);
+				muttResult mutt_LoadPost(muttFont* font, muByte* data, uint32_m datalen) {
+					// Verify length for header
+					if (datalen < 32) {
+						return MUTT_INVALID_POST_LENGTH;
+					}
+
+					// Verify version
+					uint16_m version_high = MU_RBEU16(data);
+					uint16_m version_low = MU_RBEU16(data+2);
+					if (
+						(version_high < 1 || version_high > 3)
+						|| (version_low != 0 && !(version_high == 2 && version_low == 0x5000))
+					) {
+						return MUTT_INVALID_POST_VERSION;
+					}
+
+					// Allocate
+					muttPost* post = (muttPost*)mutt_Malloc(font->allocator, sizeof(muttPost));
+					if (!post) {
+						return MUTT_FAILED_MALLOC;
+					}
+					mu_memset(post, 0, sizeof(muttPost));
+					// Whether or not string data points into the font data
+					muBool borrowed = (font->load_flags & MUTT_LOAD_NO_COPY) != 0;
+
+					// Read header
+					post->version_high = version_high;
+					post->version_low = version_low;
+					post->italic_angle_high = MU_RBES16(data+4);
+					post->italic_angle_low = MU_RBEU16(data+6);
+					post->underline_position = MU_RBES16(data+8);
+					post->underline_thickness = MU_RBES16(data+10);
+					post->is_fixed_pitch = MU_RBEU32(data+12);
+					post->min_mem_type42 = MU_RBEU32(data+16);
+					post->max_mem_type42 = MU_RBEU32(data+20);
+					post->min_mem_type1 = MU_RBEU32(data+24);
+					post->max_mem_type1 = MU_RBEU32(data+28);
+
+					// Version 1: standard names in order
+					if (version_high == 1) {
+						post->num_glyphs = (font->maxp->num_glyphs < 258) ?(font->maxp->num_glyphs) :(258);
+					}
+					// Version 2 / 2.5: read and verify numGlyphs
+					else if (version_high == 2) {
+						if (datalen < 34) {
+							mutt_DeloadPost(font, post, borrowed);
+							return MUTT_INVALID_POST_LENGTH;
+						}
+						post->num_glyphs = MU_RBEU16(data+32);
+						if (post->num_glyphs != font->maxp->num_glyphs) {
+							mutt_DeloadPost(font, post, borrowed);
+							return MUTT_INVALID_POST_NUM_GLYPHS;
+						}
+						// Verify length for glyphNameIndex / offset
+						uint32_m index_len = ((uint32_m)post->num_glyphs) * ((version_low == 0) ?(2) :(1));
+						if (datalen < 34+index_len) {
+							mutt_DeloadPost(font, post, borrowed);
+							return MUTT_INVALID_POST_LENGTH;
+						}
+
+						// Read names (version 2)
+						if (version_low == 0) {
+							muttResult res = mutt_LoadPostNames(font, post, data+34+index_len, datalen-34-index_len, borrowed);
+							if (mutt_result_is_fatal(res)) {
+								mutt_DeloadPost(font, post, borrowed);
+								return res;
+							}
+						}
+					}
+
+					// Allocate glyph name index
+					if (post->num_glyphs) {
+						post->glyph_name_index = (uint16_m*)mutt_Malloc(font->allocator, sizeof(uint16_m)*post->num_glyphs);
+						if (!post->glyph_name_index) {
+							mutt_DeloadPost(font, post, borrowed);
+							return MUTT_FAILED_MALLOC;
+						}
+					}
+
+					// Fill glyph name index
+					for (uint16_m g = 0; g < post->num_glyphs; ++g) {
+						uint32_m index;
+						// - Version 1
+						if (version_high == 1) {
+							index = g;
+						}
+						// - Version 2
+						else if (version_low == 0) {
+							index = MU_RBEU16(data+34+g*2);
+						}
+						// - Version 2.5 (offset from glyph ID)
+						else {
+							int32_m offset = (int32_m)g + (int32_m)MU_RBES8(data+34+g);
+							index = (offset < 0) ?(0xFFFFFFFF) :((uint32_m)offset);
+						}
+
+						// Verify index
+						if (index >= 258+((uint32_m)post->num_names)) {
+							mutt_DeloadPost(font, post, borrowed);
+							return MUTT_INVALID_POST_GLYPH_NAME_INDEX;
+						}
+						post->glyph_name_index[g] = (uint16_m)index;
+					}
+
+					// Build name lookup table
+					muttResult res = mutt_LoadPostLookup(font, post);
+					if (mutt_result_is_fatal(res)) {
+						mutt_DeloadPost(font, post, borrowed);
+						return res;
+					}
+
+					font->post = post;
+					return MUTT_SUCCESS;
+				}
+
+				// Frees all allocated data for post
+				// (string data isn't freed if it was borrowed from the font data)
+				void mutt_DeloadPost(muttFont* font, muttPost* post, muBool borrowed) {
+					if (post) {
+						if (post->glyph_name_index) {
+							mutt_Free(font->allocator, post->glyph_name_index);
+						}
+						if (post->names) {
+							mutt_Free(font->allocator, post->names);
+						}
+						if (post->string_data && !borrowed) {
+							mutt_Free(font->allocator, post->string_data);
+						}
+						if (post->lookup) {
+							mutt_Free(font->allocator, post->lookup);
 						}
-						mu_free(loca);
+						mutt_Free(font->allocator, post);
 					}
 				}
 
+				MUDEF const muByte* mutt_get_glyph_name(muttFont* font, uint16_m glyph_id, uint8_m* length) {
+					MUTT_LAZY_LOAD(font, MUTT_LOAD_POST)
+					if (!font->post) {
+						return 0;
+					}
+					return mutt_PostGlyphName(font->post, glyph_id, length);
+				}
+
+				MUDEF uint16_m mutt_get_glyph_by_name(muttFont* font, const muByte* name, uint8_m length) {
+					MUTT_LAZY_LOAD(font, MUTT_LOAD_POST)
+					muttPost* post = font->post;
+					if (!post || !post->lookup) {
+						return 0;
+					}
+
+					// Probe until an unused slot
+					uint32_m mask = post->lookup_capacity-1;
+					uint32_m i = mutt_glyph_name_hash(name, length) & mask;
+					while (post->lookup[i] != 0xFFFF) {
+						uint8_m glyph_len;
+						const muByte* glyph_name = mutt_PostGlyphName(post, post->lookup[i], &glyph_len);
+						if (mutt_GlyphNamesEqual(name, length, glyph_name, glyph_len)) {
+							return post->lookup[i];
+						}
+						i = (i+1) & mask;
+					}
+					return 0;
+				}
+
 				// Loads the name table
-				void mutt_DeloadName(muttName* name);
+				void mutt_DeloadName(muttFont* font, muttName* name, muBool borrowed);
 				muttResult mutt_LoadName(muttFont* font, muByte* data, uint32_m datalen) {
 					// Allocate
-					muttName* name = (muttName*)mu_malloc(sizeof(muttName));
+					muttName* name = (muttName*)mutt_Malloc(font->allocator, sizeof(muttName));
 					if (!name) {
 						return MUTT_FAILED_MALLOC;
 					}
 					mu_memset(name, 0, sizeof(muttName));
+					// Whether or not string data points into the font data
+					muBool borrowed = (font->load_flags & MUTT_LOAD_NO_COPY) != 0;
 
 					// Verify min. length for version
 					if (datalen < 2) {
-						mutt_DeloadName(name);
+						mutt_DeloadName(font, name, borrowed);
 						return MUTT_INVALID_NAME_LENGTH;
 					}
 
 					// Verify version
 					name->version = MU_RBEU16(data);
 					if (name->version != 0 && name->version != 1) {
-						mutt_DeloadName(name);
+						mutt_DeloadName(font, name, borrowed);
 						return MUTT_INVALID_NAME_VERSION;
 					}
 
 					// Verify min. length for version, count, and storage offset
 					if (datalen < 6) {
-						mutt_DeloadName(name);
+						mutt_DeloadName(font, name, borrowed);
 						return MUTT_INVALID_NAME_LENGTH;
 					}
 
@@ -16365,22 +18017,25 @@ All mu libraries included in muSDK have name functions to convert some of their
 					uint16_m storage_offset = MU_RBEU16(data+4);
 					// Verify length for storage offset
 					if (storage_offset > datalen) {
-						mutt_DeloadName(name);
+						mutt_DeloadName(font, name, borrowed);
 						return MUTT_INVALID_NAME_STORAGE_OFFSET;
 					}
 					// Verify length for nameRecord and storage
 					uint32_m req = 6+(name->count*12)+(datalen-storage_offset);
 					if (datalen < req) {
-						mutt_DeloadName(name);
+						mutt_DeloadName(font, name, borrowed);
 						return MUTT_INVALID_NAME_LENGTH;
 					}
 
 					// Allocate and fill storage (if necessary)
 					uint32_m storage_len = datalen-storage_offset;
-					if (storage_len) {
-						name->string_data = (muByte*)mu_malloc(storage_len);
+					if (storage_len && borrowed) {
+						name->string_data = &data[storage_offset];
+					}
+					else if (storage_len) {
+						name->string_data = (muByte*)mutt_Malloc(font->allocator, storage_len);
 						if (!name->string_data) {
-							mutt_DeloadName(name);
+							mutt_DeloadName(font, name, borrowed);
 							return MUTT_FAILED_MALLOC;
 						}
 						mu_memcpy(name->string_data, &data[storage_offset], storage_len);
@@ -16392,9 +18047,9 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// If we have name records:
 					if (name->count) {
 						// Allocate name records
-						name->name_records = (muttNameRecord*)mu_malloc(sizeof(muttNameRecord)*((size_m)name->count));
+						name->name_records = (muttNameRecord*)mutt_Malloc(font->allocator, sizeof(muttNameRecord)*((size_m)name->count));
 						if (!name->name_records) {
-							mutt_DeloadName(name);
+							mutt_DeloadName(font, name, borrowed);
 							return MUTT_FAILED_MALLOC;
 						}
 
@@ -16412,7 +18067,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 							// Get & verify offset + length
 							uint16_m offset = MU_RBEU16(data+10);
 							if (offset+rp->length > storage_len) {
-								mutt_DeloadName(name);
+								mutt_DeloadName(font, name, borrowed);
 								return MUTT_INVALID_NAME_LENGTH_OFFSET;
 							}
 
@@ -16428,7 +18083,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 						// Verify length for langTagCount
 						req += 2;
 						if (datalen < req) {
-							mutt_DeloadName(name);
+							mutt_DeloadName(font, name, borrowed);
 							return MUTT_INVALID_NAME_LENGTH;
 						}
 						// Get langTagCount
@@ -16437,7 +18092,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 						// Verify length for langTagRecord
 						req += name->lang_tag_count*4;
 						if (datalen < req) {
-							mutt_DeloadName(name);
+							mutt_DeloadName(font, name, borrowed);
 							return MUTT_INVALID_NAME_LENGTH;
 						}
 					}
@@ -16445,9 +18100,9 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// If we have lang tags:
 					if (name->lang_tag_count) {
 						// Allocate lang tags
-						name->lang_tag_records = (muttLangTagRecord*)mu_malloc(sizeof(muttLangTagRecord)*((size_m)name->lang_tag_count));
+						name->lang_tag_records = (muttLangTagRecord*)mutt_Malloc(font->allocator, sizeof(muttLangTagRecord)*((size_m)name->lang_tag_count));
 						if (!name->lang_tag_records) {
-							mutt_DeloadName(name);
+							mutt_DeloadName(font, name, borrowed);
 							return MUTT_FAILED_MALLOC;
 						}
 
@@ -16461,7 +18116,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 							// Get & verify offset + length
 							uint16_m offset = MU_RBEU16(data+2);
 							if (offset+lr->length > storage_len) {
-								mutt_DeloadName(name);
+								mutt_DeloadName(font, name, borrowed);
 								return MUTT_INVALID_NAME_LENGTH_OFFSET;
 							}
 
@@ -16477,26 +18132,27 @@ All mu libraries included in muSDK have name functions to convert some of their
 				}
 
 				// Frees all allocated data for name
-				void mutt_DeloadName(muttName* name) {
+				// (string data isn't freed if it was borrowed from the font data)
+				void mutt_DeloadName(muttFont* font, muttName* name, muBool borrowed) {
 					if (name) {
 						if (name->name_records) {
-							mu_free(name->name_records);
+							mutt_Free(font->allocator, name->name_records);
 						}
 						if (name->lang_tag_records) {
-							mu_free(name->lang_tag_records);
+							mutt_Free(font->allocator, name->lang_tag_records);
 						}
-						if (name->string_data) {
-							mu_free(name->string_data);
+						if (name->string_data && !borrowed) {
+							mutt_Free(font->allocator, name->string_data);
 						}
-						mu_free(name);
+						mutt_Free(font->allocator, name);
 					}
 				}
 
 				// Loads the glyf table
-				void mutt_DeloadGlyf(muttGlyf* glyf);
+				void mutt_DeloadGlyf(muttFont* font, muttGlyf* glyf, muBool borrowed);
 				muttResult mutt_LoadGlyf(muttFont* font, muByte* data, uint32_m datalen) {
 					// Allocate glyf
-					muttGlyf* glyf = (muttGlyf*)mu_malloc(sizeof(muttGlyf));
+					muttGlyf* glyf = (muttGlyf*)mutt_Malloc(font->allocator, sizeof(muttGlyf));
 					if (!glyf) {
 						return MUTT_FAILED_MALLOC;
 					}
@@ -16505,11 +18161,15 @@ All mu libraries included in muSDK have name functions to convert some of their
 					// Get glyf length
 					glyf->len = datalen;
 
-					if (glyf->len) {
+					// Point to font data if we're not copying
+					if (glyf->len && (font->load_flags & MUTT_LOAD_NO_COPY)) {
+						glyf->data = data;
+					}
+					else if (glyf->len) {
 						// Allocate glyf data
-						glyf->data = (muByte*)mu_malloc(glyf->len);
+						glyf->data = (muByte*)mutt_Malloc(font->allocator, glyf->len);
 						if (!glyf->data) {
-							mutt_DeloadGlyf(glyf);
+							mutt_DeloadGlyf(font, glyf, MU_FALSE);
 							return MUTT_FAILED_MALLOC;
 						}
 
@@ -16522,12 +18182,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 				}
 
 				// Frees all allocated data for glyf
-				void mutt_DeloadGlyf(muttGlyf* glyf) {
+				// (data isn't freed if it was borrowed from the font data)
+				void mutt_DeloadGlyf(muttFont* font, muttGlyf* glyf, muBool borrowed) {
 					if (glyf) {
-						if (glyf->data) {
-							mu_free(glyf->data);
+						if (glyf->data && !borrowed) {
+							mutt_Free(font->allocator, glyf->data);
 						}
-						mu_free(glyf);
+						mutt_Free(font->allocator, glyf);
 					}
 				}
 
@@ -16582,7 +18243,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 				/* Format 4 */
 
 					// Loads format 4
-					void mutt_f4Deload(muttCmap4* f4);
+					void mutt_f4Deload(muttFont* font, muttCmap4* f4);
 					muttResult mutt_f4Load(muttFont* font, muttCmap4* f4, muByte* data, uint32_m datalen) {
 						// Verify length for format...rangeShift
 						// 32 is ok because length is u16 in subtable
@@ -16628,14 +18289,14 @@ All mu libraries included in muSDK have name functions to convert some of their
 						glyph_id_array_len /= 2;
 
 						// Allocate segments
-						f4->seg = (muttCmap4Segment*)mu_malloc(f4->seg_count*sizeof(muttCmap4Segment));
+						f4->seg = (muttCmap4Segment*)mutt_Malloc(font->allocator, f4->seg_count*sizeof(muttCmap4Segment));
 						if (!f4->seg) {
 							return MUTT_FAILED_MALLOC;
 						}
 						// Allocate glyph IDs
-						f4->glyph_ids = (uint16_m*)mu_malloc(glyph_id_array_len*2);
+						f4->glyph_ids = (uint16_m*)mutt_Malloc(font->allocator, glyph_id_array_len*2);
 						if (!f4->glyph_ids) {
-							mu_free(f4->seg);
+							mutt_Free(font->allocator, f4->seg);
 							return MUTT_FAILED_MALLOC;
 						}
 
@@ -16664,13 +18325,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 							// - Verify incremental
 							if (s > 0) {
 								if (ps->end_code <= (ps-1)->end_code) {
-									mutt_f4Deload(f4);
+									mutt_f4Deload(font, f4);
 									return MUTT_INVALID_CMAP4_END_CODE;
 								}
 							}
 							// - Verify last = 0xFFFF
 							if (s+1 == f4->seg_count && ps->end_code != 0xFFFF) {
-								mutt_f4Deload(f4);
+								mutt_f4Deload(font, f4);
 								return MUTT_INVALID_CMAP4_LAST_END_CODE;
 							}
 
@@ -16678,7 +18339,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 							ps->start_code = MU_RBEU16(start_code);
 							// - Verify startCode <= endCode
 							if (ps->start_code > ps->end_code) {
-								mutt_f4Deload(f4);
+								mutt_f4Deload(font, f4);
 								return MUTT_INVALID_CMAP4_START_CODE;
 							}
 
@@ -16693,7 +18354,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 								// - Divide by 2 to account for 2-byte-per offset
 								if ((ps->id_range_offset%2) != 0) {
 									// Not divisible by 2 :L
-									mutt_f4Deload(f4);
+									mutt_f4Deload(font, f4);
 									return MUTT_INVALID_CMAP4_ID_RANGE_OFFSET;
 								}
 								ps->id_range_offset /= 2;
@@ -16701,13 +18362,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 								//   (only applies if idRangeOffset is not 0)
 								if (ps->id_range_offset < f4->seg_count-s) {
 									// Offset is out of range (before glyphIdArray)
-									mutt_f4Deload(f4);
+									mutt_f4Deload(font, f4);
 									return MUTT_INVALID_CMAP4_ID_RANGE_OFFSET;
 								}
 								ps->id_range_offset -= f4->seg_count-s;
 								// - Ensure within range of glyphIdArray at max distance from it
 								if (ps->id_range_offset + (ps->start_code - ps->end_code) >= glyph_id_array_len) {
-									mutt_f4Deload(f4);
+									mutt_f4Deload(font, f4);
 									return MUTT_INVALID_CMAP4_ID_RANGE_OFFSET;
 								}
 
@@ -16744,13 +18405,13 @@ All mu libraries included in muSDK have name functions to convert some of their
 					}
 
 					// Deloads format 4
-					void mutt_f4Deload(muttCmap4* f4) {
+					void mutt_f4Deload(muttFont* font, muttCmap4* f4) {
 						if (f4) {
 							if (f4->seg) {
-								mu_free(f4->seg);
+								mutt_Free(font->allocator, f4->seg);
 							}
 							if (f4->glyph_ids) {
-								mu_free(f4->glyph_ids);
+								mutt_Free(font->allocator, f4->glyph_ids);
 							}
 							// (Purposely not freeing f4)
 						}
@@ -16758,38 +18419,42 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 					// Codepoint -> glyph ID
 					MUDEF uint16_m mutt_cmap4_get_glyph(muttFont* font, muttCmap4* f4, uint16_m codepoint) {
-						// Loop through each segment
-						for (uint16_m s = 0; s < f4->seg_count; ++s) {
-							// Continue on if the codepoint is not within this segment
-							if (codepoint < f4->seg[s].start_code || codepoint > f4->seg[s].end_code) {
-								continue;
+						// Binary search for the first segment whose end code is at least the codepoint
+						// (End codes are verified to be incremental in mutt_f4Load)
+						uint16_m lo = 0, hi = f4->seg_count;
+						while (lo < hi) {
+							uint16_m mid = lo + ((hi-lo) / 2);
+							if (f4->seg[mid].end_code < codepoint) {
+								lo = mid+1;
+							} else {
+								hi = mid;
 							}
-							// If we're here, the segment contains our codepoint
-							uint16_m glyph;
-							muttCmap4Segment* seg = &f4->seg[s];
+						}
+						// Codepoint does not lie within a defined segment
+						if (lo == f4->seg_count || codepoint < f4->seg[lo].start_code) {
+							return 0;
+						}
 
-							// If idRangeOffset is 0, we're only performing delta logic
-							if (seg->id_range_offset_orig == 0) {
-								glyph = mutt_id_delta(codepoint, seg->id_delta);
-							}
-							// If idRangeOffset isn't 0, we must index into glyphIdArray
-							else {
-								// (This is verified to be valid in mutt_f4Load)
-								glyph = f4->glyph_ids[seg->id_range_offset+(codepoint-seg->start_code)];
-								// + idDelta if not 0
-								if (glyph != 0) {
-									glyph = mutt_id_delta(glyph, seg->id_delta);
-								}
-							}
+						// If we're here, the segment contains our codepoint
+						uint16_m glyph;
+						muttCmap4Segment* seg = &f4->seg[lo];
 
-							// Return glyph if it's valid and not 0
-							if (glyph < font->maxp->num_glyphs && glyph != 0) {
-								return glyph;
+						// If idRangeOffset is 0, we're only performing delta logic
+						if (seg->id_range_offset_orig == 0) {
+							glyph = mutt_id_delta(codepoint, seg->id_delta);
+						}
+						// If idRangeOffset isn't 0, we must index into glyphIdArray
+						else {
+							// (This is verified to be valid in mutt_f4Load)
+							glyph = f4->glyph_ids[seg->id_range_offset+(codepoint-seg->start_code)];
+							// + idDelta if not 0
+							if (glyph != 0) {
+								glyph = mutt_id_delta(glyph, seg->id_delta);
 							}
 						}
 
-						// Codepoint does not lie within a defined segment
-						return 0;
+						// Return glyph if it's valid
+						return (glyph < font->maxp->num_glyphs) ?(glyph) :(0);
 					}
 
 					// Glyph ID -> codepoint
@@ -16817,7 +18482,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 				/* Format 12 */
 
 					// Loads format 12
-					void mutt_f12Deload(muttCmap12* f12);
+					void mutt_f12Deload(muttFont* font, muttCmap12* f12);
 					muttResult mutt_f12Load(muttFont* font, muttCmap12* f12, muByte* data, uint32_m datalen) {
 						// Verify length for format...numGroups
 						uint64_m req = 16;
@@ -16847,7 +18512,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 							return MUTT_INVALID_CMAP12_LENGTH;
 						}
 						// Allocate groups
-						f12->groups = (muttCmap12Group*)mu_malloc(sizeof(muttCmap12Group)*f12->num_groups);
+						f12->groups = (muttCmap12Group*)mutt_Malloc(font->allocator, sizeof(muttCmap12Group)*f12->num_groups);
 						if (!f12->groups) {
 							return MUTT_FAILED_MALLOC;
 						}
@@ -16864,12 +18529,12 @@ All mu libraries included in muSDK have name functions to convert some of their
 							if (g > 0) {
 								// Verify incremental startCharCode ordering
 								if (f12->groups[g].start_char_code <= f12->groups[g-1].start_char_code) {
-									mutt_f12Deload(f12);
+									mutt_f12Deload(font, f12);
 									return MUTT_INVALID_CMAP12_START_CHAR_CODE;
 								}
 								// Verify [-1].end < [0].start
 								if (f12->groups[g-1].end_char_code >= f12->groups[g].start_char_code) {
-									mutt_f12Deload(f12);
+									mutt_f12Deload(font, f12);
 									return MUTT_INVALID_CMAP12_END_CHAR_CODE;
 								}
 							}
@@ -16884,32 +18549,35 @@ All mu libraries included in muSDK have name functions to convert some of their
 					}
 
 					// Deloads format 12
-					void mutt_f12Deload(muttCmap12* f12) {
+					void mutt_f12Deload(muttFont* font, muttCmap12* f12) {
 						if (f12->groups) {
-							mu_free(f12->groups);
+							mutt_Free(font->allocator, f12->groups);
 							// (Purposely not freeing f12)
 						}
 					}
 
 					// Codepoint -> glyph ID
 					MUDEF uint16_m mutt_cmap12_get_glyph(muttFont* font, muttCmap12* f12, uint32_m codepoint) {
-						// Loop through each group
-						for (uint32_m g = 0; g < f12->num_groups; ++g) {
-							// Pass if codepoint is not in range
-							if (codepoint < f12->groups[g].start_char_code || codepoint > f12->groups[g].end_char_code) {
-								continue;
-							}
-
-							// Get glyph ID via start glyph ID and distance from startCharCode
-							uint32_m glyph = f12->groups[g].start_glyph_id + (codepoint - f12->groups[g].start_char_code);
-							// Return if non-zero and in range
-							if (glyph != 0 && glyph < font->maxp->num_glyphs) {
-								return (uint16_m)glyph;
+						// Binary search for the first group whose endCharCode is at least the codepoint
+						// (Groups are verified to be incremental and non-overlapping in mutt_f12Load)
+						uint32_m lo = 0, hi = f12->num_groups;
+						while (lo < hi) {
+							uint32_m mid = lo + ((hi-lo) / 2);
+							if (f12->groups[mid].end_char_code < codepoint) {
+								lo = mid+1;
+							} else {
+								hi = mid;
 							}
 						}
+						// Codepoint is not in range of any group
+						if (lo == f12->num_groups || codepoint < f12->groups[lo].start_char_code) {
+							return 0;
+						}
 
-						// No good glyph value could be found
-						return 0;
+						// Get glyph ID via start glyph ID and distance from startCharCode
+						uint32_m glyph = f12->groups[lo].start_glyph_id + (codepoint - f12->groups[lo].start_char_code);
+						// Return if in range
+						return (glyph < font->maxp->num_glyphs) ?((uint16_m)glyph) :(0);
 					}
 
 					// Glyph ID -> codepoint
@@ -16945,14 +18613,14 @@ All mu libraries included in muSDK have name functions to convert some of their
 							// Format 0
 							case 0: {
 								// Allocate
-								pformat->f0 = (muttCmap0*)mu_malloc(sizeof(muttCmap0));
+								pformat->f0 = (muttCmap0*)mutt_Malloc(font->allocator, sizeof(muttCmap0));
 								if (!pformat->f0) {
 									return MUTT_FAILED_MALLOC;
 								}
 								// Load
 								muttResult res = mutt_f0Load(font, pformat->f0, data, datalen);
 								if (mutt_result_is_fatal(res)) {
-									mu_free(pformat->f0);
+									mutt_Free(font->allocator, pformat->f0);
 									pformat->f0 = 0;
 								}
 								return res;
@@ -16961,14 +18629,14 @@ All mu libraries included in muSDK have name functions to convert some of their
 							// Format 4
 							case 4: {
 								// Allocate
-								pformat->f4 = (muttCmap4*)mu_malloc(sizeof(muttCmap4));
+								pformat->f4 = (muttCmap4*)mutt_Malloc(font->allocator, sizeof(muttCmap4));
 								if (!pformat->f4) {
 									return MUTT_FAILED_MALLOC;
 								}
 								// Load
 								muttResult res = mutt_f4Load(font, pformat->f4, data, datalen);
 								if (mutt_result_is_fatal(res)) {
-									mu_free(pformat->f4);
+									mutt_Free(font->allocator, pformat->f4);
 									pformat->f4 = 0;
 								}
 								return res;
@@ -16977,14 +18645,14 @@ All mu libraries included in muSDK have name functions to convert some of their
 							// Format 12
 							case 12: {
 								// Allocate
-								pformat->f12 = (muttCmap12*)mu_malloc(sizeof(muttCmap12));
+								pformat->f12 = (muttCmap12*)mutt_Malloc(font->allocator, sizeof(muttCmap12));
 								if (!pformat->f12) {
 									return MUTT_FAILED_MALLOC;
 								}
 								// Load
 								muttResult res = mutt_f12Load(font, pformat->f12, data, datalen);
 								if (mutt_result_is_fatal(res)) {
-									mu_free(pformat->f12);
+									mutt_Free(font->allocator, pformat->f12);
 									pformat->f12 = 0;
 								}
 								return res;
@@ -16993,44 +18661,50 @@ All mu libraries included in muSDK have name functions to convert some of their
 					}
 
 					// Deloads a given format
-					void mutt_DeloadCmapFormat(uint16_m format, muttCmapFormat* pformat) {
+					void mutt_DeloadCmapFormat(muttFont* font, uint16_m format, muttCmapFormat* pformat) {
 						switch (format) {
 							default: break;
 
 							// Format 0
 							case 0: {
 								// Deallocate
-								mu_free(pformat->f0);
+								mutt_Free(font->allocator, pformat->f0);
 							} break;
 
 							// Format 4
 							case 4: {
 								// Deload
-								mutt_f4Deload(pformat->f4);
+								mutt_f4Deload(font, pformat->f4);
 								// Deallocate
-								mu_free(pformat->f4);
+								mutt_Free(font->allocator, pformat->f4);
 							} break;
 
 							// Format 12
 							case 12: {
 								// Deload
-								mutt_f12Deload(pformat->f12);
+								mutt_f12Deload(font, pformat->f12);
 								// Deallocate
-								mu_free(pformat->f12);
+								mutt_Free(font->allocator, pformat->f12);
 							} break;
 						}
 					}
 
 					// Glyph -> codepoint, for a given format
 					MUDEF uint16_m mutt_cmap_encoding_get_glyph(muttFont* font, muttEncodingRecord* record, uint32_m codepoint) {
+						// Records that failed to load have no format to read from
+						if (mutt_result_is_fatal(record->result)) {
+							return 0;
+						}
+
 						switch (record->format) {
 							// Unknown
 							default: return 0; break;
 
 							// Format 0
-							case 0: return mutt_cmap0_get_glyph(font, record->encoding.f0, codepoint); break;
+							// (Codepoints past its range would otherwise be truncated)
+							case 0: return (codepoint > 0xFF) ?(0) :(mutt_cmap0_get_glyph(font, record->encoding.f0, (uint8_m)codepoint)); break;
 							// Format 4
-							case 4: return mutt_cmap4_get_glyph(font, record->encoding.f4, codepoint); break;
+							case 4: return (codepoint > 0xFFFF) ?(0) :(mutt_cmap4_get_glyph(font, record->encoding.f4, (uint16_m)codepoint)); break;
 							// Format 12
 							case 12: return mutt_cmap12_get_glyph(font, record->encoding.f12, codepoint); break;
 						}
@@ -17038,6 +18712,11 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 					// Codepoint -> glyph, for a given format
 					MUDEF uint32_m mutt_cmap_encoding_get_codepoint(muttFont* font, muttEncodingRecord* record, uint16_m glyph_id) {
+						// Records that failed to load have no format to read from
+						if (mutt_result_is_fatal(record->result)) {
+							return 0;
+						}
+
 						switch (record->format) {
 							// Unknown
 							default: return 0; break;
@@ -17053,8 +18732,28 @@ All mu libraries included in muSDK have name functions to convert some of their
 
 				/* Cmap */
 
+					// Ranks how preferred an encoding record is for converting Unicode codepoints
+					// 0 means it can't be used
+					uint8_m mutt_CmapRecordRank(muttEncodingRecord* record) {
+						// Must have loaded
+						if (mutt_result_is_fatal(record->result)) {
+							return 0;
+						}
+						// Must be Unicode
+						if (!(record->platform_id == 0 || (record->platform_id == 3 && (record->encoding_id == 1 || record->encoding_id == 10)))) {
+							return 0;
+						}
+						// Format 12 > 4 > 0
+						switch (record->format) {
+							default: return 0; break;
+							case 0: return 1; break;
+							case 4: return 2; break;
+							case 12: return 3; break;
+						}
+					}
+
 					// Loads the cmap table
-					void mutt_DeloadCmap(muttCmap* cmap);
+					void mutt_DeloadCmap(muttFont* font, muttCmap* cmap);
 					muttResult mutt_LoadCmap(muttFont* font, muByte* data, uint32_m datalen) {
 						// Placeholder values
 						muByte* orig_data = data;
@@ -17073,7 +18772,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 							return MUTT_INVALID_CMAP_LENGTH;
 						}
 						// Allocate cmap
-						muttCmap* cmap = (muttCmap*)mu_malloc(sizeof(muttCmap));
+						muttCmap* cmap = (muttCmap*)mutt_Malloc(font->allocator, sizeof(muttCmap));
 						if (!cmap) {
 							return MUTT_FAILED_MALLOC;
 						}
@@ -17088,14 +18787,14 @@ All mu libraries included in muSDK have name functions to convert some of their
 						}
 						// Verify length for tables
 						if (datalen < (4 + (uint32_m)(cmap->num_tables*8))) {
-							mutt_DeloadCmap(cmap);
+							mutt_DeloadCmap(font, cmap);
 							return MUTT_INVALID_CMAP_LENGTH;
 						}
 
 						// Allocate tables
-						cmap->encoding_records = (muttEncodingRecord*)mu_malloc(sizeof(muttEncodingRecord)*cmap->num_tables);
+						cmap->encoding_records = (muttEncodingRecord*)mutt_Malloc(font->allocator, sizeof(muttEncodingRecord)*cmap->num_tables);
 						if (!cmap->encoding_records) {
-							mutt_DeloadCmap(cmap);
+							mutt_DeloadCmap(font, cmap);
 							return MUTT_FAILED_MALLOC;
 						}
 						mu_memset(cmap->encoding_records, 0, sizeof(muttEncodingRecord)*cmap->num_tables);
@@ -17114,7 +18813,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 							// subtableOffset
 							uint32_m offset = MU_RBEU32(data+4);
 							if (offset >= datalen) {
-								mutt_DeloadCmap(cmap);
+								mutt_DeloadCmap(font, cmap);
 								return MUTT_INVALID_CMAP_ENCODING_RECORD_OFFSET;
 							}
 							
@@ -17122,7 +18821,7 @@ All mu libraries included in muSDK have name functions to convert some of their
 							uint32_m subtable_len = datalen-offset;
 							// Verify length for format
 							if (subtable_len < 2) {
-								mutt_DeloadCmap(cmap);
+								mutt_DeloadCmap(font, cmap);
 								return MUTT_INVALID_CMAP_ENCODING_RECORD_LENGTH;
 							}
 							// format
@@ -17134,48 +18833,225 @@ All mu libraries included in muSDK have name functions to convert some of their
 							data += 8;
 						}
 
+						// Choose preferred encoding record
+						uint8_m best_rank = 0;
+						for (uint16_m t = 0; t < cmap->num_tables; ++t) {
+							uint8_m rank = mutt_CmapRecordRank(&cmap->encoding_records[t]);
+							if (rank > best_rank) {
+								best_rank = rank;
+								cmap->preferred = &cmap->encoding_records[t];
+							}
+						}
+
 						font->cmap = cmap;
 						return MUTT_SUCCESS;
 					}
 
 					// Deloads the cmap table
-					void mutt_DeloadCmap(muttCmap* cmap) {
+					void mutt_DeloadCmap(muttFont* font, muttCmap* cmap) {
 						// cmap:
 						if (cmap) {
+							// Lookup table:
+							if (cmap->lookup_blocks) {
+								mutt_Free(font->allocator, cmap->lookup_blocks);
+							}
+							if (cmap->lookup_pages) {
+								mutt_Free(font->allocator, cmap->lookup_pages);
+							}
 							// Encoding records:
 							if (cmap->encoding_records) {
 								// Per encoding record:
 								for (uint16_m t = 0; t < cmap->num_tables; ++t) {
 									// Deload format if necessary
 									if (!mutt_result_is_fatal(cmap->encoding_records[t].result)) {
-										mutt_DeloadCmapFormat(cmap->encoding_records[t].format, &cmap->encoding_records[t].encoding);
+										mutt_DeloadCmapFormat(font, cmap->encoding_records[t].format, &cmap->encoding_records[t].encoding);
 									}
 								}
-								mu_free(cmap->encoding_records);
+								mutt_Free(font->allocator, cmap->encoding_records);
 							}
-							mu_free(cmap);
+							mutt_Free(font->allocator, cmap);
 						}
 					}
 
-					// Glyph -> codepoint, for all cmap formats
-					MUDEF uint16_m mutt_get_glyph(muttFont* font, uint32_m codepoint) {
-						// Loop through each encoding record
-						for (uint16_m t = 0; t < font->cmap->num_tables; ++t) {
-							// Try getting glyph ID for the encoding record
-							uint16_m glyph = mutt_cmap_encoding_get_glyph(font, &font->cmap->encoding_records[t], codepoint);
-							// Return if not 0
-							if (glyph != 0) {
-								return glyph;
-							}
-						}
+				/* Cmap lookup table */
 
-						// Non-zero glyph ID couldn't be found
-						return 0;
-					}
+					// Amount of 256-codepoint blocks in 0...0x10FFFF
+					#define MUTT_CMAP_LOOKUP_BLOCKS 0x1100
 
-					// Codepoint -> glyph, for all cmap formats
-					MUDEF uint32_m mutt_get_codepoint(muttFont* font, uint16_m glyph_id) {
-						// Loop through each encoding record
+					// Gets the range of codepoints covered by part i of an encoding record
+					// Returns MU_FALSE if i is past the amount of parts
+					muBool mutt_CmapRange(muttEncodingRecord* record, uint32_m i, uint32_m* first, uint32_m* last) {
+						switch (record->format) {
+							default: return MU_FALSE; break;
+
+							// Format 0: all 256 codepoints
+							case 0: {
+								if (i != 0) {
+									return MU_FALSE;
+								}
+								*first = 0;
+								*last = 0xFF;
+							} break;
+
+							// Format 4: each segment
+							case 4: {
+								if (i >= record->encoding.f4->seg_count) {
+									return MU_FALSE;
+								}
+								*first = record->encoding.f4->seg[i].start_code;
+								*last = record->encoding.f4->seg[i].end_code;
+							} break;
+
+							// Format 12: each group
+							case 12: {
+								if (i >= record->encoding.f12->num_groups) {
+									return MU_FALSE;
+								}
+								*first = record->encoding.f12->groups[i].start_char_code;
+								*last = record->encoding.f12->groups[i].end_char_code;
+							} break;
+						}
+
+						// Clamp to the range covered by the lookup table
+						if (*last > (MUTT_CMAP_LOOKUP_BLOCKS*256)-1) {
+							*last = (MUTT_CMAP_LOOKUP_BLOCKS*256)-1;
+						}
+						return MU_TRUE;
+					}
+
+					// Builds the cmap lookup table
+					muttResult mutt_BuildCmapLookup(muttFont* font) {
+						muttCmap* cmap = font->cmap;
+
+						// Allocate blocks
+						cmap->lookup_blocks = (uint16_m*)mutt_Malloc(font->allocator, MUTT_CMAP_LOOKUP_BLOCKS*sizeof(uint16_m));
+						if (!cmap->lookup_blocks) {
+							return MUTT_FAILED_MALLOC;
+						}
+						mu_memset(cmap->lookup_blocks, 0, MUTT_CMAP_LOOKUP_BLOCKS*sizeof(uint16_m));
+
+						// Records that mutt_get_glyph searches
+						// (Only the preferred record if there is one)
+						muttEncodingRecord* records = (cmap->preferred) ?(cmap->preferred) :(cmap->encoding_records);
+						uint16_m num_records = (cmap->preferred) ?(1) :(cmap->num_tables);
+
+						// Mark each block that has codepoints in any encoding record
+						for (uint16_m t = 0; t < num_records; ++t) {
+							muttEncodingRecord* record = &records[t];
+							if (mutt_result_is_fatal(record->result)) {
+								continue;
+							}
+							uint32_m first, last;
+							for (uint32_m i = 0; mutt_CmapRange(record, i, &first, &last); ++i) {
+								for (uint32_m b = first >> 8; b <= (last >> 8) && first <= last; ++b) {
+									cmap->lookup_blocks[b] = 1;
+								}
+							}
+						}
+
+						// Give each marked block its own page (page 0 is the empty page)
+						uint32_m num_pages = 1;
+						for (uint32_m b = 0; b < MUTT_CMAP_LOOKUP_BLOCKS; ++b) {
+							if (cmap->lookup_blocks[b]) {
+								cmap->lookup_blocks[b] = (uint16_m)(num_pages++);
+							}
+						}
+
+						// Allocate pages
+						cmap->lookup_pages = (uint16_m*)mutt_Malloc(font->allocator, num_pages*256*sizeof(uint16_m));
+						if (!cmap->lookup_pages) {
+							mutt_Free(font->allocator, cmap->lookup_blocks);
+							cmap->lookup_blocks = 0;
+							return MUTT_FAILED_MALLOC;
+						}
+						mu_memset(cmap->lookup_pages, 0, num_pages*256*sizeof(uint16_m));
+
+						// Fill each codepoint with the first non-zero glyph ID of the encoding records
+						// (Equivalent to searching each encoding record in order)
+						for (uint16_m t = 0; t < num_records; ++t) {
+							muttEncodingRecord* record = &records[t];
+							if (mutt_result_is_fatal(record->result)) {
+								continue;
+							}
+							uint32_m first, last;
+							for (uint32_m i = 0; mutt_CmapRange(record, i, &first, &last); ++i) {
+								for (uint32_m c = first; c <= last; ++c) {
+									uint16_m* glyph = &cmap->lookup_pages[(((uint32_m)cmap->lookup_blocks[c >> 8]) << 8) | (c & 0xFF)];
+									if (*glyph == 0) {
+										*glyph = mutt_cmap_encoding_get_glyph(font, record, c);
+									}
+								}
+							}
+						}
+
+						return MUTT_SUCCESS;
+					}
+
+				/* Top-level */
+
+					// Glyph -> codepoint, for all cmap formats
+					MUDEF uint16_m mutt_get_glyph(muttFont* font, uint32_m codepoint) {
+						MUTT_LAZY_LOAD(font, MUTT_LOAD_CMAP)
+
+						// Use lookup table if built
+						if (font->cmap->lookup_pages && codepoint < MUTT_CMAP_LOOKUP_BLOCKS*256) {
+							return font->cmap->lookup_pages[(((uint32_m)font->cmap->lookup_blocks[codepoint >> 8]) << 8) | (codepoint & 0xFF)];
+						}
+						// Use preferred encoding record if there is one
+						if (font->cmap->preferred) {
+							return mutt_cmap_encoding_get_glyph(font, font->cmap->preferred, codepoint);
+						}
+
+						// Loop through each encoding record
+						for (uint16_m t = 0; t < font->cmap->num_tables; ++t) {
+							// Try getting glyph ID for the encoding record
+							uint16_m glyph = mutt_cmap_encoding_get_glyph(font, &font->cmap->encoding_records[t], codepoint);
+							// Return if not 0
+							if (glyph != 0) {
+								return glyph;
+							}
+						}
+
+						// Non-zero glyph ID couldn't be found
+						return 0;
+					}
+
+					// Glyph -> codepoint for multiple codepoints, for all cmap formats
+					MUDEF void mutt_get_glyphs(muttFont* font, uint32_m* codepoints, size_m count, uint16_m* glyphs) {
+						MUTT_LAZY_LOAD(font, MUTT_LOAD_CMAP)
+						muttCmap* cmap = font->cmap;
+
+						// Lookup table
+						if (cmap->lookup_pages) {
+							for (size_m i = 0; i < count; ++i) {
+								if (codepoints[i] < MUTT_CMAP_LOOKUP_BLOCKS*256) {
+									glyphs[i] = cmap->lookup_pages[(((uint32_m)cmap->lookup_blocks[codepoints[i] >> 8]) << 8) | (codepoints[i] & 0xFF)];
+								} else {
+									glyphs[i] = mutt_get_glyph(font, codepoints[i]);
+								}
+							}
+							return;
+						}
+
+						// Preferred encoding record
+						if (cmap->preferred) {
+							for (size_m i = 0; i < count; ++i) {
+								glyphs[i] = mutt_cmap_encoding_get_glyph(font, cmap->preferred, codepoints[i]);
+							}
+							return;
+						}
+
+						// Search each encoding record
+						for (size_m i = 0; i < count; ++i) {
+							glyphs[i] = mutt_get_glyph(font, codepoints[i]);
+						}
+					}
+
+					// Codepoint -> glyph, for all cmap formats
+					MUDEF uint32_m mutt_get_codepoint(muttFont* font, uint16_m glyph_id) {
+						MUTT_LAZY_LOAD(font, MUTT_LOAD_CMAP)
+
+						// Loop through each encoding record
 						for (uint16_m t = 0; t < font->cmap->num_tables; ++t) {
 							// Try getting codepoint for the encoding record
 							uint32_m codepoint = mutt_cmap_encoding_get_codepoint(font, &font->cmap->encoding_records[t], glyph_id);
@@ -17189,2981 +19065,7756 @@ All mu libraries included in muSDK have name functions to convert some of their
 						return 0;
 					}
 
-			/* Loading / Deloading */
+			/* Kerning */
 
-				// Initializes all flag/result states of each table to "failed to find"
-				void mutt_InitTables(muttFont* font, muttLoadFlags load_flags) {
-					// maxp
-					font->maxp_res = (load_flags & MUTT_LOAD_MAXP) ? MUTT_FAILED_FIND_TABLE : 0;
-					font->fail_load_flags |= (load_flags & MUTT_LOAD_MAXP);
-					// head
-					font->head_res = (load_flags & MUTT_LOAD_HEAD) ? MUTT_FAILED_FIND_TABLE : 0;
-					font->fail_load_flags |= (load_flags & MUTT_LOAD_HEAD);
-					// hhea
-					font->hhea_res = (load_flags & MUTT_LOAD_HHEA) ? MUTT_FAILED_FIND_TABLE : 0;
-					font->fail_load_flags |= (load_flags & MUTT_LOAD_HHEA);
-					// hmtx
-					font->hmtx_res = (load_flags & MUTT_LOAD_HMTX) ? MUTT_FAILED_FIND_TABLE : 0;
-					font->fail_load_flags |= (load_flags & MUTT_LOAD_HMTX);
-					// loca
-					font->loca_res = (load_flags & MUTT_LOAD_LOCA) ? MUTT_FAILED_FIND_TABLE : 0;
-					font->fail_load_flags |= (load_flags & MUTT_LOAD_LOCA);
-					// name
-					font->name_res = (load_flags & MUTT_LOAD_NAME) ? MUTT_FAILED_FIND_TABLE : 0;
-					font->fail_load_flags |= (load_flags & MUTT_LOAD_NAME);
-					// glyf
-					font->glyf_res = (load_flags & MUTT_LOAD_GLYF) ? MUTT_FAILED_FIND_TABLE : 0;
-					font->fail_load_flags |= (load_flags & MUTT_LOAD_GLYF);
-					// cmap
-					font->cmap_res = (load_flags & MUTT_LOAD_CMAP) ? MUTT_FAILED_FIND_TABLE : 0;
-					font->fail_load_flags |= (load_flags & MUTT_LOAD_CMAP);
-				}
+				/* Pair table */
 
-				// Does one pass through each table load
-				void mutt_LoadTables(muttFont* font, muByte* data, muttLoadFlags* first, muBool dep_pass, muttLoadFlags* waiting) {
-					// Loop through each table
-					for (uint16_m i = 0; i < font->directory->num_tables; ++i) {
-						// Get record information
-						muttTableRecord rec = font->directory->records[i];
+					MUDEF uint32_m mutt_pair_hash(uint16_m left, uint16_m right) {
+						uint32_m h = ((((uint32_m)left) << 16) | right) * 0x9E3779B1;
+						return h ^ (h >> 16);
+					}
 
-						// Do things based on table tag
-						switch (rec.table_tag_u32) {
-							default: break;
+					// Allocates a pair table with room for a given amount of pairs
+					muttResult mutt_PairTableInit(muttFont* font, muttPairTable* table, uint32_m max_pairs) {
+						table->count = 0;
+						table->capacity = 0;
+						table->pairs = 0;
+						if (max_pairs == 0) {
+							return MUTT_SUCCESS;
+						}
 
-							// maxp
-							case 0x6D617870: {
-								// Account for first
-								if (dep_pass) {
-									*first |= MUTT_LOAD_MAXP;
-								}
-								// Skip if already processed
-								// This works because all tables to be processed are initialized
-								// to "MUTT_FAILED_FIND_TABLE" and set to something else once
-								// processed.
-								if (font->maxp_res != MUTT_FAILED_FIND_TABLE) {
-									break;
-								}
+						// Keep the table at most half full
+						uint32_m capacity = 8;
+						while (capacity < max_pairs*2) {
+							capacity <<= 1;
+						}
 
-								// Load
-								font->maxp_res = mutt_LoadMaxp(font, &data[rec.offset], rec.length);
-								if (font->maxp) {
-									font->load_flags |= MUTT_LOAD_MAXP;
-									font->fail_load_flags &= ~MUTT_LOAD_MAXP;
-								} else {
-									font->fail_load_flags |= MUTT_LOAD_MAXP;
-									font->load_flags &= ~MUTT_LOAD_MAXP;
-								}
-							} break;
+						// Allocate, marking every slot as unused
+						table->pairs = (muttKernPair*)mutt_Malloc(font->allocator, sizeof(muttKernPair)*capacity);
+						if (!table->pairs) {
+							return MUTT_FAILED_MALLOC;
+						}
+						mu_memset(table->pairs, 0xFF, sizeof(muttKernPair)*capacity);
+						table->capacity = capacity;
+						return MUTT_SUCCESS;
+					}
 
-							// head
-							case 0x68656164: {
-								// Account for first
-								if (dep_pass) {
-									*first |= MUTT_LOAD_HEAD;
-								}
-								// Skip if already processed
-								if (font->head_res != MUTT_FAILED_FIND_TABLE) {
-									break;
-								}
+					// Deallocates a pair table
+					void mutt_PairTableFree(muttFont* font, muttPairTable* table) {
+						if (table->pairs) {
+							mutt_Free(font->allocator, table->pairs);
+						}
+					}
 
-								// Load
-								font->head_res = mutt_LoadHead(font, &data[rec.offset], rec.length);
-								if (font->head) {
-									font->load_flags |= MUTT_LOAD_HEAD;
-									font->fail_load_flags &= ~MUTT_LOAD_HEAD;
-								} else {
-									font->fail_load_flags |= MUTT_LOAD_HEAD;
-									font->load_flags &= ~MUTT_LOAD_HEAD;
-								}
-							} break;
+					// Finds the slot of a pair in a pair table; returns the unused slot it
+					// would go in if it's not in the table
+					// (Table must have a non-zero capacity)
+					muttKernPair* mutt_PairTableSlot(muttPairTable* table, uint16_m left, uint16_m right) {
+						uint32_m mask = table->capacity-1;
+						uint32_m i = mutt_pair_hash(left, right) & mask;
+						while (MU_TRUE) {
+							muttKernPair* pair = &table->pairs[i];
+							if (pair->left == 0xFFFF || (pair->left == left && pair->right == right)) {
+								return pair;
+							}
+							i = (i+1) & mask;
+						}
+					}
 
-							// hhea; req maxp
-							case 0x68686561: {
-								// Account for first
-								if (dep_pass) {
-									*first |= MUTT_LOAD_HHEA;
-								}
-								// Skip if already processed
-								if (font->hhea_res != MUTT_FAILED_FIND_TABLE) {
-									break;
-								}
+					// Gets the value of a pair in a pair table; returns if it was found
+					muBool mutt_PairTableGet(muttPairTable* table, uint16_m left, uint16_m right, int16_m* value) {
+						if (table->capacity == 0) {
+							return MU_FALSE;
+						}
+						muttKernPair* pair = mutt_PairTableSlot(table, left, right);
+						if (pair->left == 0xFFFF) {
+							return MU_FALSE;
+						}
+						*value = pair->value;
+						return MU_TRUE;
+					}
 
-								// Give bad result if missing dependency
-								if (!dep_pass && !(*first & MUTT_LOAD_MAXP)) {
-									font->hhea_res = MUTT_HHEA_REQUIRES_MAXP;
-									break;
-								}
-								// Continue if dependencies aren't processed
-								if (!font->maxp) {
-									*waiting |= MUTT_LOAD_HHEA;
-									break;
-								}
-								// Mark as no longer waiting
-								*waiting &= ~MUTT_LOAD_HHEA;
+				/* Kern */
 
-								// Load
-								font->hhea_res = mutt_LoadHhea(font, &data[rec.offset], rec.length);
-								if (font->hhea) {
-									font->load_flags |= MUTT_LOAD_HHEA;
-									font->fail_load_flags &= ~MUTT_LOAD_HHEA;
-								} else {
-									font->fail_load_flags |= MUTT_LOAD_HHEA;
-									font->load_flags &= ~MUTT_LOAD_HHEA;
-								}
-							} break;
+					// Goes through each kern subtable, verifying them and counting the
+					// pairs of each subtable that's read if kern->pairs isn't allocated,
+					// and adding each pair to kern->pairs if it is
+					muttResult mutt_KernPass(muttFont* font, muttKern* kern, muByte* data, uint32_m datalen, uint32_m* pair_count) {
+						// Length of each subtable header
+						uint32_m header_len = (kern->version == 0) ?(6) :(8);
+						// Offset to first subtable
+						uint32_m offset = (kern->version == 0) ?(4) :(8);
 
-							// hmtx; req maxp, hhea
-							case 0x686D7478: {
-								// Account for first
-								if (dep_pass) {
-									*first |= MUTT_LOAD_HMTX;
+						for (uint32_m t = 0; t < kern->num_tables; ++t) {
+							// Verify length for subtable header
+							if (datalen < offset+header_len) {
+								return MUTT_INVALID_KERN_SUBTABLE_LENGTH;
+							}
+							muByte* sub = data+offset;
+
+							// Read length and coverage, and figure out if it's read
+							uint32_m length;
+							uint8_m format;
+							muBool read;
+							muBool override = MU_FALSE;
+							// - Windows
+							if (kern->version == 0) {
+								length = MU_RBEU16(sub+2);
+								uint16_m coverage = MU_RBEU16(sub+4);
+								format = (uint8_m)(coverage >> 8);
+								// (Horizontal, not minimum, not cross-stream)
+								read = (coverage & 0x0007) == 0x0001;
+								override = (coverage & 0x0008) != 0;
+							}
+							// - Apple
+							else {
+								length = MU_RBEU32(sub);
+								uint16_m coverage = MU_RBEU16(sub+4);
+								format = (uint8_m)(coverage & 0xFF);
+								// (Not vertical, cross-stream, or variation)
+								read = (coverage & 0xE000) == 0;
+							}
+
+							// Format 0:
+							if (format == 0) {
+								// Verify length for nPairs
+								if (datalen < offset+header_len+8) {
+									return MUTT_INVALID_KERN_SUBTABLE_LENGTH;
 								}
-								// Skip if already processed
-								if (font->hmtx_res != MUTT_FAILED_FIND_TABLE) {
-									break;
+								uint16_m num_pairs = MU_RBEU16(sub+header_len);
+								// Calculate length from nPairs
+								length = header_len + 8 + ((uint32_m)num_pairs)*6;
+								if (datalen < offset+length) {
+									return MUTT_INVALID_KERN_SUBTABLE_LENGTH;
 								}
 
-								// Give bad result if missing dependency
-								if (!dep_pass) {
-									// maxp
-									if (!(*first & MUTT_LOAD_MAXP)) {
-										font->hmtx_res = MUTT_HMTX_REQUIRES_MAXP;
-										break;
-									}
-									// hhea
-									if (!(*first & MUTT_LOAD_HHEA)) {
-										font->hmtx_res = MUTT_HMTX_REQUIRES_HHEA;
-										break;
+								// Count / add pairs
+								if (read) {
+									if (!kern->pairs.pairs) {
+										*pair_count += num_pairs;
+									} else {
+										muByte* p = sub+header_len+8;
+										for (uint16_m i = 0; i < num_pairs; ++i, p += 6) {
+											uint16_m left = MU_RBEU16(p);
+											uint16_m right = MU_RBEU16(p+2);
+											// - Ignore invalid glyph IDs
+											if (left >= font->maxp->num_glyphs || right >= font->maxp->num_glyphs) {
+												continue;
+											}
+											// - Add or combine value
+											muttKernPair* pair = mutt_PairTableSlot(&kern->pairs, left, right);
+											if (pair->left == 0xFFFF) {
+												pair->left = left;
+												pair->right = right;
+												pair->value = MU_RBES16(p+4);
+												++kern->pairs.count;
+											} else if (override) {
+												pair->value = MU_RBES16(p+4);
+											} else {
+												pair->value += MU_RBES16(p+4);
+											}
+										}
 									}
 								}
-								// Continue if dependencies aren't processed
-								if (!(font->maxp) || !(font->hhea)) {
-									*waiting |= MUTT_LOAD_HMTX;
-									break;
-								}
-								// Mark as no longer waiting
-								*waiting &= ~MUTT_LOAD_HMTX;
+							}
+							// Other formats:
+							else if (length < header_len || datalen < offset+length) {
+								return MUTT_INVALID_KERN_SUBTABLE_LENGTH;
+							}
 
-								// Load
-								font->hmtx_res = mutt_LoadHmtx(font, &data[rec.offset], rec.length);
-								if (font->hmtx) {
-									font->load_flags |= MUTT_LOAD_HMTX;
-									font->fail_load_flags &= ~MUTT_LOAD_HMTX;
-								} else {
-									font->fail_load_flags |= MUTT_LOAD_HMTX;
-									font->load_flags &= ~MUTT_LOAD_HMTX;
-								}
-							} break;
-
-							// loca; req maxp, head, glyf
-							case 0x6C6F6361: {
-								// Account for first
-								if (dep_pass) {
-									*first |= MUTT_LOAD_LOCA;
-								}
-								// Skip if already processed
-								if (font->loca_res != MUTT_FAILED_FIND_TABLE) {
-									break;
-								}
-
-								// Give bad result if missing dependency
-								if (!dep_pass) {
-									// maxp
-									if (!(*first & MUTT_LOAD_MAXP)) {
-										font->loca_res = MUTT_LOCA_REQUIRES_MAXP;
-										break;
-									}
-									// head
-									if (!(*first & MUTT_LOAD_HEAD)) {
-										font->loca_res = MUTT_LOCA_REQUIRES_HEAD;
-										break;
-									}
-									// glyf
-									if (!(*first & MUTT_LOAD_GLYF)) {
-										font->loca_res = MUTT_LOCA_REQUIRES_GLYF;
-										break;
-									}
-								}
-								// Continue if dependencies aren't processed
-								if (!(font->maxp) || !(font->head) || !(font->glyf)) {
-									*waiting |= MUTT_LOAD_LOCA;
-									break;
-								}
-								// Mark as no longer waiting
-								*waiting &= ~MUTT_LOAD_LOCA;
+							// Move to next subtable
+							offset += length;
+						}
 
-								// Load
-								font->loca_res = mutt_LoadLoca(font, &data[rec.offset], rec.length);
-								if (font->loca) {
-									font->load_flags |= MUTT_LOAD_LOCA;
-									font->fail_load_flags &= ~MUTT_LOAD_LOCA;
-								} else {
-									font->fail_load_flags |= MUTT_LOAD_LOCA;
-									font->load_flags &= ~MUTT_LOAD_LOCA;
-								}
-							} break;
+						return MUTT_SUCCESS;
+					}
 
-							// name
-							case 0x6E616D65: {
-								// Account for first
-								if (dep_pass) {
-									*first |= MUTT_LOAD_NAME;
-								}
-								// Skip if already processed
-								if (font->name_res != MUTT_FAILED_FIND_TABLE) {
-									break;
-								}
+					// Loads the kern table
+					void mutt_DeloadKern(muttFont* font, muttKern* kern);
+					muttResult mutt_LoadKern(muttFont* font, muByte* data, uint32_m datalen) {
+						// Verify length for version
+						if (datalen < 4) {
+							return MUTT_INVALID_KERN_LENGTH;
+						}
 
-								// Load
-								font->name_res = mutt_LoadName(font, &data[rec.offset], rec.length);
-								if (font->name) {
-									font->load_flags |= MUTT_LOAD_NAME;
-									font->fail_load_flags &= ~MUTT_LOAD_NAME;
-								} else {
-									font->fail_load_flags |= MUTT_LOAD_NAME;
-									font->load_flags &= ~MUTT_LOAD_NAME;
-								}
-							} break;
+						// Read version and nTables
+						uint32_m version;
+						uint32_m num_tables;
+						// - Windows
+						if (MU_RBEU16(data) == 0) {
+							version = 0;
+							num_tables = MU_RBEU16(data+2);
+						}
+						// - Apple
+						else if (MU_RBEU32(data) == 0x00010000) {
+							if (datalen < 8) {
+								return MUTT_INVALID_KERN_LENGTH;
+							}
+							version = 0x00010000;
+							num_tables = MU_RBEU32(data+4);
+						}
+						else {
+							return MUTT_INVALID_KERN_VERSION;
+						}
 
-							// glyf
-							case 0x676C7966: {
-								// Account for first
-								if (dep_pass) {
-									*first |= MUTT_LOAD_GLYF;
-								}
-								// Skip if already processed
-								if (font->glyf_res != MUTT_FAILED_FIND_TABLE) {
-									break;
-								}
+						// Allocate kern
+						muttKern* kern = (muttKern*)mutt_Malloc(font->allocator, sizeof(muttKern));
+						if (!kern) {
+							return MUTT_FAILED_MALLOC;
+						}
+						mu_memset(kern, 0, sizeof(muttKern));
+						kern->version = version;
+						kern->num_tables = num_tables;
 
-								// Load
-								font->glyf_res = mutt_LoadGlyf(font, &data[rec.offset], rec.length);
-								if (font->glyf) {
-									font->load_flags |= MUTT_LOAD_GLYF;
-									font->fail_load_flags &= ~MUTT_LOAD_GLYF;
-								} else {
-									font->fail_load_flags |= MUTT_LOAD_GLYF;
-									font->load_flags &= ~MUTT_LOAD_GLYF;
-								}
-							} break;
+						// Verify subtables & count pairs
+						uint32_m pair_count = 0;
+						muttResult res = mutt_KernPass(font, kern, data, datalen, &pair_count);
+						if (mutt_result_is_fatal(res)) {
+							mutt_DeloadKern(font, kern);
+							return res;
+						}
 
-							// cmap
-							case 0x636D6170: {
-								// Account for first
-								if (dep_pass) {
-									*first |= MUTT_LOAD_CMAP;
-								}
-								// Skip if already processed
-								if (font->cmap_res != MUTT_FAILED_FIND_TABLE) {
-									break;
-								}
+						// Allocate pair table
+						res = mutt_PairTableInit(font, &kern->pairs, pair_count);
+						if (mutt_result_is_fatal(res)) {
+							mutt_DeloadKern(font, kern);
+							return res;
+						}
+						// Add pairs
+						if (kern->pairs.pairs) {
+							mutt_KernPass(font, kern, data, datalen, &pair_count);
+						}
 
-								// Give bad result if missing dependency
-								if (!dep_pass && !(*first & MUTT_LOAD_MAXP)) {
-									font->cmap_res = MUTT_CMAP_REQUIRES_MAXP;
-									break;
-								}
-								// Continue if dependencies aren't processed
-								if (!font->maxp) {
-									*waiting |= MUTT_LOAD_CMAP;
-									break;
-								}
-								// Mark as no longer waiting
-								*waiting &= ~MUTT_LOAD_CMAP;
+						font->kern = kern;
+						return MUTT_SUCCESS;
+					}
 
-								// Load
-								font->cmap_res = mutt_LoadCmap(font, &data[rec.offset], rec.length);
-								if (font->cmap) {
-									font->load_flags |= MUTT_LOAD_CMAP;
-									font->fail_load_flags &= ~MUTT_LOAD_CMAP;
-								} else {
-									font->fail_load_flags |= MUTT_LOAD_CMAP;
-									font->load_flags &= ~MUTT_LOAD_CMAP;
-								}
-							} break;
+					// Deloads the kern table
+					void mutt_DeloadKern(muttFont* font, muttKern* kern) {
+						if (kern) {
+							mutt_PairTableFree(font, &kern->pairs);
+							mutt_Free(font->allocator, kern);
 						}
 					}
-				}
 
-				// Deallocates all loaded tables
-				void mutt_DeloadTables(muttFont* font) {
-					// Basic tables
-					if (font->maxp) {
-						mu_free(font->maxp);
-					}
-					if (font->head) {
-						mu_free(font->head);
-					}
-					if (font->hhea) {
-						mu_free(font->hhea);
+					MUDEF int16_m mutt_kern_get_kerning(muttFont* font, muttKern* kern, uint16_m left, uint16_m right) {
+						if (font) {}
+						int16_m value = 0;
+						mutt_PairTableGet(&kern->pairs, left, right, &value);
+						return value;
 					}
 
-					// Allocated tables
-					mutt_DeloadHmtx(font->hmtx);
-					mutt_DeloadLoca(font->loca);
-					mutt_DeloadName(font->name);
-					mutt_DeloadGlyf(font->glyf);
-					mutt_DeloadCmap(font->cmap);
-				}
+				/* GPOS */
 
-				MUDEF muttResult mutt_load(muByte* data, uint64_m datalen, muttFont* font, muttLoadFlags load_flags) {
-					muttResult res;
+					// A pair adjustment subtable used for kerning
+					struct muttK_Subtable {
+						// The index of its lookup among those used for kerning
+						uint16_m lookup;
+						// The subtable data (format 1)
+						muByte* data;
+						// The subtable's class pair adjustment (format 2)
+						muttPairClass* pclass;
+					};
+					typedef struct muttK_Subtable muttK_Subtable;
 
-					// Zero-out font
-					mu_memset(font, 0, sizeof(muttFont));
+					// Returns the size of a value record in bytes based on its format
+					uint32_m mutt_ValueRecordSize(uint16_m format) {
+						uint32_m size = 0;
+						for (uint16_m b = 0; b < 8; ++b) {
+							size += (format >> b) & 1;
+						}
+						return size*2;
+					}
 
-					// Load table directory
-					// - Allocate
-					font->directory = (muttDirectory*)mu_malloc(sizeof(muttDirectory));
-					if (!font->directory) {
-						// mutt_deload(font);
-						return MUTT_FAILED_MALLOC;
+					// Returns the offset of "xAdvance" in a value record based on its
+					// format; 0xFFFFFFFF if it's not in the record
+					uint32_m mutt_ValueRecordXAdvance(uint16_m format) {
+						if (!(format & 0x0004)) {
+							return 0xFFFFFFFF;
+						}
+						return ((format & 1) + ((format >> 1) & 1))*2;
 					}
-					// - Load
-					res = mutt_LoadTableDirectory(font->directory, data, datalen);
-					if (mutt_result_is_fatal(res)) {
-						mutt_deload(font);
-						return res;
+
+					// Verifies that a coverage table is in range
+					muttResult mutt_VerifyCoverage(muByte* data, uint32_m datalen) {
+						if (datalen < 4) {
+							return MUTT_INVALID_GPOS_COVERAGE;
+						}
+						uint32_m count = MU_RBEU16(data+2);
+						switch (MU_RBEU16(data)) {
+							default: return MUTT_INVALID_GPOS_COVERAGE; break;
+							case 1: if (datalen < 4+count*2) { return MUTT_INVALID_GPOS_COVERAGE; } break;
+							case 2: if (datalen < 4+count*6) { return MUTT_INVALID_GPOS_COVERAGE; } break;
+						}
+						return MUTT_SUCCESS;
 					}
 
-					// Init and load tables
-					mutt_InitTables(font, load_flags);
+					// Returns the coverage index of a glyph in a verified coverage table;
+					// 0xFFFFFFFF if it's not covered
+					uint32_m mutt_CoverageIndex(muByte* data, uint16_m glyph) {
+						uint32_m lo = 0;
+						uint32_m hi = MU_RBEU16(data+2);
 
-					muttLoadFlags temp_flags = 0;
-					muttLoadFlags wait_flags = 0;
-					mutt_LoadTables(font, data, &temp_flags, MU_TRUE, &wait_flags);
-					while (wait_flags) {
-						mutt_LoadTables(font, data, &temp_flags, MU_FALSE, &wait_flags);
+						// Format 1 (binary search glyph array)
+						if (MU_RBEU16(data) == 1) {
+							while (lo < hi) {
+								uint32_m mid = (lo+hi) / 2;
+								uint16_m g = MU_RBEU16(data+4+mid*2);
+								if (g == glyph) {
+									return mid;
+								}
+								if (g < glyph) {
+									lo = mid+1;
+								} else {
+									hi = mid;
+								}
+							}
+							return 0xFFFFFFFF;
+						}
+
+						// Format 2 (binary search ranges)
+						while (lo < hi) {
+							uint32_m mid = (lo+hi) / 2;
+							muByte* range = data+4+mid*6;
+							if (glyph < MU_RBEU16(range)) {
+								hi = mid;
+							} else if (glyph > MU_RBEU16(range+2)) {
+								lo = mid+1;
+							} else {
+								return ((uint32_m)MU_RBEU16(range+4)) + (glyph - MU_RBEU16(range));
+							}
+						}
+						return 0xFFFFFFFF;
 					}
 
-					return MUTT_SUCCESS;
-				}
+					// Verifies that a class definition table is in range, and gives the
+					// lowest and highest glyph ID that it defines a class for
+					muttResult mutt_VerifyClassDef(muByte* data, uint32_m datalen, uint32_m* min, uint32_m* max) {
+						*min = 0xFFFF;
+						*max = 0;
+						if (datalen < 4) {
+							return MUTT_INVALID_GPOS_CLASS_DEF;
+						}
 
-				MUDEF void mutt_deload(muttFont* font) {
-					// Deload tables
-					mutt_DeloadTables(font);
-					// Deload table directory
-					if (font->directory) {
-						mutt_DeloadTableDirectory(font->directory);
-						mu_free(font->directory);
-					}
-				}
+						switch (MU_RBEU16(data)) {
+							default: return MUTT_INVALID_GPOS_CLASS_DEF; break;
 
-			/* Glyf stuff */
+							// Format 1
+							case 1: {
+								if (datalen < 6) {
+									return MUTT_INVALID_GPOS_CLASS_DEF;
+								}
+								uint32_m count = MU_RBEU16(data+4);
+								if (datalen < 6+count*2) {
+									return MUTT_INVALID_GPOS_CLASS_DEF;
+								}
+								if (count) {
+									*min = MU_RBEU16(data+2);
+									*max = *min+count-1;
+								}
+							} break;
 
-				// Fills in the "muttGlyphHeader" struct
-				MUDEF muttResult mutt_glyph_header(muttFont* font, uint16_m glyph_id, muttGlyphHeader* header) {
-					// Get length and data of glyph
-					// - 16-bit
-					if (font->head->index_to_loc_format == 0) {
-						header->data = &font->glyf->data[((uint32_m)font->loca->offsets16[glyph_id])*2];
-						header->length = (((uint32_m)font->loca->offsets16[glyph_id+1])*2) - (((uint32_m)font->loca->offsets16[glyph_id])*2);
+							// Format 2
+							case 2: {
+								uint32_m count = MU_RBEU16(data+2);
+								if (datalen < 4+count*6) {
+									return MUTT_INVALID_GPOS_CLASS_DEF;
+								}
+								for (uint32_m r = 0; r < count; ++r) {
+									uint32_m start = MU_RBEU16(data+4+r*6);
+									uint32_m end = MU_RBEU16(data+6+r*6);
+									if (start < *min) {
+										*min = start;
+									}
+									if (end > *max) {
+										*max = end;
+									}
+								}
+							} break;
+						}
+						return MUTT_SUCCESS;
 					}
-					// - 32-bit
-					else {
-						header->data = &font->glyf->data[font->loca->offsets32[glyph_id]];
-						header->length = font->loca->offsets32[glyph_id+1] - font->loca->offsets32[glyph_id];
+
+					// Sets each value in a glyph-indexed array to the class given by a
+					// verified class definition table for the glyph; glyphs whose class
+					// is 'count' or more are set to 0xFFFF, and, if 'covered_only' is
+					// true, glyphs whose value is already 0xFFFF are skipped
+					void mutt_FillClassDef(muByte* data, uint16_m* arr, uint32_m first, uint32_m arr_len, uint16_m count, muBool covered_only) {
+						// Format 1
+						if (MU_RBEU16(data) == 1) {
+							uint32_m start = MU_RBEU16(data+2);
+							uint32_m num = MU_RBEU16(data+4);
+							for (uint32_m i = 0; i < num; ++i) {
+								uint32_m g = start+i;
+								if (g < first || g-first >= arr_len || (covered_only && arr[g-first] == 0xFFFF)) {
+									continue;
+								}
+								uint16_m c = MU_RBEU16(data+6+i*2);
+								arr[g-first] = (c < count) ?(c) :(0xFFFF);
+							}
+							return;
+						}
+
+						// Format 2
+						uint32_m num = MU_RBEU16(data+2);
+						for (uint32_m r = 0; r < num; ++r) {
+							muByte* range = data+4+r*6;
+							uint32_m end = MU_RBEU16(range+2);
+							uint16_m c = MU_RBEU16(range+4);
+							for (uint32_m g = MU_RBEU16(range); g <= end; ++g) {
+								if (g < first || g-first >= arr_len || (covered_only && arr[g-first] == 0xFFFF)) {
+									continue;
+								}
+								arr[g-first] = (c < count) ?(c) :(0xFFFF);
+							}
+						}
 					}
 
-					// If header length is 0, we set everything to 0 and return
-					// (because no outline)
-					if (header->length == 0) {
-						mu_memset(header, 0, sizeof(muttGlyphHeader));
+					// Verifies a pair adjustment format 1 subtable
+					muttResult mutt_VerifyPairPos1(muByte* data, uint32_m datalen) {
+						// Verify length for header
+						if (datalen < 10) {
+							return MUTT_INVALID_GPOS_PAIR_POS;
+						}
+						// Verify coverage
+						uint32_m coverage = MU_RBEU16(data+2);
+						if (coverage >= datalen) {
+							return MUTT_INVALID_GPOS_COVERAGE;
+						}
+						muttResult res = mutt_VerifyCoverage(data+coverage, datalen-coverage);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
+
+						// Verify length for pairSetOffsets
+						uint32_m record_len = 2 + mutt_ValueRecordSize(MU_RBEU16(data+4)) + mutt_ValueRecordSize(MU_RBEU16(data+6));
+						uint32_m set_count = MU_RBEU16(data+8);
+						if (datalen < 10+set_count*2) {
+							return MUTT_INVALID_GPOS_PAIR_POS;
+						}
+						// Verify each pair set
+						for (uint32_m i = 0; i < set_count; ++i) {
+							uint32_m set = MU_RBEU16(data+10+i*2);
+							if (datalen < set+2 || datalen < set+2+MU_RBEU16(data+set)*record_len) {
+								return MUTT_INVALID_GPOS_PAIR_POS;
+							}
+						}
 						return MUTT_SUCCESS;
 					}
 
-					// Verify minimum length for header
-					if (header->length < 10) {
-						return MUTT_INVALID_GLYF_HEADER_LENGTH;
+					// Gets the value of a pair from a verified pair adjustment format 1
+					// subtable; returns if the subtable applies to it
+					muBool mutt_PairPos1Get(muByte* data, uint16_m left, uint16_m right, int32_m* value) {
+						// Find pair set
+						uint32_m index = mutt_CoverageIndex(data+MU_RBEU16(data+2), left);
+						if (index >= MU_RBEU16(data+8)) {
+							return MU_FALSE;
+						}
+						muByte* set = data + MU_RBEU16(data+10+index*2);
+
+						// Binary search pair set for right glyph
+						uint16_m format1 = MU_RBEU16(data+4);
+						uint32_m record_len = 2 + mutt_ValueRecordSize(format1) + mutt_ValueRecordSize(MU_RBEU16(data+6));
+						uint32_m lo = 0;
+						uint32_m hi = MU_RBEU16(set);
+						while (lo < hi) {
+							uint32_m mid = (lo+hi) / 2;
+							muByte* record = set+2+mid*record_len;
+							uint16_m g = MU_RBEU16(record);
+							if (g == right) {
+								uint32_m x_advance = mutt_ValueRecordXAdvance(format1);
+								*value = (x_advance == 0xFFFFFFFF) ?(0) :(MU_RBES16(record+2+x_advance));
+								return MU_TRUE;
+							}
+							if (g < right) {
+								lo = mid+1;
+							} else {
+								hi = mid;
+							}
+						}
+						return MU_FALSE;
 					}
 
-					// numberOfContours
-					header->number_of_contours = MU_RBES16(header->data);
-					if (header->number_of_contours > font->maxp->max_contours) {
-						return MUTT_INVALID_GLYF_HEADER_NUMBER_OF_CONTOURS;
-					}
+					// Loads a pair adjustment format 2 subtable as a class pair adjustment
+					// Note: pclass->class1 being 0 after a successful call means that the
+					// subtable never applies, and wasn't loaded.
+					void mutt_DeloadPairClass(muttFont* font, muttPairClass* pclass);
+					muttResult mutt_LoadPairClass(muttFont* font, muByte* data, uint32_m datalen, muttPairClass* pclass) {
+						mu_memset(pclass, 0, sizeof(muttPairClass));
+						// Verify length for header
+						if (datalen < 16) {
+							return MUTT_INVALID_GPOS_PAIR_POS;
+						}
+						uint16_m format1 = MU_RBEU16(data+4);
+						uint32_m record_len = mutt_ValueRecordSize(format1) + mutt_ValueRecordSize(MU_RBEU16(data+6));
+						uint32_m class1_count = MU_RBEU16(data+12);
+						uint32_m class2_count = MU_RBEU16(data+14);
+						// Verify length for records
+						if ((uint64_m)datalen < 16+((uint64_m)(class1_count*class2_count))*record_len) {
+							return MUTT_INVALID_GPOS_PAIR_POS;
+						}
+
+						// Verify coverage
+						uint32_m coverage = MU_RBEU16(data+2);
+						if (coverage >= datalen) {
+							return MUTT_INVALID_GPOS_COVERAGE;
+						}
+						muByte* cov = data+coverage;
+						muttResult res = mutt_VerifyCoverage(cov, datalen-coverage);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
+						// Verify class definitions
+						uint32_m class_def1 = MU_RBEU16(data+8);
+						uint32_m class_def2 = MU_RBEU16(data+10);
+						if (class_def1 >= datalen || class_def2 >= datalen) {
+							return MUTT_INVALID_GPOS_CLASS_DEF;
+						}
+						uint32_m min1, max1, min2, max2;
+						res = mutt_VerifyClassDef(data+class_def1, datalen-class_def1, &min1, &max1);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
+						res = mutt_VerifyClassDef(data+class_def2, datalen-class_def2, &min2, &max2);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
 
-					// xMin
-					header->x_min = MU_RBES16(header->data+2);
-					if (header->x_min < font->head->x_min) {
-						return MUTT_INVALID_GLYF_HEADER_X_MIN;
-					}
-					// yMin
-					header->y_min = MU_RBES16(header->data+4);
-					if (header->y_min < font->head->y_min) {
-						return MUTT_INVALID_GLYF_HEADER_Y_MIN;
-					}
-					// xMax
-					header->x_max = MU_RBES16(header->data+6);
-					if (header->x_max > font->head->x_max) {
-						return MUTT_INVALID_GLYF_HEADER_X_MAX;
-					}
-					if (header->x_max < header->x_min) {
-						return MUTT_INVALID_GLYF_HEADER_X_MIN_MAX;
-					}
-					// yMax
-					header->y_max = MU_RBES16(header->data+8);
-					if (header->y_max > font->head->y_max) {
-						return MUTT_INVALID_GLYF_HEADER_Y_MAX;
-					}
-					if (header->y_max < header->y_min) {
-						return MUTT_INVALID_GLYF_HEADER_Y_MIN_MAX;
-					}
+						// Subtable never applies if there are no classes
+						if (class1_count == 0 || class2_count == 0) {
+							return MUTT_SUCCESS;
+						}
 
-					// Subtract header data from length
-					header->length -= 10;
-					// ...and move data up past header
-					header->data += 10;
+						// Find range of covered glyphs
+						uint16_m num = MU_RBEU16(cov+2);
+						uint32_m first = 0xFFFF;
+						uint32_m last = 0;
+						for (uint16_m i = 0; i < num; ++i) {
+							uint32_m start = (MU_RBEU16(cov) == 1) ?(MU_RBEU16(cov+4+i*2)) :(MU_RBEU16(cov+4+i*6));
+							uint32_m end = (MU_RBEU16(cov) == 1) ?(start) :(MU_RBEU16(cov+6+i*6));
+							first = (start < first) ?(start) :(first);
+							last = (end > last) ?(end) :(last);
+						}
+						// - Ignore invalid glyph IDs
+						if (last >= font->maxp->num_glyphs) {
+							last = font->maxp->num_glyphs-1;
+						}
+						// - Subtable never applies if no valid glyphs are covered
+						if (first > last) {
+							return MUTT_SUCCESS;
+						}
 
-					return MUTT_SUCCESS;
-				}
+						// Allocate class1
+						pclass->first_glyph1 = (uint16_m)first;
+						pclass->glyph1_count = (uint16_m)(last-first+1);
+						pclass->class1 = (uint16_m*)mutt_Malloc(font->allocator, sizeof(uint16_m)*pclass->glyph1_count);
+						if (!pclass->class1) {
+							return MUTT_FAILED_MALLOC;
+						}
+						// Fill class1; uncovered glyphs are 0xFFFF, covered glyphs are class
+						// 0 unless the class definition says otherwise
+						mu_memset(pclass->class1, 0xFF, sizeof(uint16_m)*pclass->glyph1_count);
+						for (uint16_m i = 0; i < num; ++i) {
+							uint32_m start = (MU_RBEU16(cov) == 1) ?(MU_RBEU16(cov+4+i*2)) :(MU_RBEU16(cov+4+i*6));
+							uint32_m end = (MU_RBEU16(cov) == 1) ?(start) :(MU_RBEU16(cov+6+i*6));
+							for (uint32_m g = start; g <= end && g <= last; ++g) {
+								pclass->class1[g-first] = 0;
+							}
+						}
+						mutt_FillClassDef(data+class_def1, pclass->class1, first, pclass->glyph1_count, (uint16_m)class1_count, MU_TRUE);
 
-				// Fills in (or calculates memory needed for) "muttSimpleGlyph" struct
-				MUDEF muttResult mutt_simple_glyph(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muByte* data, uint32_m* written) {
-					muttResult res = MUTT_SUCCESS;
+						// Allocate & fill class2
+						if (max2 >= font->maxp->num_glyphs) {
+							max2 = font->maxp->num_glyphs-1;
+						}
+						if (min2 <= max2) {
+							pclass->first_glyph2 = (uint16_m)min2;
+							pclass->glyph2_count = (uint16_m)(max2-min2+1);
+							pclass->class2 = (uint16_m*)mutt_Malloc(font->allocator, sizeof(uint16_m)*pclass->glyph2_count);
+							if (!pclass->class2) {
+								mutt_DeloadPairClass(font, pclass);
+								return MUTT_FAILED_MALLOC;
+							}
+							mu_memset(pclass->class2, 0, sizeof(uint16_m)*pclass->glyph2_count);
+							mutt_FillClassDef(data+class_def2, pclass->class2, min2, pclass->glyph2_count, (uint16_m)class2_count, MU_FALSE);
+						}
 
-					// Verify length for endPtsOfContours and instructionLength
-					// (req is u64 to avoid possible overflow)
-					uint64_m req = (((uint32_m)header->number_of_contours)*2) + 2;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						// Allocate & fill values
+						pclass->class1_count = (uint16_m)class1_count;
+						pclass->class2_count = (uint16_m)class2_count;
+						pclass->values = (int16_m*)mutt_Malloc(font->allocator, sizeof(int16_m)*class1_count*class2_count);
+						if (!pclass->values) {
+							mutt_DeloadPairClass(font, pclass);
+							return MUTT_FAILED_MALLOC;
+						}
+						uint32_m x_advance = mutt_ValueRecordXAdvance(format1);
+						for (uint32_m i = 0; i < class1_count*class2_count; ++i) {
+							pclass->values[i] = (x_advance == 0xFFFFFFFF) ?(0) :(MU_RBES16(data+16+i*record_len+x_advance));
+						}
+						return MUTT_SUCCESS;
 					}
 
-					// Glyph data:
-					muByte* gdata = header->data;
+					// Deloads a class pair adjustment
+					void mutt_DeloadPairClass(muttFont* font, muttPairClass* pclass) {
+						if (pclass->class1) {
+							mutt_Free(font->allocator, pclass->class1);
+						}
+						if (pclass->class2) {
+							mutt_Free(font->allocator, pclass->class2);
+						}
+						if (pclass->values) {
+							mutt_Free(font->allocator, pclass->values);
+						}
+					}
 
-					// Memory size calculation:
-					if (!data) {
-						// Add endPtsOfContours to memory
-						uint32_m min_size = header->number_of_contours*2;
+					// Gets the value of a pair from a class pair adjustment; returns if
+					// the subtable applies to it
+					static inline muBool mutt_PairClassGet(muttPairClass* pclass, uint16_m left, uint16_m right, int32_m* value) {
+						// Class 1
+						uint32_m i1 = (uint32_m)left - pclass->first_glyph1;
+						if (i1 >= pclass->glyph1_count) {
+							return MU_FALSE;
+						}
+						uint16_m class1 = pclass->class1[i1];
+						if (class1 == 0xFFFF) {
+							return MU_FALSE;
+						}
+						// Class 2
+						uint32_m i2 = (uint32_m)right - pclass->first_glyph2;
+						uint16_m class2 = (i2 < pclass->glyph2_count) ?(pclass->class2[i2]) :(0);
+						if (class2 == 0xFFFF) {
+							return MU_FALSE;
+						}
 
-						// To calculate amount of points:
-						uint16_m points = 0;
-						if (header->number_of_contours != 0) {
-							// Skip to last element of endPtsOfContours and read
-							gdata += (uint32_m)(header->number_of_contours-1)*2;
-							points = MU_RBEU16(gdata);
+						*value = pclass->values[((uint32_m)class1)*pclass->class2_count + class2];
+						return MU_TRUE;
+					}
 
-							// Verify last element of endPtsOfContours
-							if (points == 0xFFFF) {
-								return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+					// Calculates the kerning of a pair from class pair adjustments
+					int32_m mutt_PairClassesKerning(muttPairClass* pclasses, uint32_m count, uint16_m left, uint16_m right) {
+						int32_m kerning = 0;
+						uint32_m applied = 0xFFFFFFFF;
+						for (uint32_m i = 0; i < count; ++i) {
+							// Skip if this lookup has already applied
+							if (pclasses[i].lookup == applied) {
+								continue;
 							}
+							int32_m value;
+							if (mutt_PairClassGet(&pclasses[i], left, right, &value)) {
+								kerning += value;
+								applied = pclasses[i].lookup;
+							}
+						}
+						return kerning;
+					}
 
-							// Skip past last element
-							++points;
-							gdata += 2;
+					// Calculates the kerning of a pair from every kerning subtable
+					int32_m mutt_SubtablesKerning(muttK_Subtable* subtables, uint32_m count, uint16_m left, uint16_m right) {
+						int32_m kerning = 0;
+						uint32_m applied = 0xFFFFFFFF;
+						for (uint32_m i = 0; i < count; ++i) {
+							// Skip if this lookup has already applied
+							if (subtables[i].lookup == applied) {
+								continue;
+							}
+							int32_m value;
+							muBool applies = (subtables[i].pclass)
+								? mutt_PairClassGet(subtables[i].pclass, left, right, &value)
+								: mutt_PairPos1Get(subtables[i].data, left, right, &value);
+							if (applies) {
+								kerning += value;
+								applied = subtables[i].lookup;
+							}
 						}
+						return kerning;
+					}
 
-						// Verify point count
-						if (points > font->maxp->max_points) {
-							return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+					// Marks each lookup referenced by a 'kern' feature
+					muttResult mutt_GposKernLookups(muByte* data, uint32_m datalen, uint32_m feature_list, muByte* used, uint16_m lookup_count) {
+						// Verify length for feature records
+						if (datalen < feature_list+2) {
+							return MUTT_INVALID_GPOS_FEATURE_LIST;
+						}
+						uint32_m count = MU_RBEU16(data+feature_list);
+						if (datalen < feature_list+2+count*6) {
+							return MUTT_INVALID_GPOS_FEATURE_LIST;
 						}
-						// Add points to memory
-						min_size += ((uint32_m)points)*sizeof(muttGlyphPoint);
 
-						// Add instructions to memory
-						uint16_m instruction_length = MU_RBEU16(gdata);
-						if (instruction_length > font->maxp->max_size_of_instructions) {
-							return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
+						for (uint32_m f = 0; f < count; ++f) {
+							// Skip if not 'kern'
+							muByte* record = data+feature_list+2+f*6;
+							if (MU_RBEU32(record) != 0x6B65726E) {
+								continue;
+							}
+							// Verify feature table
+							uint32_m feature = feature_list + MU_RBEU16(record+4);
+							if (datalen < feature+4) {
+								return MUTT_INVALID_GPOS_FEATURE_LIST;
+							}
+							uint32_m index_count = MU_RBEU16(data+feature+2);
+							if (datalen < feature+4+index_count*2) {
+								return MUTT_INVALID_GPOS_FEATURE_LIST;
+							}
+							// Mark each lookup
+							for (uint32_m i = 0; i < index_count; ++i) {
+								uint16_m index = MU_RBEU16(data+feature+4+i*2);
+								if (index >= lookup_count) {
+									return MUTT_INVALID_GPOS_FEATURE_LIST;
+								}
+								used[index] = 1;
+							}
 						}
-						min_size += instruction_length;
+						return MUTT_SUCCESS;
+					}
 
-						// Check for size fitting
-						// This should not need to be checked, as it is calculated via maxp,
-						// to which all of these values are also checked to not exceed.
-						/*if (min_size > mutt_simple_glyph_max_size(font)) {
-							return MUTT_INVALID_GLYF_SIMPLE_;
-						}*/
+					// Gets the offset of a verified lookup's subtable, following extension
+					// subtables; 'type' is set to the lookup type of the subtable
+					muttResult mutt_GposLookupSubtable(muByte* data, uint32_m datalen, uint32_m lookup, uint16_m s, uint32_m* offset, uint16_m* type) {
+						*type = MU_RBEU16(data+lookup);
+						*offset = lookup + MU_RBEU16(data+lookup+6+s*2);
+						if (*offset >= datalen) {
+							return MUTT_INVALID_GPOS_LOOKUP;
+						}
 
-						// Set memory req
-						*written = min_size;
+						// Extension
+						if (*type == 9) {
+							if (datalen < *offset+8 || MU_RBEU16(data+*offset) != 1) {
+								return MUTT_INVALID_GPOS_LOOKUP;
+							}
+							*type = MU_RBEU16(data+*offset+2);
+							uint32_m extension = MU_RBEU32(data+*offset+4);
+							if (extension >= datalen - *offset) {
+								return MUTT_INVALID_GPOS_LOOKUP;
+							}
+							*offset += extension;
+						}
 						return MUTT_SUCCESS;
 					}
 
-					// Store pointer to original data
-					muByte* orig_data = data;
+					// Fills the subtables of each lookup used for kerning
+					// (If 'subtables' is 0, they're just verified and counted)
+					muttResult mutt_GposSubtables(muttFont* font, muttGpos* gpos, muByte* data, uint32_m datalen, uint32_m lookup_list, muByte* used, muttK_Subtable* subtables, uint32_m* count) {
+						*count = 0;
+						uint32_m pclass_count = 0;
+						uint16_m lookup_count = MU_RBEU16(data+lookup_list);
+						gpos->num_lookups = 0;
 
-					// Allocate endPtsOfContours
-					glyph->end_pts_of_contours = (uint16_m*)data;
-					data += ((uint32_m)header->number_of_contours)*2;
+						for (uint16_m l = 0; l < lookup_count; ++l) {
+							// Skip if not used for kerning
+							if (!used[l]) {
+								continue;
+							}
+							// Verify lookup table
+							uint32_m lookup = lookup_list + MU_RBEU16(data+lookup_list+2+l*2);
+							if (datalen < lookup+6) {
+								return MUTT_INVALID_GPOS_LOOKUP;
+							}
+							uint16_m type = MU_RBEU16(data+lookup);
+							if (type != 2 && type != 9) {
+								continue;
+							}
+							uint32_m subtable_count = MU_RBEU16(data+lookup+4);
+							if (datalen < lookup+6+subtable_count*2) {
+								return MUTT_INVALID_GPOS_LOOKUP;
+							}
 
-					// Loop through each contour
-					uint16_m points = 0;
-					for (uint16_m c = 0; c < header->number_of_contours; ++c) {
-						// Copy value for endPtsOfContour
-						glyph->end_pts_of_contours[c] = MU_RBEU16(gdata);
+							// Go through each subtable
+							muBool has_pairs = MU_FALSE;
+							for (uint16_m s = 0; s < subtable_count; ++s) {
+								uint32_m offset;
+								muttResult res = mutt_GposLookupSubtable(data, datalen, lookup, s, &offset, &type);
+								if (mutt_result_is_fatal(res)) {
+									return res;
+								}
+								if (type != 2) {
+									continue;
+								}
+								if (datalen < offset+2) {
+									return MUTT_INVALID_GPOS_PAIR_POS;
+								}
 
-						// Verify increasing order
-						if (c != 0) {
-							if (glyph->end_pts_of_contours[c] <= glyph->end_pts_of_contours[c-1]) {
-								return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+								muttK_Subtable* sub = (subtables) ?(&subtables[*count]) :(0);
+								switch (MU_RBEU16(data+offset)) {
+									default: return MUTT_INVALID_GPOS_PAIR_POS; break;
+
+									// Format 1
+									case 1: {
+										if (!sub) {
+											res = mutt_VerifyPairPos1(data+offset, datalen-offset);
+											if (mutt_result_is_fatal(res)) {
+												return res;
+											}
+										} else {
+											sub->data = data+offset;
+											sub->pclass = 0;
+										}
+									} break;
+
+									// Format 2
+									case 2: {
+										if (sub) {
+											muttPairClass* pclass = &gpos->pair_classes[pclass_count];
+											res = mutt_LoadPairClass(font, data+offset, datalen-offset, pclass);
+											if (mutt_result_is_fatal(res)) {
+												return res;
+											}
+											// - Skip if it never applies
+											if (!pclass->class1) {
+												continue;
+											}
+											pclass->lookup = gpos->num_lookups;
+											sub->data = data+offset;
+											sub->pclass = pclass;
+											gpos->num_pair_classes = ++pclass_count;
+										}
+									} break;
+								}
+
+								if (sub) {
+									sub->lookup = gpos->num_lookups;
+								}
+								++*count;
+								has_pairs = MU_TRUE;
+							}
+
+							if (has_pairs) {
+								++gpos->num_lookups;
 							}
 						}
+						return MUTT_SUCCESS;
+					}
 
-						// Get point count if we're on the last index
-						if (c == header->number_of_contours-1) {
-							points = glyph->end_pts_of_contours[c];
-							// Verify last element
-							if (points == 0xFFFF) {
-								return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+					// Adds each pair listed individually whose kerning differs from that
+					// given by the class pair adjustments to the GPOS pair table
+					muttResult mutt_GposPairs(muttFont* font, muttGpos* gpos, muttK_Subtable* subtables, uint32_m count) {
+						// Count max pairs
+						uint32_m max_pairs = 0;
+						for (uint32_m i = 0; i < count; ++i) {
+							if (subtables[i].pclass) {
+								continue;
+							}
+							muByte* data = subtables[i].data;
+							uint16_m set_count = MU_RBEU16(data+8);
+							for (uint16_m p = 0; p < set_count; ++p) {
+								max_pairs += MU_RBEU16(data + MU_RBEU16(data+10+p*2));
 							}
-							// Increment points by one to get count (since last value is an index)
-							++points;
 						}
 
-						// Move to next entry in endPtsOfContours
-						gdata += 2;
-					}
+						// Allocate pair table
+						muttResult res = mutt_PairTableInit(font, &gpos->pairs, max_pairs);
+						if (mutt_result_is_fatal(res) || max_pairs == 0) {
+							return res;
+						}
 
-					// Verify point count
-					if (points > font->maxp->max_points) {
-						return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
-					}
+						for (uint32_m i = 0; i < count; ++i) {
+							if (subtables[i].pclass) {
+								continue;
+							}
+							muByte* data = subtables[i].data;
+							muByte* coverage = data + MU_RBEU16(data+2);
+							uint16_m set_count = MU_RBEU16(data+8);
+							uint32_m record_len = 2 + mutt_ValueRecordSize(MU_RBEU16(data+4)) + mutt_ValueRecordSize(MU_RBEU16(data+6));
+
+							// Go through each covered glyph
+							uint32_m num = MU_RBEU16(coverage+2);
+							for (uint32_m c = 0; c < num; ++c) {
+								uint32_m start, end, index;
+								// - Format 1
+								if (MU_RBEU16(coverage) == 1) {
+									start = end = MU_RBEU16(coverage+4+c*2);
+									index = c;
+								}
+								// - Format 2
+								else {
+									start = MU_RBEU16(coverage+4+c*6);
+									end = MU_RBEU16(coverage+6+c*6);
+									index = MU_RBEU16(coverage+8+c*6);
+								}
 
-					// instructionLength
-					glyph->instruction_length = MU_RBEU16(gdata);
-					gdata += 2;
-					// + Verify instructionLength
-					if (glyph->instruction_length > font->maxp->max_size_of_instructions) {
-						return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
+								for (uint32_m left = start; left <= end; ++left, ++index) {
+									if (index >= set_count || left >= font->maxp->num_glyphs) {
+										break;
+									}
+									muByte* set = data + MU_RBEU16(data+10+index*2);
+									uint16_m pair_count = MU_RBEU16(set);
+
+									// Go through each pair
+									for (uint16_m p = 0; p < pair_count; ++p) {
+										uint16_m right = MU_RBEU16(set+2+p*record_len);
+										if (right >= font->maxp->num_glyphs) {
+											continue;
+										}
+										// Skip if already added
+										muttKernPair* pair = mutt_PairTableSlot(&gpos->pairs, (uint16_m)left, right);
+										if (pair->left != 0xFFFF) {
+											continue;
+										}
+										// Add if kerning differs from class pair adjustments
+										int32_m kerning = mutt_SubtablesKerning(subtables, count, (uint16_m)left, right);
+										if (kerning != mutt_PairClassesKerning(gpos->pair_classes, gpos->num_pair_classes, (uint16_m)left, right)) {
+											pair->left = (uint16_m)left;
+											pair->right = right;
+											pair->value = (int16_m)kerning;
+											++gpos->pairs.count;
+										}
+									}
+								}
+							}
+						}
+						return MUTT_SUCCESS;
 					}
 
-					// For instructions:
-					if (glyph->instruction_length != 0) {
-						// Verify length for instructions
-						req += glyph->instruction_length;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					// Loads the GPOS table
+					void mutt_DeloadGpos(muttFont* font, muttGpos* gpos);
+					muttResult mutt_LoadGpos(muttFont* font, muByte* data, uint32_m datalen) {
+						// Verify length for header
+						if (datalen < 10) {
+							return MUTT_INVALID_GPOS_LENGTH;
+						}
+						// Verify version
+						uint16_m major_version = MU_RBEU16(data);
+						uint16_m minor_version = MU_RBEU16(data+2);
+						if (major_version != 1 || minor_version > 1) {
+							return MUTT_INVALID_GPOS_VERSION;
 						}
-						// Allocate
-						glyph->instructions = (uint8_m*)data;
-						// Copy over
-						mu_memcpy(glyph->instructions, gdata, glyph->instruction_length);
-						// Move past instructions
-						data += glyph->instruction_length;
-						gdata += glyph->instruction_length;
-					}
 
-					// Allocate points
-					glyph->points = (muttGlyphPoint*)data;
-					data += points*sizeof(muttGlyphPoint);
+						// Allocate GPOS
+						muttGpos* gpos = (muttGpos*)mutt_Malloc(font->allocator, sizeof(muttGpos));
+						if (!gpos) {
+							return MUTT_FAILED_MALLOC;
+						}
+						mu_memset(gpos, 0, sizeof(muttGpos));
+						gpos->major_version = major_version;
+						gpos->minor_version = minor_version;
 
-					// Loop through each flag
-					uint16_m pi = 0; // (point index)
-					uint16_m contour_id = 0;
-					while (pi < points) {
-						// Increment contour ID if we've gone over the end point of the current contour
-						if (pi > glyph->end_pts_of_contours[contour_id]) {
-							++contour_id;
+						// Terminate early if there's no features or lookups
+						uint32_m feature_list = MU_RBEU16(data+6);
+						uint32_m lookup_list = MU_RBEU16(data+8);
+						if (feature_list == 0 || lookup_list == 0) {
+							font->gpos = gpos;
+							return MUTT_SUCCESS;
 						}
-						// Verify length for this flag
-						if (header->length < ++req) {
-							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						// Verify lookup list
+						if (datalen < lookup_list+2 || datalen < lookup_list+2+((uint32_m)MU_RBEU16(data+lookup_list))*2) {
+							mutt_DeloadGpos(font, gpos);
+							return MUTT_INVALID_GPOS_LOOKUP_LIST;
+						}
+						uint16_m lookup_count = MU_RBEU16(data+lookup_list);
+						if (lookup_count == 0) {
+							font->gpos = gpos;
+							return MUTT_SUCCESS;
 						}
 
-						// Get flag
-						uint8_m flags = *gdata;
-						glyph->points[pi].flags = flags;
+						// Mark lookups used for kerning
+						muByte* used = (muByte*)mutt_Malloc(font->allocator, lookup_count);
+						if (!used) {
+							mutt_DeloadGpos(font, gpos);
+							return MUTT_FAILED_MALLOC;
+						}
+						mu_memset(used, 0, lookup_count);
+						muttResult res = mutt_GposKernLookups(data, datalen, feature_list, used, lookup_count);
 
-						// Verify that flag doesn't rely on prior values if this is the first flag
-						// (Some common fonts get this messed up; we're assuming 0 in these cases)
-						// This is brought up in the documentation.
-						// ...
-
-						// Verify that first point is on curve
-						// (Not checking for similar reasons above, also brought up in doc)
-						// ...
-
-						// Get implied length of x- and y-coordinates based on flag
-						uint8_m coord_length = 0;
-						// - x
-						if (flags & MUTT_X_SHORT_VECTOR) {
-							// 1-byte x-coordinate
-							coord_length += 1;
-						} else if (!(flags & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR)) {
-							// 2-byte x-coordinate
-							coord_length += 2;
-						}
-						// -y
-						if (flags & MUTT_Y_SHORT_VECTOR) {
-							// 1-byte y-coordinate
-							coord_length += 1;
-						} else if (!(flags & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR)) {
-							// 2-byte y-coordinate
-							coord_length += 2;
-						}
-
-						// Verify length based on coord length
-						req += coord_length;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						// Verify & count subtables
+						uint32_m count = 0;
+						if (!mutt_result_is_fatal(res)) {
+							res = mutt_GposSubtables(font, gpos, data, datalen, lookup_list, used, 0, &count);
 						}
-
-						// Increment past this point/flag
-						++pi;
-						++gdata;
-
-						// Handle repeating flags:
-						if (flags & MUTT_REPEAT_FLAG) {
-							// Verify length for next flag
-							if (header->length < ++req) {
-								return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
-							}
-
-							// Get next flag as length
-							uint8_m next = *gdata++;
-							// (required length is checked next loop)
-							// - If next is 0, we don't repeat at all, and pretend
-							// like this never happened
-							if (next == 0) {
-								continue;
-							}
-
-							// Verify length for repeated coordinate flags
-							req += ((uint32_m)coord_length) * ((uint32_m)next-1);
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
-							}
-
-							// Verify repeat count
-							// Not doing this since we can easily pretend like it didn't
-							// happen to no consequence.
-							// This is mentioned in documentation
-							/*if (pi+next > points) {
-								return MUTT_INVALID_GLYF_SIMPLE_FLAG_REPEAT_COUNT;
-							}*/
-
-							// Go through each repeat flag and copy it down
-							for (uint8_m r = 0; r < next && pi < points; ++r) {
-								glyph->points[pi++].flags = flags;
+						if (mutt_result_is_fatal(res) || count == 0) {
+							mutt_Free(font->allocator, used);
+							if (mutt_result_is_fatal(res)) {
+								mutt_DeloadGpos(font, gpos);
+								return res;
 							}
+							font->gpos = gpos;
+							return MUTT_SUCCESS;
 						}
-					}
-
-					// Loop through each x-coordinate
-					int16_m x_min = 0;
-					int16_m x_max = 0;
-					pi = 0;
-					while (pi < points) {
-						// Get flags
-						uint8_m flags = glyph->points[pi].flags;
 
-						// Get x-coordinate
-						if (flags & MUTT_X_SHORT_VECTOR) {
-							// 1-byte
-							if (flags & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
-								// Positive
-								glyph->points[pi].x = (int16_m)*gdata++;
-							} else {
-								// Negative
-								glyph->points[pi].x = -((int16_m)*gdata++);
-							}
-						} else {
-							if (flags & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
-								// Repeated x-coordinate
-								glyph->points[pi].x = (pi!=0) ?(glyph->points[pi-1].x) :(0);
-								++pi;
-								// (Continue because no vector stuff is applied)
-								continue;
-							} else {
-								// 2-bytes, signed
-								glyph->points[pi].x = MU_RBES16(gdata);
-								gdata += 2;
-							}
+						// Allocate subtables and class pair adjustments
+						// (There's no more class pair adjustments than subtables)
+						muttK_Subtable* subtables = (muttK_Subtable*)mutt_Malloc(font->allocator, sizeof(muttK_Subtable)*count);
+						gpos->pair_classes = (muttPairClass*)mutt_Malloc(font->allocator, sizeof(muttPairClass)*count);
+						if (!subtables || !gpos->pair_classes) {
+							res = MUTT_FAILED_MALLOC;
 						}
 
-						// Add as vector to prior value
-						// - Get previous x value
-						int16_m prev_x = (pi!=0) ?(glyph->points[pi-1].x) :(0);
-						// - Compute the current coordinate based on previous
-						int32_m test_val = prev_x + glyph->points[pi].x;
-						// - Verify that the point is within range
-						if (test_val < header->x_min || test_val > header->x_max) {
-							res = MUTT_INVALID_GLYF_SIMPLE_X_COORD;
+						// Load subtables
+						if (!mutt_result_is_fatal(res)) {
+							res = mutt_GposSubtables(font, gpos, data, datalen, lookup_list, used, subtables, &count);
 						}
-						// - Verify that the point is within FUnit range
-						if (test_val < -16384 || test_val > 16383) {
-							return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
+						// Add individual pairs
+						if (!mutt_result_is_fatal(res)) {
+							res = mutt_GposPairs(font, gpos, subtables, count);
 						}
-						// - Consider it with currently calculated x min/max
-						if ((test_val < x_min) || (pi == 0)) {
-							x_min = test_val;
+
+						// Free temporary memory
+						mutt_Free(font->allocator, used);
+						if (subtables) {
+							mutt_Free(font->allocator, subtables);
 						}
-						if ((test_val > x_max) || (pi == 0)) {
-							x_max = test_val;
+						if (mutt_result_is_fatal(res)) {
+							mutt_DeloadGpos(font, gpos);
+							return res;
 						}
-						// - Assign
-						glyph->points[pi++].x = (int16_m)test_val;
-					}
 
-					// Loop through each y-coordinate
-					int16_m y_min = 0;
-					int16_m y_max = 0;
-					pi = 0;
-					while (pi < points) {
-						// Get flags
-						uint8_m flags = glyph->points[pi].flags;
+						font->gpos = gpos;
+						return MUTT_SUCCESS;
+					}
 
-						// Get y-coordinate
-						if (flags & MUTT_Y_SHORT_VECTOR) {
-							// 1-byte
-							if (flags & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
-								// Positive
-								glyph->points[pi].y = (int16_m)*gdata++;
-							} else {
-								// Negative
-								glyph->points[pi].y = -((int16_m)*gdata++);
-							}
-						} else {
-							if (flags & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
-								// Repeated y-coordinate
-								glyph->points[pi].y = (pi!=0) ?(glyph->points[pi-1].y) :(0);
-								++pi;
-								// (Continue because no vector stuff is applied)
-								continue;
-							} else {
-								// 2-bytes, signed
-								glyph->points[pi].y = MU_RBES16(gdata);
-								gdata += 2;
+					// Deloads the GPOS table
+					void mutt_DeloadGpos(muttFont* font, muttGpos* gpos) {
+						if (gpos) {
+							// Class pair adjustments
+							if (gpos->pair_classes) {
+								for (uint32_m i = 0; i < gpos->num_pair_classes; ++i) {
+									mutt_DeloadPairClass(font, &gpos->pair_classes[i]);
+								}
+								mutt_Free(font->allocator, gpos->pair_classes);
 							}
+							// Pair table
+							mutt_PairTableFree(font, &gpos->pairs);
+							mutt_Free(font->allocator, gpos);
 						}
-
-						// Add as vector to prior value
-						// - Get previous y value
-						int16_m prev_y = (pi!=0) ?(glyph->points[pi-1].y) :(0);
-						// - Compute the current coordinate based on previous
-						int32_m test_val = prev_y + glyph->points[pi].y;
-						// - Verify that the point is within range
-						if (test_val < header->y_min || test_val > header->y_max) {
-							res = MUTT_INVALID_GLYF_SIMPLE_Y_COORD;
-						}
-						// - Verify that the point is within FUnit range
-						if (test_val < -16384 || test_val > 16383) {
-							return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
-						}
-						// - Consider it with currently calculated y min/max values
-						if ((test_val < y_min) || (pi == 0)) {
-							y_min = test_val;
-						}
-						if ((test_val > y_max) || (pi == 0)) {
-							y_max = test_val;
-						}
-						// - Assign
-						glyph->points[pi++].y = (int16_m)test_val;
 					}
 
-					// Write calculated x/y min/max values
-					header->x_min = x_min;
-					header->y_min = y_min;
-					header->x_max = x_max;
-					header->y_max = y_max;
-					// Write how many bytes of data were used
-					if (written) {
-						*written = data-orig_data;
+					MUDEF int16_m mutt_gpos_get_kerning(muttFont* font, muttGpos* gpos, uint16_m left, uint16_m right) {
+						if (font) {}
+						// Individual pairs
+						int16_m value;
+						if (mutt_PairTableGet(&gpos->pairs, left, right, &value)) {
+							return value;
+						}
+						// Class pair adjustments
+						return (int16_m)mutt_PairClassesKerning(gpos->pair_classes, gpos->num_pair_classes, left, right);
 					}
-					return res;
-				}
 
-				// Calculates amount of points within a simple glyph
-				MUDEF muttResult mutt_simple_glyph_points(muttFont* font, muttGlyphHeader* header, uint16_m* num_points) {
-					// Give 0 for no contours
-					if (header->number_of_contours == 0) {
-						*num_points = 0;
-						return MUTT_SUCCESS;
-					}
+				/* Top-level */
 
-					// Verify length for endPtsOfContours
-					uint32_m req = ((uint32_m)header->number_of_contours) * 2;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
-					}
+					MUDEF int16_m mutt_get_kerning(muttFont* font, uint16_m left, uint16_m right) {
+						MUTT_LAZY_LOAD(font, MUTT_LOAD_KERNING)
 
-					// Skip to last element of endPtsOfContours and read
-					uint16_m rnum_points = MU_RBEU16(header->data + (((uint32_m)(header->number_of_contours-1)) * 2));
-					// Verify number of points won't overflow
-					if (rnum_points == 0xFFFF) {
-						return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
-					}
-					// See if point count is good for maxp
-					if (++rnum_points > font->maxp->max_points) {
-						return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+						// GPOS
+						if (font->gpos && font->gpos->num_lookups) {
+							return mutt_gpos_get_kerning(font, font->gpos, left, right);
+						}
+						// kern
+						if (font->kern) {
+							return mutt_kern_get_kerning(font, font->kern, left, right);
+						}
+						return 0;
 					}
 
-					// Write point count and give success
-					*num_points = rnum_points;
-					return MUTT_SUCCESS;
-				}
+			/* Loading / Deloading */
 
-				// Simple glyph memory maximum
-				MUDEF uint32_m mutt_simple_glyph_max_size(muttFont* font) {
-					return
-						// endPtsOfContours
-						(font->maxp->max_contours*2)
-						// instructions
-						+(font->maxp->max_size_of_instructions)
-						// maxPoints
-						+(font->maxp->max_points*sizeof(muttGlyphPoint))
-					;
+				// Initializes all flag/result states of each table to "failed to find"
+				void mutt_InitTables(muttFont* font, muttLoadFlags load_flags) {
+					// maxp
+					font->maxp_res = (load_flags & MUTT_LOAD_MAXP) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_MAXP);
+					// head
+					font->head_res = (load_flags & MUTT_LOAD_HEAD) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_HEAD);
+					// hhea
+					font->hhea_res = (load_flags & MUTT_LOAD_HHEA) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_HHEA);
+					// hmtx
+					font->hmtx_res = (load_flags & MUTT_LOAD_HMTX) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_HMTX);
+					// loca
+					font->loca_res = (load_flags & MUTT_LOAD_LOCA) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_LOCA);
+					// post
+					font->post_res = (load_flags & MUTT_LOAD_POST) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_POST);
+					// name
+					font->name_res = (load_flags & MUTT_LOAD_NAME) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_NAME);
+					// glyf
+					font->glyf_res = (load_flags & MUTT_LOAD_GLYF) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_GLYF);
+					// cmap
+					font->cmap_res = (load_flags & MUTT_LOAD_CMAP) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_CMAP);
+					// cmap lookup table (built once cmap is loaded)
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_CMAP_LOOKUP);
+					// kern
+					font->kern_res = (load_flags & MUTT_LOAD_KERN) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_KERN);
+					// GPOS
+					font->gpos_res = (load_flags & MUTT_LOAD_GPOS) ? MUTT_FAILED_FIND_TABLE : 0;
+					font->fail_load_flags |= (load_flags & MUTT_LOAD_GPOS);
+
+					// Load options
+					font->load_flags |= (load_flags & (MUTT_LOAD_NO_COPY|MUTT_LOAD_LAZY|MUTT_LOAD_NO_CHECKSUM));
 				}
 
-				// Calculates the x/y min/max for the given simple glyph
-				MUDEF muttResult mutt_simple_glyph_min_max(muttFont* font, muttGlyphHeader* header) {
-					// Verify length for endPtsOfContours and instructionLength
+				// Does one pass through each table load
+				void mutt_LoadTables(muttFont* font, muByte* data, muttLoadFlags* first, muBool dep_pass, muttLoadFlags* waiting) {
+					// Loop through each table
+					for (uint16_m i = 0; i < font->directory->num_tables; ++i) {
+						// Get record information
+						muttTableRecord rec = font->directory->records[i];
+
+						// Do things based on table tag
+						switch (rec.table_tag_u32) {
+							default: break;
+
+							// maxp
+							case 0x6D617870: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_MAXP;
+								}
+								// Skip if already processed
+								// This works because all tables to be processed are initialized
+								// to "MUTT_FAILED_FIND_TABLE" and set to something else once
+								// processed.
+								if (font->maxp_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Load
+								font->maxp_res = mutt_LoadMaxp(font, &data[rec.offset], rec.length);
+								if (font->maxp) {
+									font->load_flags |= MUTT_LOAD_MAXP;
+									font->fail_load_flags &= ~MUTT_LOAD_MAXP;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_MAXP;
+									font->load_flags &= ~MUTT_LOAD_MAXP;
+								}
+							} break;
+
+							// head
+							case 0x68656164: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_HEAD;
+								}
+								// Skip if already processed
+								if (font->head_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Load
+								font->head_res = mutt_LoadHead(font, &data[rec.offset], rec.length);
+								if (font->head) {
+									font->load_flags |= MUTT_LOAD_HEAD;
+									font->fail_load_flags &= ~MUTT_LOAD_HEAD;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_HEAD;
+									font->load_flags &= ~MUTT_LOAD_HEAD;
+								}
+							} break;
+
+							// hhea; req maxp
+							case 0x68686561: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_HHEA;
+								}
+								// Skip if already processed
+								if (font->hhea_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Give bad result if missing dependency
+								if (!dep_pass && !(*first & MUTT_LOAD_MAXP)) {
+									font->hhea_res = MUTT_HHEA_REQUIRES_MAXP;
+									break;
+								}
+								// Continue if dependencies aren't processed
+								if (!font->maxp) {
+									*waiting |= MUTT_LOAD_HHEA;
+									break;
+								}
+								// Mark as no longer waiting
+								*waiting &= ~MUTT_LOAD_HHEA;
+
+								// Load
+								font->hhea_res = mutt_LoadHhea(font, &data[rec.offset], rec.length);
+								if (font->hhea) {
+									font->load_flags |= MUTT_LOAD_HHEA;
+									font->fail_load_flags &= ~MUTT_LOAD_HHEA;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_HHEA;
+									font->load_flags &= ~MUTT_LOAD_HHEA;
+								}
+							} break;
+
+							// hmtx; req maxp, hhea
+							case 0x686D7478: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_HMTX;
+								}
+								// Skip if already processed
+								if (font->hmtx_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Give bad result if missing dependency
+								if (!dep_pass) {
+									// maxp
+									if (!(*first & MUTT_LOAD_MAXP)) {
+										font->hmtx_res = MUTT_HMTX_REQUIRES_MAXP;
+										break;
+									}
+									// hhea
+									if (!(*first & MUTT_LOAD_HHEA)) {
+										font->hmtx_res = MUTT_HMTX_REQUIRES_HHEA;
+										break;
+									}
+								}
+								// Continue if dependencies aren't processed
+								if (!(font->maxp) || !(font->hhea)) {
+									*waiting |= MUTT_LOAD_HMTX;
+									break;
+								}
+								// Mark as no longer waiting
+								*waiting &= ~MUTT_LOAD_HMTX;
+
+								// Load
+								font->hmtx_res = mutt_LoadHmtx(font, &data[rec.offset], rec.length);
+								if (font->hmtx) {
+									font->load_flags |= MUTT_LOAD_HMTX;
+									font->fail_load_flags &= ~MUTT_LOAD_HMTX;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_HMTX;
+									font->load_flags &= ~MUTT_LOAD_HMTX;
+								}
+							} break;
+
+							// loca; req maxp, head, glyf
+							case 0x6C6F6361: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_LOCA;
+								}
+								// Skip if already processed
+								if (font->loca_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Give bad result if missing dependency
+								if (!dep_pass) {
+									// maxp
+									if (!(*first & MUTT_LOAD_MAXP)) {
+										font->loca_res = MUTT_LOCA_REQUIRES_MAXP;
+										break;
+									}
+									// head
+									if (!(*first & MUTT_LOAD_HEAD)) {
+										font->loca_res = MUTT_LOCA_REQUIRES_HEAD;
+										break;
+									}
+									// glyf
+									if (!(*first & MUTT_LOAD_GLYF)) {
+										font->loca_res = MUTT_LOCA_REQUIRES_GLYF;
+										break;
+									}
+								}
+								// Continue if dependencies aren't processed
+								if (!(font->maxp) || !(font->head) || !(font->glyf)) {
+									*waiting |= MUTT_LOAD_LOCA;
+									break;
+								}
+								// Mark as no longer waiting
+								*waiting &= ~MUTT_LOAD_LOCA;
+
+								// Load
+								font->loca_res = mutt_LoadLoca(font, &data[rec.offset], rec.length);
+								if (font->loca) {
+									font->load_flags |= MUTT_LOAD_LOCA;
+									font->fail_load_flags &= ~MUTT_LOAD_LOCA;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_LOCA;
+									font->load_flags &= ~MUTT_LOAD_LOCA;
+								}
+							} break;
+
+							// post; req maxp
+							case 0x706F7374: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_POST;
+								}
+								// Skip if already processed
+								if (font->post_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Give bad result if missing dependency
+								if (!dep_pass && !(*first & MUTT_LOAD_MAXP)) {
+									font->post_res = MUTT_POST_REQUIRES_MAXP;
+									break;
+								}
+								// Continue if dependencies aren't processed
+								if (!font->maxp) {
+									*waiting |= MUTT_LOAD_POST;
+									break;
+								}
+								// Mark as no longer waiting
+								*waiting &= ~MUTT_LOAD_POST;
+
+								// Load
+								font->post_res = mutt_LoadPost(font, &data[rec.offset], rec.length);
+								if (font->post) {
+									font->load_flags |= MUTT_LOAD_POST;
+									font->fail_load_flags &= ~MUTT_LOAD_POST;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_POST;
+									font->load_flags &= ~MUTT_LOAD_POST;
+								}
+							} break;
+
+							// name
+							case 0x6E616D65: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_NAME;
+								}
+								// Skip if already processed
+								if (font->name_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Load
+								font->name_res = mutt_LoadName(font, &data[rec.offset], rec.length);
+								if (font->name) {
+									font->load_flags |= MUTT_LOAD_NAME;
+									font->fail_load_flags &= ~MUTT_LOAD_NAME;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_NAME;
+									font->load_flags &= ~MUTT_LOAD_NAME;
+								}
+							} break;
+
+							// glyf
+							case 0x676C7966: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_GLYF;
+								}
+								// Skip if already processed
+								if (font->glyf_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Load
+								font->glyf_res = mutt_LoadGlyf(font, &data[rec.offset], rec.length);
+								if (font->glyf) {
+									font->load_flags |= MUTT_LOAD_GLYF;
+									font->fail_load_flags &= ~MUTT_LOAD_GLYF;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_GLYF;
+									font->load_flags &= ~MUTT_LOAD_GLYF;
+								}
+							} break;
+
+							// cmap
+							case 0x636D6170: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_CMAP;
+								}
+								// Skip if already processed
+								if (font->cmap_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Give bad result if missing dependency
+								if (!dep_pass && !(*first & MUTT_LOAD_MAXP)) {
+									font->cmap_res = MUTT_CMAP_REQUIRES_MAXP;
+									break;
+								}
+								// Continue if dependencies aren't processed
+								if (!font->maxp) {
+									*waiting |= MUTT_LOAD_CMAP;
+									break;
+								}
+								// Mark as no longer waiting
+								*waiting &= ~MUTT_LOAD_CMAP;
+
+								// Load
+								font->cmap_res = mutt_LoadCmap(font, &data[rec.offset], rec.length);
+								if (font->cmap) {
+									font->load_flags |= MUTT_LOAD_CMAP;
+									font->fail_load_flags &= ~MUTT_LOAD_CMAP;
+
+									// Build lookup table if requested
+									if (font->fail_load_flags & MUTT_LOAD_CMAP_LOOKUP) {
+										if (!mutt_result_is_fatal(mutt_BuildCmapLookup(font))) {
+											font->load_flags |= MUTT_LOAD_CMAP_LOOKUP;
+											font->fail_load_flags &= ~MUTT_LOAD_CMAP_LOOKUP;
+										}
+									}
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_CMAP;
+									font->load_flags &= ~MUTT_LOAD_CMAP;
+								}
+							} break;
+
+							// kern; req maxp
+							case 0x6B65726E: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_KERN;
+								}
+								// Skip if already processed
+								if (font->kern_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Give bad result if missing dependency
+								if (!dep_pass && !(*first & MUTT_LOAD_MAXP)) {
+									font->kern_res = MUTT_KERN_REQUIRES_MAXP;
+									break;
+								}
+								// Continue if dependencies aren't processed
+								if (!font->maxp) {
+									*waiting |= MUTT_LOAD_KERN;
+									break;
+								}
+								// Mark as no longer waiting
+								*waiting &= ~MUTT_LOAD_KERN;
+
+								// Load
+								font->kern_res = mutt_LoadKern(font, &data[rec.offset], rec.length);
+								if (font->kern) {
+									font->load_flags |= MUTT_LOAD_KERN;
+									font->fail_load_flags &= ~MUTT_LOAD_KERN;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_KERN;
+									font->load_flags &= ~MUTT_LOAD_KERN;
+								}
+							} break;
+
+							// GPOS; req maxp
+							case 0x47504F53: {
+								// Account for first
+								if (dep_pass) {
+									*first |= MUTT_LOAD_GPOS;
+								}
+								// Skip if already processed
+								if (font->gpos_res != MUTT_FAILED_FIND_TABLE) {
+									break;
+								}
+
+								// Give bad result if missing dependency
+								if (!dep_pass && !(*first & MUTT_LOAD_MAXP)) {
+									font->gpos_res = MUTT_GPOS_REQUIRES_MAXP;
+									break;
+								}
+								// Continue if dependencies aren't processed
+								if (!font->maxp) {
+									*waiting |= MUTT_LOAD_GPOS;
+									break;
+								}
+								// Mark as no longer waiting
+								*waiting &= ~MUTT_LOAD_GPOS;
+
+								// Load
+								font->gpos_res = mutt_LoadGpos(font, &data[rec.offset], rec.length);
+								if (font->gpos) {
+									font->load_flags |= MUTT_LOAD_GPOS;
+									font->fail_load_flags &= ~MUTT_LOAD_GPOS;
+								} else {
+									font->fail_load_flags |= MUTT_LOAD_GPOS;
+									font->load_flags &= ~MUTT_LOAD_GPOS;
+								}
+							} break;
+						}
+					}
+				}
+
+				// Performs table load passes until no table is waiting on another
+				void mutt_LoadTablePasses(muttFont* font, muByte* data) {
+					muttLoadFlags temp_flags = 0;
+					muttLoadFlags wait_flags = 0;
+					mutt_LoadTables(font, data, &temp_flags, MU_TRUE, &wait_flags);
+					while (wait_flags) {
+						mutt_LoadTables(font, data, &temp_flags, MU_FALSE, &wait_flags);
+					}
+				}
+
+				// Returns a pointer to the result of a table based on its load flag
+				muttResult* mutt_TableRes(muttFont* font, muttLoadFlags flag) {
+					switch (flag) {
+						default: return 0; break;
+						case MUTT_LOAD_MAXP: return &font->maxp_res; break;
+						case MUTT_LOAD_HEAD: return &font->head_res; break;
+						case MUTT_LOAD_HHEA: return &font->hhea_res; break;
+						case MUTT_LOAD_HMTX: return &font->hmtx_res; break;
+						case MUTT_LOAD_LOCA: return &font->loca_res; break;
+						case MUTT_LOAD_POST: return &font->post_res; break;
+						case MUTT_LOAD_NAME: return &font->name_res; break;
+						case MUTT_LOAD_GLYF: return &font->glyf_res; break;
+						case MUTT_LOAD_CMAP: return &font->cmap_res; break;
+						case MUTT_LOAD_KERN: return &font->kern_res; break;
+						case MUTT_LOAD_GPOS: return &font->gpos_res; break;
+					}
+				}
+
+				MUDEF void mutt_lazy_load(muttFont* font, muttLoadFlags load_flags) {
+					// Add dependencies
+					if (load_flags & MUTT_LOAD_HMTX) {
+						load_flags |= MUTT_LOAD_MAXP | MUTT_LOAD_HHEA;
+					}
+					if (load_flags & MUTT_LOAD_HHEA) {
+						load_flags |= MUTT_LOAD_MAXP;
+					}
+					if (load_flags & MUTT_LOAD_LOCA) {
+						load_flags |= MUTT_LOAD_MAXP | MUTT_LOAD_HEAD | MUTT_LOAD_GLYF;
+					}
+					if (load_flags & MUTT_LOAD_CMAP_LOOKUP) {
+						load_flags |= MUTT_LOAD_CMAP;
+					}
+					if (load_flags & MUTT_LOAD_CMAP) {
+						// (Lookup table is built along with cmap)
+						load_flags |= MUTT_LOAD_MAXP | MUTT_LOAD_CMAP_LOOKUP;
+					}
+					if (load_flags & (MUTT_LOAD_POST | MUTT_LOAD_KERNING)) {
+						load_flags |= MUTT_LOAD_MAXP;
+					}
+
+					// Only parse pending tables
+					load_flags &= font->lazy_flags;
+					if (!load_flags) {
+						return;
+					}
+					font->lazy_flags &= ~load_flags;
+
+					// Mark tables as unprocessed, exactly how mutt_InitTables does
+					font->fail_load_flags |= load_flags;
+					for (muttLoadFlags f = 1; f <= MUTT_LOAD_GPOS; f <<= 1) {
+						if (load_flags & f & MUTT_TABLE_FLAGS) {
+							*mutt_TableRes(font, f) = MUTT_FAILED_FIND_TABLE;
+						}
+					}
+
+					// Load tables
+					mutt_LoadTablePasses(font, font->data);
+				}
+
+				// Deallocates all loaded tables
+				// (Tables shared from another face are skipped)
+				void mutt_DeloadTables(muttFont* font) {
+					muttLoadFlags shared = font->shared_flags;
+
+					// Basic tables
+					if (font->maxp && !(shared & MUTT_LOAD_MAXP)) {
+						mutt_Free(font->allocator, font->maxp);
+					}
+					if (font->head && !(shared & MUTT_LOAD_HEAD)) {
+						mutt_Free(font->allocator, font->head);
+					}
+					if (font->hhea && !(shared & MUTT_LOAD_HHEA)) {
+						mutt_Free(font->allocator, font->hhea);
+					}
+
+					// Allocated tables
+					if (!(shared & MUTT_LOAD_HMTX)) {
+						mutt_DeloadHmtx(font, font->hmtx);
+					}
+					if (!(shared & MUTT_LOAD_LOCA)) {
+						mutt_DeloadLoca(font, font->loca);
+					}
+					muBool borrowed = (font->load_flags & MUTT_LOAD_NO_COPY) != 0;
+					if (!(shared & MUTT_LOAD_POST)) {
+						mutt_DeloadPost(font, font->post, borrowed);
+					}
+					if (!(shared & MUTT_LOAD_NAME)) {
+						mutt_DeloadName(font, font->name, borrowed);
+					}
+					if (!(shared & MUTT_LOAD_GLYF)) {
+						mutt_DeloadGlyf(font, font->glyf, borrowed);
+					}
+					if (!(shared & MUTT_LOAD_CMAP)) {
+						mutt_DeloadCmap(font, font->cmap);
+					}
+					if (!(shared & MUTT_LOAD_KERN)) {
+						mutt_DeloadKern(font, font->kern);
+					}
+					if (!(shared & MUTT_LOAD_GPOS)) {
+						mutt_DeloadGpos(font, font->gpos);
+					}
+				}
+
+				// Finds the table record for a table tag; 0 if not found
+				muttTableRecord* mutt_FindRecord(muttDirectory* dir, uint32_m tag) {
+					for (uint16_m i = 0; i < dir->num_tables; ++i) {
+						if (dir->records[i].table_tag_u32 == tag) {
+							return &dir->records[i];
+						}
+					}
+					return 0;
+				}
+
+				// Returns the tables that a table depends on based on its load flag
+				muttLoadFlags mutt_TableDeps(muttLoadFlags flag) {
+					switch (flag) {
+						default: return 0; break;
+						case MUTT_LOAD_HHEA: return MUTT_LOAD_MAXP; break;
+						case MUTT_LOAD_HMTX: return MUTT_LOAD_MAXP | MUTT_LOAD_HHEA; break;
+						case MUTT_LOAD_LOCA: return MUTT_LOAD_MAXP | MUTT_LOAD_HEAD | MUTT_LOAD_GLYF; break;
+						case MUTT_LOAD_POST: return MUTT_LOAD_MAXP; break;
+						case MUTT_LOAD_CMAP: return MUTT_LOAD_MAXP; break;
+						case MUTT_LOAD_KERN: return MUTT_LOAD_MAXP; break;
+						case MUTT_LOAD_GPOS: return MUTT_LOAD_MAXP; break;
+					}
+				}
+
+				// Returns the table tag of a table based on its load flag
+				uint32_m mutt_TableTag(muttLoadFlags flag) {
+					switch (flag) {
+						default: return 0; break;
+						case MUTT_LOAD_MAXP: return 0x6D617870; break;
+						case MUTT_LOAD_HEAD: return 0x68656164; break;
+						case MUTT_LOAD_HHEA: return 0x68686561; break;
+						case MUTT_LOAD_HMTX: return 0x686D7478; break;
+						case MUTT_LOAD_LOCA: return 0x6C6F6361; break;
+						case MUTT_LOAD_POST: return 0x706F7374; break;
+						case MUTT_LOAD_NAME: return 0x6E616D65; break;
+						case MUTT_LOAD_GLYF: return 0x676C7966; break;
+						case MUTT_LOAD_CMAP: return 0x636D6170; break;
+						case MUTT_LOAD_KERN: return 0x6B65726E; break;
+						case MUTT_LOAD_GPOS: return 0x47504F53; break;
+					}
+				}
+
+				// Returns if a table and all of its dependencies are stored at the same
+				// location for two faces
+				muBool mutt_SameTable(muttFont* a, muttFont* b, muttLoadFlags flag) {
+					muttLoadFlags flags = flag | mutt_TableDeps(flag);
+					for (muttLoadFlags f = 1; f <= MUTT_LOAD_GPOS; f <<= 1) {
+						if (!(flags & f)) {
+							continue;
+						}
+						muttTableRecord* ra = mutt_FindRecord(a->directory, mutt_TableTag(f));
+						muttTableRecord* rb = mutt_FindRecord(b->directory, mutt_TableTag(f));
+						if (!ra || !rb || ra->offset != rb->offset || ra->length != rb->length) {
+							return MU_FALSE;
+						}
+					}
+					return MU_TRUE;
+				}
+
+				// Points a font's table to the same table loaded by another face
+				void mutt_ShareTable(muttFont* font, muttFont* src, muttLoadFlags flag) {
+					switch (flag) {
+						default: return; break;
+						case MUTT_LOAD_MAXP: font->maxp = src->maxp; break;
+						case MUTT_LOAD_HEAD: font->head = src->head; break;
+						case MUTT_LOAD_HHEA: font->hhea = src->hhea; break;
+						case MUTT_LOAD_HMTX: font->hmtx = src->hmtx; break;
+						case MUTT_LOAD_LOCA: font->loca = src->loca; break;
+						case MUTT_LOAD_POST: font->post = src->post; break;
+						case MUTT_LOAD_NAME: font->name = src->name; break;
+						case MUTT_LOAD_GLYF: font->glyf = src->glyf; break;
+						case MUTT_LOAD_CMAP: font->cmap = src->cmap; break;
+						case MUTT_LOAD_KERN: font->kern = src->kern; break;
+						case MUTT_LOAD_GPOS: font->gpos = src->gpos; break;
+					}
+					*mutt_TableRes(font, flag) = *mutt_TableRes(src, flag);
+					font->load_flags |= flag;
+					font->fail_load_flags &= ~flag;
+					font->shared_flags |= flag;
+				}
+
+				// Shares any requested table already loaded by a previous face
+				void mutt_ShareTables(muttFont* font, muttFont* faces, uint32_m num_faces) {
+					for (muttLoadFlags f = 1; f <= MUTT_LOAD_GPOS; f <<= 1) {
+						// Skip if not requested
+						if (!(font->fail_load_flags & f & MUTT_TABLE_FLAGS)) {
+							continue;
+						}
+
+						// Find a face that loaded the same table
+						for (uint32_m i = 0; i < num_faces; ++i) {
+							muttFont* src = &faces[i];
+							if (!(src->load_flags & f) || !mutt_SameTable(font, src, f)) {
+								continue;
+							}
+							// - cmap is only shared if the lookup table is the same
+							if (f == MUTT_LOAD_CMAP && (font->fail_load_flags & MUTT_LOAD_CMAP_LOOKUP)) {
+								if (!(src->load_flags & MUTT_LOAD_CMAP_LOOKUP)) {
+									continue;
+								}
+								font->load_flags |= MUTT_LOAD_CMAP_LOOKUP;
+								font->fail_load_flags &= ~MUTT_LOAD_CMAP_LOOKUP;
+							}
+
+							mutt_ShareTable(font, src, f);
+							break;
+						}
+					}
+				}
+
+				// Loads a face, sharing tables with previously-loaded faces
+				muttResult mutt_LoadFace(muByte* data, uint64_m datalen, uint32_m face_index, muttFont* font, muttLoadFlags load_flags, muttAllocator* allocator, muttFont* faces, uint32_m num_faces) {
+					muttResult res;
+
+					// Zero-out font
+					mu_memset(font, 0, sizeof(muttFont));
+					font->allocator = allocator;
+
+					// Find face
+					uint32_m offset;
+					res = mutt_FaceOffset(data, datalen, face_index, &offset);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+
+					// Load table directory
+					// - Allocate
+					font->directory = (muttDirectory*)mutt_Malloc(font->allocator, sizeof(muttDirectory));
+					if (!font->directory) {
+						// mutt_deload(font);
+						return MUTT_FAILED_MALLOC;
+					}
+					// - Load
+					res = mutt_LoadTableDirectory(font, font->directory, data, datalen, offset, !(load_flags & MUTT_LOAD_NO_CHECKSUM));
+					if (mutt_result_is_fatal(res)) {
+						mutt_deload(font);
+						return res;
+					}
+
+					// Init tables
+					mutt_InitTables(font, load_flags);
+
+					// Mark tables as pending if lazy
+					if (load_flags & MUTT_LOAD_LAZY) {
+						font->data = data;
+						font->lazy_flags = font->fail_load_flags;
+						font->fail_load_flags = 0;
+						for (muttLoadFlags f = 1; f <= MUTT_LOAD_GPOS; f <<= 1) {
+							if (font->lazy_flags & f & MUTT_TABLE_FLAGS) {
+								*mutt_TableRes(font, f) = MUTT_TABLE_NOT_LOADED;
+							}
+						}
+						return MUTT_SUCCESS;
+					}
+
+					// Share tables with previous faces
+					if (num_faces) {
+						mutt_ShareTables(font, faces, num_faces);
+					}
+
+					// Load tables
+					mutt_LoadTablePasses(font, data);
+					return MUTT_SUCCESS;
+				}
+
+				MUDEF muttResult mutt_load(muByte* data, uint64_m datalen, muttFont* font, muttLoadFlags load_flags) {
+					return mutt_LoadFace(data, datalen, 0, font, load_flags, 0, 0, 0);
+				}
+
+				MUDEF muttResult mutt_load_face(muByte* data, uint64_m datalen, uint32_m face_index, muttFont* font, muttLoadFlags load_flags, muttAllocator* allocator) {
+					return mutt_LoadFace(data, datalen, face_index, font, load_flags, allocator, 0, 0);
+				}
+
+				MUDEF void mutt_deload(muttFont* font) {
+					// Destroy outline cache
+					mutt_outline_cache_destroy(font);
+					// Deload tables
+					mutt_DeloadTables(font);
+					// Deload table directory
+					if (font->directory) {
+						mutt_DeloadTableDirectory(font, font->directory);
+						mutt_Free(font->allocator, font->directory);
+					}
+				}
+
+				MUDEF muttResult mutt_collection_faces(muByte* data, uint64_m datalen, uint32_m* num_faces) {
+					return mutt_CollectionFaces(data, datalen, num_faces);
+				}
+
+				MUDEF muttResult mutt_load_collection(muByte* data, uint64_m datalen, muttFont* fonts, uint32_m num_faces, muttLoadFlags load_flags, muttAllocator* allocator) {
+					// Don't share tables that aren't loaded yet
+					muBool share = !(load_flags & MUTT_LOAD_LAZY);
+
+					// Load each face
+					for (uint32_m f = 0; f < num_faces; ++f) {
+						muttResult res = mutt_LoadFace(data, datalen, f, &fonts[f], load_flags, allocator, fonts, (share) ?(f) :(0));
+						if (mutt_result_is_fatal(res)) {
+							mutt_deload_collection(fonts, f);
+							return res;
+						}
+					}
+					return MUTT_SUCCESS;
+				}
+
+				MUDEF void mutt_deload_collection(muttFont* fonts, uint32_m num_faces) {
+					// Deload in reverse, since faces only point to tables of faces before them
+					while (num_faces) {
+						mutt_deload(&fonts[--num_faces]);
+					}
+				}
+
+				MUDEF muttResult mutt_map_file(const char* path, muByte** data, uint64_m* datalen) {
+				#if defined(MUTT_MAP_FILE_POSIX)
+					// Open file
+					int fd = open(path, O_RDONLY);
+					if (fd < 0) {
+						return MUTT_FAILED_OPEN_FILE;
+					}
+
+					// Get file size
+					struct stat st;
+					if (fstat(fd, &st) != 0) {
+						close(fd);
+						return MUTT_FAILED_OPEN_FILE;
+					}
+					// - Verify that it can be mapped
+					if (st.st_size <= 0 || (uint64_m)st.st_size > (uint64_m)((size_m)-1)) {
+						close(fd);
+						return MUTT_FAILED_MAP_FILE;
+					}
+
+					// Map file
+					void* map = mmap(0, (size_m)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+					// - File descriptor isn't needed once mapped
+					close(fd);
+					if (map == MAP_FAILED) {
+						return MUTT_FAILED_MAP_FILE;
+					}
+
+					*data = (muByte*)map;
+					*datalen = (uint64_m)st.st_size;
+					return MUTT_SUCCESS;
+				#else
+					if (path) {}
+					if (data) {}
+					if (datalen) {}
+					return MUTT_FAILED_MAP_FILE;
+				#endif
+				}
+
+				MUDEF void mutt_unmap_file(muByte* data, uint64_m datalen) {
+				#if defined(MUTT_MAP_FILE_POSIX)
+					if (data) {
+						munmap(data, (size_m)datalen);
+					}
+				#else
+					if (data) {}
+					if (datalen) {}
+				#endif
+				}
+
+			/* Glyf stuff */
+
+				// Fills in the "muttGlyphHeader" struct
+				MUDEF muttResult mutt_glyph_header(muttFont* font, uint16_m glyph_id, muttGlyphHeader* header) {
+					MUTT_LAZY_LOAD(font, MUTT_LAZY_GLYPH)
+
+					// Get length and data of glyph
+					// - 16-bit
+					if (font->head->index_to_loc_format == 0) {
+						header->data = &font->glyf->data[((uint32_m)font->loca->offsets16[glyph_id])*2];
+						header->length = (((uint32_m)font->loca->offsets16[glyph_id+1])*2) - (((uint32_m)font->loca->offsets16[glyph_id])*2);
+					}
+					// - 32-bit
+					else {
+						header->data = &font->glyf->data[font->loca->offsets32[glyph_id]];
+						header->length = font->loca->offsets32[glyph_id+1] - font->loca->offsets32[glyph_id];
+					}
+
+					// If header length is 0, we set everything to 0 and return
+					// (because no outline)
+					if (header->length == 0) {
+						mu_memset(header, 0, sizeof(muttGlyphHeader));
+						header->glyph_id = glyph_id;
+						return MUTT_SUCCESS;
+					}
+					header->glyph_id = glyph_id;
+
+					// Verify minimum length for header
+					if (header->length < 10) {
+						return MUTT_INVALID_GLYF_HEADER_LENGTH;
+					}
+
+					// numberOfContours
+					header->number_of_contours = MU_RBES16(header->data);
+					if (header->number_of_contours > font->maxp->max_contours) {
+						return MUTT_INVALID_GLYF_HEADER_NUMBER_OF_CONTOURS;
+					}
+
+					// xMin
+					header->x_min = MU_RBES16(header->data+2);
+					if (header->x_min < font->head->x_min) {
+						return MUTT_INVALID_GLYF_HEADER_X_MIN;
+					}
+					// yMin
+					header->y_min = MU_RBES16(header->data+4);
+					if (header->y_min < font->head->y_min) {
+						return MUTT_INVALID_GLYF_HEADER_Y_MIN;
+					}
+					// xMax
+					header->x_max = MU_RBES16(header->data+6);
+					if (header->x_max > font->head->x_max) {
+						return MUTT_INVALID_GLYF_HEADER_X_MAX;
+					}
+					if (header->x_max < header->x_min) {
+						return MUTT_INVALID_GLYF_HEADER_X_MIN_MAX;
+					}
+					// yMax
+					header->y_max = MU_RBES16(header->data+8);
+					if (header->y_max > font->head->y_max) {
+						return MUTT_INVALID_GLYF_HEADER_Y_MAX;
+					}
+					if (header->y_max < header->y_min) {
+						return MUTT_INVALID_GLYF_HEADER_Y_MIN_MAX;
+					}
+
+					// Subtract header data from length
+					header->length -= 10;
+					// ...and move data up past header
+					header->data += 10;
+
+					return MUTT_SUCCESS;
+				}
+
+				// Fills in (or calculates memory needed for) "muttSimpleGlyph" struct
+				MUDEF muttResult mutt_simple_glyph(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muByte* data, uint32_m* written) {
+					muttResult res = MUTT_SUCCESS;
+
+					// Verify length for endPtsOfContours and instructionLength
+					// (req is u64 to avoid possible overflow)
+					uint64_m req = (((uint32_m)header->number_of_contours)*2) + 2;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					}
+
+					// Glyph data:
+					muByte* gdata = header->data;
+
+					// Memory size calculation:
+					if (!data) {
+						// Add endPtsOfContours to memory
+						uint32_m min_size = header->number_of_contours*2;
+
+						// To calculate amount of points:
+						uint16_m points = 0;
+						if (header->number_of_contours != 0) {
+							// Skip to last element of endPtsOfContours and read
+							gdata += (uint32_m)(header->number_of_contours-1)*2;
+							points = MU_RBEU16(gdata);
+
+							// Verify last element of endPtsOfContours
+							if (points == 0xFFFF) {
+								return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+							}
+
+							// Skip past last element
+							++points;
+							gdata += 2;
+						}
+
+						// Verify point count
+						if (points > font->maxp->max_points) {
+							return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+						}
+						// Add points to memory
+						min_size += ((uint32_m)points)*sizeof(muttGlyphPoint);
+
+						// Add instructions to memory
+						uint16_m instruction_length = MU_RBEU16(gdata);
+						if (instruction_length > font->maxp->max_size_of_instructions) {
+							return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
+						}
+						min_size += instruction_length;
+
+						// Check for size fitting
+						// This should not need to be checked, as it is calculated via maxp,
+						// to which all of these values are also checked to not exceed.
+						/*if (min_size > mutt_simple_glyph_max_size(font)) {
+							return MUTT_INVALID_GLYF_SIMPLE_;
+						}*/
+
+						// Set memory req
+						*written = min_size;
+						return MUTT_SUCCESS;
+					}
+
+					// Store pointer to original data
+					muByte* orig_data = data;
+
+					// Allocate endPtsOfContours
+					glyph->end_pts_of_contours = (uint16_m*)data;
+					data += ((uint32_m)header->number_of_contours)*2;
+
+					// Loop through each contour
+					uint16_m points = 0;
+					for (uint16_m c = 0; c < header->number_of_contours; ++c) {
+						// Copy value for endPtsOfContour
+						glyph->end_pts_of_contours[c] = MU_RBEU16(gdata);
+
+						// Verify increasing order
+						if (c != 0) {
+							if (glyph->end_pts_of_contours[c] <= glyph->end_pts_of_contours[c-1]) {
+								return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+							}
+						}
+
+						// Get point count if we're on the last index
+						if (c == header->number_of_contours-1) {
+							points = glyph->end_pts_of_contours[c];
+							// Verify last element
+							if (points == 0xFFFF) {
+								return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+							}
+							// Increment points by one to get count (since last value is an index)
+							++points;
+						}
+
+						// Move to next entry in endPtsOfContours
+						gdata += 2;
+					}
+
+					// Verify point count
+					if (points > font->maxp->max_points) {
+						return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+					}
+
+					// instructionLength
+					glyph->instruction_length = MU_RBEU16(gdata);
+					gdata += 2;
+					// + Verify instructionLength
+					if (glyph->instruction_length > font->maxp->max_size_of_instructions) {
+						return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
+					}
+
+					// For instructions:
+					if (glyph->instruction_length != 0) {
+						// Verify length for instructions
+						req += glyph->instruction_length;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						}
+						// Allocate
+						glyph->instructions = (uint8_m*)data;
+						// Copy over
+						mu_memcpy(glyph->instructions, gdata, glyph->instruction_length);
+						// Move past instructions
+						data += glyph->instruction_length;
+						gdata += glyph->instruction_length;
+					}
+
+					// Allocate points
+					glyph->points = (muttGlyphPoint*)data;
+					data += points*sizeof(muttGlyphPoint);
+
+					// Loop through each flag
+					uint16_m pi = 0; // (point index)
+					uint16_m contour_id = 0;
+					while (pi < points) {
+						// Increment contour ID if we've gone over the end point of the current contour
+						if (pi > glyph->end_pts_of_contours[contour_id]) {
+							++contour_id;
+						}
+						// Verify length for this flag
+						if (header->length < ++req) {
+							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						}
+
+						// Get flag
+						uint8_m flags = *gdata;
+						glyph->points[pi].flags = flags;
+
+						// Verify that flag doesn't rely on prior values if this is the first flag
+						// (Some common fonts get this messed up; we're assuming 0 in these cases)
+						// This is brought up in the documentation.
+						// ...
+
+						// Verify that first point is on curve
+						// (Not checking for similar reasons above, also brought up in doc)
+						// ...
+
+						// Get implied length of x- and y-coordinates based on flag
+						uint8_m coord_length = 0;
+						// - x
+						if (flags & MUTT_X_SHORT_VECTOR) {
+							// 1-byte x-coordinate
+							coord_length += 1;
+						} else if (!(flags & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR)) {
+							// 2-byte x-coordinate
+							coord_length += 2;
+						}
+						// -y
+						if (flags & MUTT_Y_SHORT_VECTOR) {
+							// 1-byte y-coordinate
+							coord_length += 1;
+						} else if (!(flags & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR)) {
+							// 2-byte y-coordinate
+							coord_length += 2;
+						}
+
+						// Verify length based on coord length
+						req += coord_length;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						}
+
+						// Increment past this point/flag
+						++pi;
+						++gdata;
+
+						// Handle repeating flags:
+						if (flags & MUTT_REPEAT_FLAG) {
+							// Verify length for next flag
+							if (header->length < ++req) {
+								return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+							}
+
+							// Get next flag as length
+							uint8_m next = *gdata++;
+							// (required length is checked next loop)
+							// - If next is 0, we don't repeat at all, and pretend
+							// like this never happened
+							if (next == 0) {
+								continue;
+							}
+
+							// Verify length for repeated coordinate flags
+							req += ((uint32_m)coord_length) * ((uint32_m)next-1);
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+							}
+
+							// Verify repeat count
+							// Not doing this since we can easily pretend like it didn't
+							// happen to no consequence.
+							// This is mentioned in documentation
+							/*if (pi+next > points) {
+								return MUTT_INVALID_GLYF_SIMPLE_FLAG_REPEAT_COUNT;
+							}*/
+
+							// Go through each repeat flag and copy it down
+							for (uint8_m r = 0; r < next && pi < points; ++r) {
+								glyph->points[pi++].flags = flags;
+							}
+						}
+					}
+
+					// Loop through each x-coordinate
+					int16_m x_min = 0;
+					int16_m x_max = 0;
+					pi = 0;
+					while (pi < points) {
+						// Get flags
+						uint8_m flags = glyph->points[pi].flags;
+
+						// Get x-coordinate
+						if (flags & MUTT_X_SHORT_VECTOR) {
+							// 1-byte
+							if (flags & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
+								// Positive
+								glyph->points[pi].x = (int16_m)*gdata++;
+							} else {
+								// Negative
+								glyph->points[pi].x = -((int16_m)*gdata++);
+							}
+						} else {
+							if (flags & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
+								// Repeated x-coordinate
+								glyph->points[pi].x = (pi!=0) ?(glyph->points[pi-1].x) :(0);
+								++pi;
+								// (Continue because no vector stuff is applied)
+								continue;
+							} else {
+								// 2-bytes, signed
+								glyph->points[pi].x = MU_RBES16(gdata);
+								gdata += 2;
+							}
+						}
+
+						// Add as vector to prior value
+						// - Get previous x value
+						int16_m prev_x = (pi!=0) ?(glyph->points[pi-1].x) :(0);
+						// - Compute the current coordinate based on previous
+						int32_m test_val = prev_x + glyph->points[pi].x;
+						// - Verify that the point is within range
+						if (test_val < header->x_min || test_val > header->x_max) {
+							res = MUTT_INVALID_GLYF_SIMPLE_X_COORD;
+						}
+						// - Verify that the point is within FUnit range
+						if (test_val < -16384 || test_val > 16383) {
+							return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
+						}
+						// - Consider it with currently calculated x min/max
+						if ((test_val < x_min) || (pi == 0)) {
+							x_min = test_val;
+						}
+						if ((test_val > x_max) || (pi == 0)) {
+							x_max = test_val;
+						}
+						// - Assign
+						glyph->points[pi++].x = (int16_m)test_val;
+					}
+
+					// Loop through each y-coordinate
+					int16_m y_min = 0;
+					int16_m y_max = 0;
+					pi = 0;
+					while (pi < points) {
+						// Get flags
+						uint8_m flags = glyph->points[pi].flags;
+
+						// Get y-coordinate
+						if (flags & MUTT_Y_SHORT_VECTOR) {
+							// 1-byte
+							if (flags & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
+								// Positive
+								glyph->points[pi].y = (int16_m)*gdata++;
+							} else {
+								// Negative
+								glyph->points[pi].y = -((int16_m)*gdata++);
+							}
+						} else {
+							if (flags & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
+								// Repeated y-coordinate
+								glyph->points[pi].y = (pi!=0) ?(glyph->points[pi-1].y) :(0);
+								++pi;
+								// (Continue because no vector stuff is applied)
+								continue;
+							} else {
+								// 2-bytes, signed
+								glyph->points[pi].y = MU_RBES16(gdata);
+								gdata += 2;
+							}
+						}
+
+						// Add as vector to prior value
+						// - Get previous y value
+						int16_m prev_y = (pi!=0) ?(glyph->points[pi-1].y) :(0);
+						// - Compute the current coordinate based on previous
+						int32_m test_val = prev_y + glyph->points[pi].y;
+						// - Verify that the point is within range
+						if (test_val < header->y_min || test_val > header->y_max) {
+							res = MUTT_INVALID_GLYF_SIMPLE_Y_COORD;
+						}
+						// - Verify that the point is within FUnit range
+						if (test_val < -16384 || test_val > 16383) {
+							return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
+						}
+						// - Consider it with currently calculated y min/max values
+						if ((test_val < y_min) || (pi == 0)) {
+							y_min = test_val;
+						}
+						if ((test_val > y_max) || (pi == 0)) {
+							y_max = test_val;
+						}
+						// - Assign
+						glyph->points[pi++].y = (int16_m)test_val;
+					}
+
+					// Write calculated x/y min/max values
+					header->x_min = x_min;
+					header->y_min = y_min;
+					header->x_max = x_max;
+					header->y_max = y_max;
+					// Write how many bytes of data were used
+					if (written) {
+						*written = data-orig_data;
+					}
+					return res;
+				}
+
+				// Calculates amount of points within a simple glyph
+				MUDEF muttResult mutt_simple_glyph_points(muttFont* font, muttGlyphHeader* header, uint16_m* num_points) {
+					// Give 0 for no contours
+					if (header->number_of_contours == 0) {
+						*num_points = 0;
+						return MUTT_SUCCESS;
+					}
+
+					// Verify length for endPtsOfContours
+					uint32_m req = ((uint32_m)header->number_of_contours) * 2;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					}
+
+					// Skip to last element of endPtsOfContours and read
+					uint16_m rnum_points = MU_RBEU16(header->data + (((uint32_m)(header->number_of_contours-1)) * 2));
+					// Verify number of points won't overflow
+					if (rnum_points == 0xFFFF) {
+						return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+					}
+					// See if point count is good for maxp
+					if (++rnum_points > font->maxp->max_points) {
+						return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+					}
+
+					// Write point count and give success
+					*num_points = rnum_points;
+					return MUTT_SUCCESS;
+				}
+
+				// Simple glyph memory maximum
+				MUDEF uint32_m mutt_simple_glyph_max_size(muttFont* font) {
+					MUTT_LAZY_LOAD(font, MUTT_LOAD_MAXP)
+					return
+						// endPtsOfContours
+						(font->maxp->max_contours*2)
+						// instructions
+						+(font->maxp->max_size_of_instructions)
+						// maxPoints
+						+(font->maxp->max_points*sizeof(muttGlyphPoint))
+					;
+				}
+
+				// Calculates the x/y min/max for the given simple glyph
+				MUDEF muttResult mutt_simple_glyph_min_max(muttFont* font, muttGlyphHeader* header) {
+					// Verify length for endPtsOfContours and instructionLength
 					uint64_m req = (((uint32_m)header->number_of_contours)*2) + 2;
 					if (header->length < req) {
-						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					}
+
+					// Progressive glyph data:
+					// (Move to endPtsOfContours[numContours-1])
+					muByte* data = header->data + (req-4);
+					// Read last element of endPtsOfContours
+					uint16_m num_points = MU_RBEU16(data);
+					data += 2;
+					// Verify it for number of points
+					if (num_points++ == 0xFFFF) {
+						return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+					}
+					if (num_points > font->maxp->max_points) {
+						return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+					}
+
+					// Read instructionLength
+					uint16_m instruction_len = MU_RBEU16(data);
+					data += 2;
+					// Verify instructions
+					req += instruction_len;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					}
+					// Move past instructions
+					data += instruction_len;
+
+					// Allocate flags
+					uint8_m* flags = (uint8_m*)mutt_Malloc(font->allocator, num_points);
+					if (!flags) {
+						return MUTT_FAILED_MALLOC;
+					}
+
+					// Loop through each flag
+					uint16_m pi = 0;
+					while (pi < num_points) {
+						// Verify length for this flag
+						if (header->length < ++req) {
+							mutt_Free(font->allocator, flags);
+							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						}
+
+						// Get flag
+						uint8_m flag = flags[pi] = *data;
+
+						// Get implied length of x- and y-coordinates based on flag
+						uint8_m coord_length = 0;
+						// - x
+						if (flag & MUTT_X_SHORT_VECTOR) {
+							// 1-byte x-coordinate
+							coord_length += 1;
+						} else if (!(flag & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR)) {
+							// 2-byte x-coordinate
+							coord_length += 2;
+						}
+						// - y
+						if (flag & MUTT_Y_SHORT_VECTOR) {
+							// 1-byte y-coordinate
+							coord_length += 1;
+						} else if (!(flag & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR)) {
+							// 2-byte y-coordinate
+							coord_length += 2;
+						}
+
+						// Verify length based on coord length
+						req += coord_length;
+						if (header->length < req) {
+							mutt_Free(font->allocator, flags);
+							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						}
+
+						// Increment past this point/flag
+						++pi;
+						++data;
+
+						// Handle repeating flags:
+						if (flag & MUTT_REPEAT_FLAG) {
+							// Verify length for next flag
+							if (header->length < ++req) {
+								mutt_Free(font->allocator, flags);
+								return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+							}
+
+							// Get next flag as length
+							uint8_m next = *data++;
+							// If next is 0, we don't repeat at all, and pretend
+							// like this never happened
+							if (next == 0) {
+								continue;
+							}
+
+							// Verify length for repeated coordinate flags
+							req += ((uint32_m)coord_length) * ((uint32_m)(next-1));
+							if (header->length < req) {
+								mutt_Free(font->allocator, flags);
+								return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+							}
+
+							// Go through each repeat flag and copy it down
+							for (uint8_m r = 0; r < next && pi < num_points; ++r) {
+								flags[pi++] = flag;
+							}
+						}
+					}
+
+					// Loop through each x-coordinate
+					pi = 0;
+					int16_m prev_x = 0;
+					while (pi < num_points) {
+						// Get x-coordinate
+						int16_m x;
+						if (flags[pi] & MUTT_X_SHORT_VECTOR) {
+							// 1-byte
+							if (flags[pi] & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
+								// Positive
+								x = (int16_m)*data++;
+							} else {
+								// Negative
+								x = -((int16_m)*data++);
+							}
+						} else {
+							if (flags[pi] & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
+								// Repeated x-coordinate
+								++pi;
+								continue;
+							} else {
+								// 2-bytes, signed
+								x = MU_RBES16(data);
+								data += 2;
+							}
+						}
+
+						// Add as vector to prior value
+						int32_m test_val = prev_x + x;
+						// Verify FUnit range
+						if (test_val < -16384 || test_val > 16383) {
+							mutt_Free(font->allocator, flags);
+							return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
+						}
+						// Consider it with currently calculated x min/max
+						if ((test_val < header->x_min) || (pi == 0)) {
+							header->x_min = test_val;
+						}
+						if ((test_val > header->x_max) || (pi == 0)) {
+							header->x_max = test_val;
+						}
+						// Set previous x as current x
+						prev_x = test_val;
+						++pi;
+					}
+
+					// Loop through each y-coordinate
+					pi = 0;
+					int16_m prev_y = 0;
+					while (pi < num_points) {
+						// Get y-coordinate
+						int16_m y;
+						if (flags[pi] & MUTT_Y_SHORT_VECTOR) {
+							// 1-byte
+							if (flags[pi] & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
+								// Positive
+								y = (int16_m)*data++;
+							} else {
+								// Negative
+								y = -((int16_m)*data++);
+							}
+						} else {
+							if (flags[pi] & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
+								// Repeated y-coordinate
+								++pi;
+								continue;
+							} else {
+								// 2 bytes, signed
+								y = MU_RBES16(data);
+								data += 2;
+							}
+						}
+
+						// Add as vector to prior value
+						int32_m test_val = prev_y + y;
+						// Verify FUnit range
+						if (test_val < -16384 || test_val > 16383) {
+							mutt_Free(font->allocator, flags);
+							return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
+						}
+						// Consider it with currently calculated y min/max
+						if ((test_val < header->y_min) || (pi == 0)) {
+							header->y_min = test_val;
+						}
+						if ((test_val > header->y_max) || (pi == 0)) {
+							header->y_max = test_val;
+						}
+						// Set previous y as current y
+						prev_y = test_val;
+						++pi;
+					}
+
+					// Deallocate flags
+					mutt_Free(font->allocator, flags);
+					return MUTT_SUCCESS; if (font) {}
+				}
+
+				// Fills in (or calculates memory needed for) "muttCompositeGlyph" struct
+				MUDEF muttResult mutt_composite_glyph(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muByte* data, uint32_m* written) {
+					// Placeholder variables
+					uint32_m req = 0; // Required length
+					muByte* gdata = header->data; // Progressive data pointer
+
+					// For memory calculations:
+					if (!data) {
+						// Loop through each record
+						uint16_m flags = (header->length != 0) ?(MUTT_MORE_COMPONENTS) :(0);
+						uint32_m written_amt = 0;
+						muBool instructions = MU_FALSE;
+						uint32_m component_count = 0;
+
+						while (flags & MUTT_MORE_COMPONENTS) {
+							// Verify component count
+							if (++component_count > font->maxp->max_component_elements) {
+								return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
+							}
+							// Add component to mem req
+							written_amt += sizeof(muttComponentGlyph);
+
+							// Verify length for flags and glyphIndex
+							req += 4;
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							}
+							// Read flags for if we have more components and instructions
+							uint16_m this_flags = MU_RBEU16(gdata);
+							flags = this_flags & MUTT_MORE_COMPONENTS;
+							if (this_flags & MUTT_WE_HAVE_INSTRUCTIONS) {
+								instructions = MU_TRUE;
+							}
+							// Skip past flags and glyphIndex
+							gdata += 4;
+
+							// Add arguments to req length and skip past
+							if (this_flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
+								// 2 bytes per
+								req += 4;
+								gdata += 4;
+							}
+							else {
+								// 1 byte per
+								req += 2;
+								gdata += 2;
+							}
+
+							// Add transform to req length and skip past
+							// We're not checking for mutual exclusivity here, as
+							// it's not relevant to mem req
+							if (this_flags & MUTT_WE_HAVE_A_SCALE) {
+								// One F2DOT14
+								req += 2;
+								gdata += 2;
+							}
+							else if (this_flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+								// Two F2DOT14s
+								req += 4;
+								gdata += 4;
+							}
+							else if (this_flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+								// Four F2DOT14s
+								req += 8;
+								gdata += 8;
+							}
+
+							// Verify length for arguments and transform
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							}
+						}
+
+						// Instruction handling
+						if (instructions) {
+							// Verify length for instruction length
+							req += 2;
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							}
+
+							// Read instruction length
+							uint16_m instruction_length = MU_RBEU16(gdata);
+							// Verify with maxp
+							if (instruction_length > font->maxp->max_size_of_instructions) {
+								return MUTT_INVALID_GLYF_COMPOSITE_INSTRUCTION_LENGTH;
+							}
+							// Verify length for instructions
+							// Unneeded here since we're just calculating mem req
+							// ...
+
+							// Add instructions to mem req
+							written_amt += instruction_length;
+						}
+
+						// Give mem req and exit
+						*written = written_amt;
+						return MUTT_SUCCESS;
+					}
+
+					// Placeholder variables:
+					muByte* orig_data = data; // (Used for memory usage at the end)
+					uint32_m component_count = 0; // (Used for counting components; u32 to avoid overflow)
+					muBool instructions = MU_FALSE; // (To see if we've found instructions)
+					uint16_m flags = (header->length != 0) ?(MUTT_MORE_COMPONENTS) :(0);
+
+					// Point components array to current data (what we're filling in)
+					glyph->components = (muttComponentGlyph*)data;
+					muttComponentGlyph* c = glyph->components;
+
+					// Loop through each component:
+					while (flags & MUTT_MORE_COMPONENTS) {
+						// Verify component count
+						if (component_count > font->maxp->max_component_elements) {
+							return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
+						}
+
+						// Verify length for flags and glyphIndex
+						req += 4;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read flags
+						c->flags = MU_RBEU16(gdata);
+						gdata += 2;
+						// Mark next component
+						flags = c->flags & MUTT_MORE_COMPONENTS;
+						// Mark instructions flag
+						if (c->flags & MUTT_WE_HAVE_INSTRUCTIONS) {
+							instructions = MU_TRUE;
+						}
+
+						// Read glyphIndex
+						c->glyph_index = MU_RBEU16(gdata);
+						gdata += 2;
+						// Verify index range
+						if (c->glyph_index >= font->maxp->num_glyphs) {
+							return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
+						}
+
+						// Arguments handling:
+						if (c->flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
+							// 2 bytes per argument
+
+							// Verify length
+							req += 4;
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							}
+
+							// Read values
+							if (c->flags & MUTT_ARGS_ARE_XY_VALUES) {
+								// int16 xy values
+								c->argument1 = MU_RBES16(gdata);
+								gdata += 2;
+								c->argument2 = MU_RBES16(gdata);
+								gdata += 2;
+							} else {
+								// uint16 point numbers
+								c->argument1 = MU_RBEU16(gdata);
+								gdata += 2;
+								c->argument2 = MU_RBEU16(gdata);
+								gdata += 2;
+							}
+						} else {
+							// 1 byte per argument
+
+							// Verify length
+							req += 2;
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							}
+
+							// Read values
+							if (c->flags & MUTT_ARGS_ARE_XY_VALUES) {
+								// int8 xy values
+								c->argument1 = MU_RBES8(gdata++);
+								c->argument2 = MU_RBES8(gdata++);
+							} else {
+								// uint8 point numbers
+								c->argument1 = *gdata++;
+								c->argument2 = *gdata++;
+							}
+						}
+
+						// Transform data handling
+						if (c->flags & MUTT_WE_HAVE_A_SCALE) {
+							// One F2DOT14
+
+							// Ensure flag exclusivity
+							if ((c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) || (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
+								return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+							}
+
+							// Verify length
+							req += 2;
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							}
+
+							// Read
+							c->scales[0] = MUTT_F2DOT14(gdata);
+							gdata += 2;
+						}
+						else if (c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+							// Two F2DOT14s
+
+							// Ensure flag exclusivity
+							if ((c->flags & MUTT_WE_HAVE_A_SCALE) || (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
+								return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+							}
+
+							// Verify length
+							req += 4;
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							}
+
+							// Read
+							c->scales[0] = MUTT_F2DOT14(gdata);
+							gdata += 2;
+							c->scales[1] = MUTT_F2DOT14(gdata);
+							gdata += 2;
+						}
+						else if (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+							// Four F2DOT14s
+
+							// Ensure flag exclusivity
+							if ((c->flags & MUTT_WE_HAVE_A_SCALE) || (c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE)) {
+								return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+							}
+
+							// Verify length
+							req += 8;
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							}
+
+							// Read
+							c->scales[0] = MUTT_F2DOT14(gdata);
+							gdata += 2;
+							c->scales[1] = MUTT_F2DOT14(gdata);
+							gdata += 2;
+							c->scales[2] = MUTT_F2DOT14(gdata);
+							gdata += 2;
+							c->scales[3] = MUTT_F2DOT14(gdata);
+							gdata += 2;
+						}
+
+						// Increment handle for component and component count
+						++c;
+						++component_count;
+					}
+					// Verify component count
+					if (component_count > font->maxp->max_component_elements) {
+						return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
+					}
+					// Move past component array
+					data += sizeof(muttComponentGlyph) * component_count;
+
+					// Instruction handling
+					if (instructions) {
+						// Point to data
+						glyph->instructions = data;
+
+						// Verify length for instruction length
+						req += 2;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read instruction length
+						glyph->instruction_length = MU_RBEU16(gdata);
+						gdata += 2;
+						// Verify with maxp
+						if (glyph->instruction_length > font->maxp->max_size_of_instructions) {
+							return MUTT_INVALID_GLYF_COMPOSITE_INSTRUCTION_LENGTH;
+						}
+
+						if (glyph->instruction_length > 0) {
+							// Verify length for instructions
+							req += glyph->instruction_length;
+							if (header->length < req) {
+								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							}
+
+							// Memcpy instructions
+							mu_memcpy(glyph->instructions, gdata, glyph->instruction_length);
+							// Move data past instructions
+							data += glyph->instruction_length;
+						}
+					} else {
+						glyph->instruction_length = 0;
+						glyph->instructions = 0;
+					}
+
+					// Copy over component count
+					glyph->component_count = (uint16_m)component_count;
+					// Write data written
+					if (written) {
+						*written = data-orig_data;
+					}
+					return MUTT_SUCCESS;
+				}
+
+				// Gets a component of a composite glyph
+				// no_more is set to true when no more components exist
+				MUDEF muttResult mutt_composite_component(muttFont* font, muttGlyphHeader* header, muByte** prog, muttComponentGlyph* component, muBool* no_more) {
+					// Much of this code is very similar to the code in mutt_composite_glyph
+
+					// So-far component length:
+					uint32_m req = (*prog) - header->data;
+
+					// Verify length for flags and glyphIndex
+					req += 4;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					}
+
+					// Read flags
+					component->flags = MU_RBEU16(*prog);
+					*prog += 2;
+					// Mark next component
+					if (!(component->flags & MUTT_MORE_COMPONENTS)) {
+						*no_more = MU_TRUE;
+					}
+
+					// Read glyphIndex
+					component->glyph_index = MU_RBEU16(*prog);
+					*prog += 2;
+					// Verify index range
+					if (component->glyph_index >= font->maxp->num_glyphs) {
+						return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
+					}
+
+					// Argument handling:
+					if (component->flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
+						// 2 bytes per arg.
+						req += 4;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read values
+						if (component->flags & MUTT_ARGS_ARE_XY_VALUES) {
+							// int16 xy values
+							component->argument1 = MU_RBES16(*prog);
+							*prog += 2;
+							component->argument2 = MU_RBES16(*prog);
+							*prog += 2;
+						} else {
+							// uint16 point numbers
+							component->argument1 = MU_RBEU16(*prog);
+							*prog += 2;
+							component->argument2 = MU_RBEU16(*prog);
+							*prog += 2;
+						}
+					}
+					else {
+						// 1 byte per arg.
+						req += 2;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read values
+						if (component->flags & MUTT_ARGS_ARE_XY_VALUES) {
+							// int8 xy values
+							component->argument1 = MU_RBES8((*prog)++);
+							component->argument2 = MU_RBES8((*prog)++);
+						} else {
+							// uint8 point numbers
+							component->argument1 = MU_RBEU8((*prog)++);
+							component->argument2 = MU_RBEU8((*prog)++);
+						}
+					}
+
+					// Transform data handling
+					if (component->flags & MUTT_WE_HAVE_A_SCALE) {
+						// One F2DOT14
+						req += 2;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Flag exclusivity
+						if ((component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) || (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
+							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+						}
+
+						// Read value
+						component->scales[0] = MUTT_F2DOT14(*prog);
+						*prog += 2;
+					}
+					else if (component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+						// Two F2DOT14s
+						req += 4;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Flag exclusivity
+						if ((component->flags & MUTT_WE_HAVE_A_SCALE) || (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
+							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+						}
+
+						// Read values
+						component->scales[0] = MUTT_F2DOT14(*prog);
+						*prog += 2;
+						component->scales[1] = MUTT_F2DOT14(*prog);
+						*prog += 2;
+					}
+					else if (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+						// Four F2DOT14s
+						req += 8;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Flag exclusivity
+						if ((component->flags & MUTT_WE_HAVE_A_SCALE) || (component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE)) {
+							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+						}
+
+						// Read values
+						component->scales[0] = MUTT_F2DOT14(*prog);
+						*prog += 2;
+						component->scales[1] = MUTT_F2DOT14(*prog);
+						*prog += 2;
+						component->scales[2] = MUTT_F2DOT14(*prog);
+						*prog += 2;
+						component->scales[3] = MUTT_F2DOT14(*prog);
+						*prog += 2;
+					}
+
+					return MUTT_SUCCESS;
+				}
+
+				// Gets the glyph index component by component within a composite glyph
+				// no_more is set to true when no more components exist
+				// ^ There will always be at least one component from what I'm aware
+				MUDEF muttResult mutt_composite_component_glyph(muttFont* font, muttGlyphHeader* header, muByte** prog, uint16_m* glyph_index, muBool* no_more) {
+					// prog is always at the beginning of a component record
+
+					// Ensure length for flags + glyphIndex
+					if (((*prog+4)-header->data) > header->length) {
+						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					}
+
+					// Read flags to see if there's any more after this
+					uint16_m flags = MU_RBEU16(*prog);
+					*prog += 2;
+					if (!(flags & MUTT_MORE_COMPONENTS)) {
+						*no_more = MU_TRUE;
+					}
+					// Read glyphIndex
+					uint16_m read_glyph_index = MU_RBEU16(*prog);
+					*prog += 2;
+					if (read_glyph_index >= font->maxp->num_glyphs) {
+						return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
+					}
+
+					// Increment prog past argument1 and argument2
+					if (flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
+						*prog += 4;
+					} else {
+						*prog += 2;
+					}
+
+					// Increment prog past transform data
+					// (Not checking for flag exclusivity)
+					if (flags & MUTT_WE_HAVE_A_SCALE) {
+						*prog += 2;
+					} else if (flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+						*prog += 4;
+					} else if (flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+						*prog += 8;
+					}
+
+					// (Not checking for length after argument1, argument2, and transform
+					// since we're not reading data from there)
+
+					// Write gylphIndex and give success
+					*glyph_index = read_glyph_index;
+					return MUTT_SUCCESS;
+				}
+
+				// Composite glyph memory maximum
+				MUDEF uint32_m mutt_composite_glyph_max_size(muttFont* font) {
+					MUTT_LAZY_LOAD(font, MUTT_LOAD_MAXP)
+					return
+						// components
+						(font->maxp->max_component_elements*sizeof(muttComponentGlyph))
+						// instructions
+						+(font->maxp->max_size_of_instructions)
+					;
+				}
+
+				// Glyph memory maximum
+				MUDEF uint32_m mutt_glyph_max_size(muttFont* font) {
+					// Simple:
+					uint32_m s = mutt_simple_glyph_max_size(font);
+					// Composite:
+					uint32_m c = mutt_composite_glyph_max_size(font);
+					// Return greatest
+					return (s>c) ?(s) :(c);
+				}
+
+			/* Misc. */
+
+				// Performs idDelta logic
+				MUDEF uint16_m mutt_id_delta(uint16_m character_code, int16_m delta) {
+					// Just return if idDelta is 0
+					if (delta == 0) {
+						return character_code;
+					}
+
+					// Do modulo 65536 on a larger type to add without overflow
+					int32_m big_id = (int32_m)(character_code + delta) % 65536;
+					// Prevent negative cases by adding 65536 for cases under 0
+					if (big_id < 0) {
+						big_id += 65536;
+					}
+					// Return that but now u16, which (I think) big_id is guaranteed to fit in
+					return (uint16_m)big_id;
+				}
+
+		/* Raster API */
+
+			/* Math */
+
+				// Float epsilon macro used for countering floating point imprecision in line calculations
+				// This value is unabashedly stolen from stb_truetype, but it works real well
+				#define MUTTR_LINE_EPSILON32 (1.f/1024.f)
+
+				// Double epsilon macro used for same purpose as MUTTR_LINE_EPSILON32; not used as of right now
+				// This value should be tested and vetted more thoroughly if it's going to be used
+				#define MUTTR_LINE_EPSILON64 0.00000001
+
+				// Calculates IF a ray intersects a line
+				static inline muBool muttR_LineRay(float ry, float y0, float y1) {
+					// Any of these conditions must be true for intersection:
+					return
+						// Ray y is between y0 and y1 with forgiving epsilons:
+						(ry >= y0-MUTTR_LINE_EPSILON32 && ry <= y1+MUTTR_LINE_EPSILON32) ||
+						(ry >= y1-MUTTR_LINE_EPSILON32 && ry <= y0+MUTTR_LINE_EPSILON32)
+						// Line is horizontal:
+						|| (y1-y0 == 0.f)
+					;
+				}
+
+				// Calculates the x-value intersection of a ray and a line
+				static inline float muttR_LineRayHit(float ry, float x0, float y0, float x1, float y1) {
+					// (https://math.stackexchange.com/a/2297532)
+					return x0 + (
+						((ry-y0) * (x1-x0))
+						/
+						(y1-y0)
+					);
+				}
+
+				// Calculates the x- and y-value of a point on a Bezier curve (on, off, on) given t.
+				static inline void muttR_Bezier(float t,
+					float x0, float y0, float x1, float y1, float x2, float y2,
+					float* x, float* y
+				) {
+					// I think this can be optimized, but idk...
+					*x = ((1.f-t)*(1.f-t)*x0) + (2.f*(1.f-t)*t*x1) + (t*t*x2);
+					*y = ((1.f-t)*(1.f-t)*y0) + (2.f*(1.f-t)*t*y1) + (t*t*y2);
+				}
+
+				// Fixed-point math (24.8)
+				// Everything past the conversion from float is integer-only, so results
+				// are the same bit-for-bit on every compiler and CPU
+				#define MUTTR_FIXED_SHIFT 8
+				#define MUTTR_FIXED_ONE (1 << MUTTR_FIXED_SHIFT)
+				#define MUTTR_FIXED_HALF (MUTTR_FIXED_ONE >> 1)
+				// Limit of fixed values; keeps every intermediate product within int64
+				#define MUTTR_FIXED_LIMIT (1 << 30)
+
+				// Converts a float to fixed-point, rounded to the nearest value
+				// (Multiplying by a power of 2 is exact, so this only rounds once)
+				static inline int32_m muttR_ToFixed(float v) {
+					float f = mu_floorf((v * (float)MUTTR_FIXED_ONE) + .5f);
+					// Clamp to limit (which also catches NaN)
+					if (!(f > -(float)MUTTR_FIXED_LIMIT)) {
+						return -MUTTR_FIXED_LIMIT;
+					}
+					if (!(f < (float)MUTTR_FIXED_LIMIT)) {
+						return MUTTR_FIXED_LIMIT;
+					}
+					return (int32_m)f;
+				}
+
+				// Divides, rounding towards negative infinity; b must be positive
+				// (C division truncates towards 0, which would round differently based on sign)
+				static inline int64_m muttR_FloorDiv(int64_m a, int64_m b) {
+					int64_m q = a / b;
+					if ((a % b) != 0 && a < 0) {
+						--q;
+					}
+					return q;
+				}
+
+				// Calculates the x-value intersection of a ray and a line in fixed-point
+				// y0 must be less than y1
+				static inline int32_m muttR_FixedLineRayHit(int32_m ry, int32_m x0, int32_m y0, int32_m x1, int32_m y1) {
+					return x0 + (int32_m)muttR_FloorDiv(((int64_m)(ry-y0)) * ((int64_m)(x1-x0)), (int64_m)(y1-y0));
+				}
+
+			/* Raster shape setup */
+
+				/* Definitions */
+
+					// A raster shape is made up of lines, a line is defined by two points
+					struct muttR_Line {
+						// 0 is bottom, 1 is top (y0 <= y1)
+						float x0;
+						float y0;
+						float x1;
+						float y1;
+						// vec = y1-y0 (for direction)
+						float vec;
+					};
+					typedef struct muttR_Line muttR_Line;
+
+					// Used to sort the lines in increasing order of bottom point
+					int muttR_CompareLines(const void* p, const void* q) {
+						// Get lines
+						muttR_Line* l0 = (muttR_Line*)p, * l1 = (muttR_Line*)q;
+						// Return value to indicate greatest y1 value
+						if (l0->y0 < l1->y0) {
+							return -1;
+						} else if (l0->y0 > l1->y0) {
+							return 1;
+						}
+						return 0;
+					}
+
+					// A fixed-point line; same as a regular line, but in 24.8 fixed-point
+					struct muttR_FixedLine {
+						// 0 is bottom, 1 is top (y0 <= y1)
+						int32_m x0;
+						int32_m y0;
+						int32_m x1;
+						int32_m y1;
+						// Winding of the line; 1 if it goes up, -1 if it goes down, 0 if horizontal
+						int32_m dir;
+					};
+					typedef struct muttR_FixedLine muttR_FixedLine;
+
+					// Used to sort the fixed-point lines in increasing order of bottom point
+					int muttR_CompareFixedLines(const void* p, const void* q) {
+						// Get lines
+						muttR_FixedLine* l0 = (muttR_FixedLine*)p, * l1 = (muttR_FixedLine*)q;
+						// Return value to indicate greatest y1 value
+						if (l0->y0 < l1->y0) {
+							return -1;
+						} else if (l0->y0 > l1->y0) {
+							return 1;
+						}
+						return 0;
+					}
+
+					// Calculates the winding for a given line
+					static inline int8_m muttR_LineWinding(float ry, muttR_Line* line) {
+						// Don't consider winding if we're directly intersecting the high point of line
+						if (mu_fabsf(ry - line->y0) <= MUTTR_LINE_EPSILON32) {
+							return 0;
+						}
+
+						// Return winding order based on vector; down is +1, up is -1, neither is 0
+						if (line->vec < 0.f) {
+							return 1;
+						} else if (line->vec > 0.f) {
+							return -1;
+						}
+						return 0;
+					}
+
+					// A raster shape is just a collection of lines representing a glyph
+					struct muttR_Shape {
+						uint32_m num_lines;
+						muttR_Line* lines;
+						float x_max;
+						float y_max;
+					};
+					typedef struct muttR_Shape muttR_Shape;
+
+					// Sorts the lines of a shape in increasing order of bottom point
+					// This is needed for the active line list to bucket lines by y
+					void muttR_ShapeSort(muttR_Shape* shape) {
+						// (Nothing to sort without at least two lines, and lines may be 0 without any)
+						if (shape->num_lines < 2) {
+							return;
+						}
+						// Just call qsort for the job
+						mu_qsort(shape->lines, shape->num_lines, sizeof(muttR_Line), muttR_CompareLines);
+					}
+
+					// A fixed-point raster shape
+					struct muttR_FixedShape {
+						uint32_m num_lines;
+						muttR_FixedLine* lines;
+						int32_m x_max;
+						int32_m y_max;
+					};
+					typedef struct muttR_FixedShape muttR_FixedShape;
+
+				/* Conversions */
+
+					// Converts two points to a line
+					void muttR_GlyphLine(muttR_Line* line, float x0, float y0, float x1, float y1) {
+						// Determine lowest y0 value
+						if (y0 < y1) {
+							line->x0 = x0;
+							line->y0 = y0;
+							line->x1 = x1;
+							line->y1 = y1;
+						}
+						else {
+							line->x0 = x1;
+							line->y0 = y1;
+							line->x1 = x0;
+							line->y1 = y0;
+						}
+						// Calculate vec
+						line->vec = y1-y0;
+					}
+
+					// Converts three-point Bezier (on, off, on) to lines
+					// The amount of lines is based on how curved the Bezier is, such that
+					// no line strays further than the tolerance (in pixels) from the curve.
+					// - Constants:
+					#define MUTTR_MAX_LINES_PER_BEZIER 64
+					// - Line count:
+					static inline uint32_m muttR_CurveLineCount(float x0, float y0, float x1, float y1, float x2, float y2, float tolerance) {
+						// The second derivative of a quadratic Bezier is constant,
+						// 2*(p0 - 2p1 + p2), and a line spanning 1/n of t strays from
+						// the curve by at most |p0 - 2p1 + p2| / (4n^2); solve for n
+						float dx = x0 - (2.f*x1) + x2;
+						float dy = y0 - (2.f*y1) + y2;
+						float n = mu_ceilf(mu_sqrtf(mu_sqrtf((dx*dx) + (dy*dy)) / (4.f*tolerance)));
+						// Clamp to valid range
+						if (!(n >= 1.f)) {
+							return 1;
+						}
+						if (n > (float)MUTTR_MAX_LINES_PER_BEZIER) {
+							return MUTTR_MAX_LINES_PER_BEZIER;
+						}
+						return (uint32_m)n;
+					}
+					// - Function:
+					// Returns the amount of lines; if line is 0, the lines are only counted
+					static inline uint32_m muttR_GlyphCurve(muttR_Line* line, float x0, float y0, float x1, float y1, float x2, float y2, float tolerance) {
+						// Calculate amount of lines for this Bezier
+						uint32_m num_lines = muttR_CurveLineCount(x0, y0, x1, y1, x2, y2, tolerance);
+						if (!line) {
+							return num_lines;
+						}
+						float num_lines_inv = 1.f / ((float)num_lines);
+
+						// Loop through each line per Bezier
+						float bx0 = x0, by0 = y0;
+						for (uint32_m l = 1; l <= num_lines; ++l) {
+							// Calculate Bezier for the second point
+							// (First point is just the last line's second point)
+							float t = ((float)l) * num_lines_inv;
+							float bx1, by1;
+							muttR_Bezier(t, x0, y0, x1, y1, x2, y2, &bx1, &by1);
+
+							// Make line based on this strip of the Bezier
+							muttR_GlyphLine(line++, bx0, by0, bx1, by1);
+							bx0 = bx1;
+							by0 = by1;
+						}
+						return num_lines;
+					}
+
+					// Converts two fixed-point points to a fixed-point line
+					void muttR_FixedGlyphLine(muttR_FixedLine* line, int32_m x0, int32_m y0, int32_m x1, int32_m y1) {
+						// Determine lowest y0 value
+						if (y0 < y1) {
+							line->x0 = x0;
+							line->y0 = y0;
+							line->x1 = x1;
+							line->y1 = y1;
+							line->dir = 1;
+						}
+						else {
+							line->x0 = x1;
+							line->y0 = y1;
+							line->x1 = x0;
+							line->y1 = y0;
+							line->dir = (y0 == y1) ?(0) :(-1);
+						}
+					}
+
+					// Converts three-point fixed-point Bezier (on, off, on) to fixed-point lines
+					// Same as muttR_GlyphCurve, but with integer math only
+					// - Line count:
+					static inline uint32_m muttR_FixedCurveLineCount(int32_m x0, int32_m y0, int32_m x1, int32_m y1, int32_m x2, int32_m y2, float tolerance) {
+						// Tolerance in fixed-point, at least 1/256 of a pixel
+						int64_m tol = muttR_ToFixed(tolerance);
+						tol = (tol < 1) ?(1) :((tol > MUTTR_FIXED_ONE*256) ?(MUTTR_FIXED_ONE*256) :(tol));
+						// Same as muttR_CurveLineCount, solved for the smallest n where
+						// |p0 - 2p1 + p2| <= 4*tolerance*n^2, squared to stay in integers
+						int64_m dx = ((int64_m)x0) - (2*(int64_m)x1) + x2;
+						int64_m dy = ((int64_m)y0) - (2*(int64_m)y1) + y2;
+						int64_m d = (dx*dx) + (dy*dy);
+						int64_m t = 16*tol*tol;
+						uint32_m n = 1;
+						while (n < MUTTR_MAX_LINES_PER_BEZIER && t*((int64_m)(n*n*n*n)) < d) {
+							++n;
+						}
+						return n;
+					}
+					// - Function:
+					// Returns the amount of lines; if line is 0, the lines are only counted
+					static inline uint32_m muttR_FixedGlyphCurve(muttR_FixedLine* line, int32_m x0, int32_m y0, int32_m x1, int32_m y1, int32_m x2, int32_m y2, float tolerance) {
+						// Calculate amount of lines for this Bezier
+						uint32_m num_lines = muttR_FixedCurveLineCount(x0, y0, x1, y1, x2, y2, tolerance);
+						if (!line) {
+							return num_lines;
+						}
+						int64_m n = num_lines, nn = n*n;
+
+						// Loop through each line per Bezier
+						int32_m bx0 = x0, by0 = y0;
+						for (int64_m l = 1; l <= n; ++l) {
+							// Calculate Bezier for the second point at t = l/n, with the
+							// whole Bezier multiplied by n^2 and rounded back down
+							int64_m a = (n-l)*(n-l), b = 2*(n-l)*l, c = l*l;
+							int32_m bx1 = (int32_m)muttR_FloorDiv((2*((a*x0) + (b*x1) + (c*x2))) + nn, 2*nn);
+							int32_m by1 = (int32_m)muttR_FloorDiv((2*((a*y0) + (b*y1) + (c*y2))) + nn, 2*nn);
+
+							// Make line based on this strip of the Bezier
+							muttR_FixedGlyphLine(line++, bx0, by0, bx1, by1);
+							bx0 = bx1;
+							by0 = by1;
+						}
+						return num_lines;
+					}
+
+					// A segment is a line or a Bezier of a glyph, kept exact rather than
+					// approximated by lines; used by methods that need distances to the outline
+					struct muttR_Segment {
+						// Points; p1 is the midpoint of p0 and p2 for lines
+						float x0;
+						float y0;
+						float x1;
+						float y1;
+						float x2;
+						float y2;
+						// Bounding box (of all points, which contains the curve)
+						float x_min;
+						float y_min;
+						float x_max;
+						float y_max;
+						// Whether or not this is a Bezier
+						muBool curve;
+						// The contour this segment belongs to
+						uint32_m contour;
+						// MSDF channel color
+						uint8_m color;
+					};
+					typedef struct muttR_Segment muttR_Segment;
+
+					// Converts three points to a segment
+					void muttR_GlyphSegment(muttR_Segment* seg, uint32_m contour, muBool curve, float x0, float y0, float x1, float y1, float x2, float y2) {
+						seg->x0 = x0; seg->y0 = y0;
+						seg->x1 = x1; seg->y1 = y1;
+						seg->x2 = x2; seg->y2 = y2;
+						seg->x_min = (x0 < x2) ?(x0) :(x2);
+						seg->x_max = (x0 > x2) ?(x0) :(x2);
+						seg->y_min = (y0 < y2) ?(y0) :(y2);
+						seg->y_max = (y0 > y2) ?(y0) :(y2);
+						if (curve) {
+							seg->x_min = (x1 < seg->x_min) ?(x1) :(seg->x_min);
+							seg->x_max = (x1 > seg->x_max) ?(x1) :(seg->x_max);
+							seg->y_min = (y1 < seg->y_min) ?(y1) :(seg->y_min);
+							seg->y_max = (y1 > seg->y_max) ?(y1) :(seg->y_max);
+						}
+						seg->curve = curve;
+						seg->contour = contour;
+						seg->color = 0;
+					}
+
+					// Outputs a line of a glyph as a line, fixed-point line, or segment, returning the amount output
+					static inline uint32_m muttR_WalkLine(muttR_Line** l, muttR_FixedLine** f, muttR_Segment** s, uint32_m c, float x0, float y0, float x1, float y1) {
+						if (*s) {
+							muttR_GlyphSegment((*s)++, c, MU_FALSE, x0, y0, (x0+x1) / 2.f, (y0+y1) / 2.f, x1, y1);
+						} else if (*f) {
+							muttR_FixedGlyphLine((*f)++, muttR_ToFixed(x0), muttR_ToFixed(y0), muttR_ToFixed(x1), muttR_ToFixed(y1));
+						} else if (*l) {
+							muttR_GlyphLine((*l)++, x0, y0, x1, y1);
+						}
+						return 1;
+					}
+
+					// Outputs a Bezier of a glyph as lines, fixed-point lines, or a segment, returning the amount output
+					static inline uint32_m muttR_WalkCurve(muttR_Line** l, muttR_FixedLine** f, muttR_Segment** s, uint32_m c, float x0, float y0, float x1, float y1, float x2, float y2, float tolerance, muBool fixed) {
+						if (*s) {
+							muttR_GlyphSegment((*s)++, c, MU_TRUE, x0, y0, x1, y1, x2, y2);
+							return 1;
+						}
+						if (fixed) {
+							uint32_m curve_lines = muttR_FixedGlyphCurve(*f,
+								muttR_ToFixed(x0), muttR_ToFixed(y0), muttR_ToFixed(x1), muttR_ToFixed(y1), muttR_ToFixed(x2), muttR_ToFixed(y2),
+								tolerance
+							);
+							if (*f) {
+								*f += curve_lines;
+							}
+							return curve_lines;
+						}
+						uint32_m curve_lines = muttR_GlyphCurve(*l, x0, y0, x1, y1, x2, y2, tolerance);
+						if (*l) {
+							*l += curve_lines;
+						}
+						return curve_lines;
+					}
+
+					// Gets the next point of a glyph based on the contour ends
+					static inline muttRPoint* muttR_GlyphNextPoint(muttRGlyph* glyph, uint32_m p, uint32_m i, uint32_m c) {
+						// The next point is p incremented
+						muttRPoint* pn = &glyph->points[p+i];
+						// ...unless this goes over the contour's end...
+						if (p+i > glyph->contour_ends[c]) {
+							// ..in which case the next point wraps back around to the first
+							// point of the contour
+							pn -= glyph->contour_ends[c]+1;
+							if (c > 0) {
+								pn += glyph->contour_ends[c-1]+1;
+							}
+						}
+						return pn;
+					}
+
+					// Converts a glyph to lines or segments, returning the amount of them
+					// If segments is given, the glyph is converted to segments; otherwise,
+					// it's converted to lines (fixed-point lines if fixed is true), which
+					// are only counted if lines/fixed_lines is 0
+					static inline uint32_m muttR_GlyphWalk(muttRGlyph* glyph, muttR_Line* lines, muttR_FixedLine* fixed_lines, muttR_Segment* segments, float tolerance, muBool fixed) {
+						// Keep count of lines/segments:
+						uint32_m count = 0;
+						// (Line/Segment tracker; stays 0 if only counting)
+						muttR_Line* l = lines;
+						muttR_FixedLine* f = fixed_lines;
+						muttR_Segment* s = segments;
+
+						// Loop through each point
+						uint32_m c = 0; // (contour tracker)
+						for (uint32_m p = 0; p < glyph->num_points;) {
+							// Increment contour ID if necessary
+							if (p > glyph->contour_ends[c]) {
+								// Go to beginning of contour to avoid over-counting sometimes
+								p = glyph->contour_ends[c]+1;
+								++c;
+							}
+
+							// Get current point
+							muttRPoint* p0 = &glyph->points[p];
+
+							// If current point is ON curve (ON...):
+							if (p0->flags & MUTTR_ON_CURVE) {
+								// Get next point
+								muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
+								// If next point is ON curve (ON, ON):
+								if (p1->flags & MUTTR_ON_CURVE) {
+									// Form line between two points and move on by one
+									count += muttR_WalkLine(&l, &f, &s, c, p0->x, p0->y, p1->x, p1->y);
+									++p;
+									continue;
+								}
+
+								// If we're here, the next point is OFF curve (ON, OFF...)
+								// Get next-next point
+								muttRPoint* p2 = muttR_GlyphNextPoint(glyph, p, 2, c);
+								// If next-next point is ON the curve (ON, OFF, ON):
+								if (p2->flags & MUTTR_ON_CURVE) {
+									// Form basic Bezier and move on
+									count += muttR_WalkCurve(&l, &f, &s, c, p0->x, p0->y, p1->x, p1->y, p2->x, p2->y, tolerance, fixed);
+								}
+
+								// If we're here, the next-next point is OFF the curve: (ON, OFF, OFF):
+								else {
+									// Bezier, with last point needing to be mid-pointed
+									count += muttR_WalkCurve(&l, &f, &s, c, p0->x, p0->y, p1->x, p1->y,
+										(p1->x + p2->x) / 2.f, (p1->y + p2->y) / 2.f, tolerance, fixed
+									);
+								}
+
+								p += 2;
+								continue;
+							}
+
+							// If we're here, the current point is OFF curve (OFF...)
+							// Get previous point:
+							muttRPoint* pn1 = &glyph->points[p-1];
+							muttRPoint n1;
+							// Edge case for point being 0:
+							if (p == 0) {
+								// Wrap to last point of this contour
+								pn1 = &n1;
+								n1.x = glyph->points[glyph->contour_ends[0]].x;
+								n1.y = glyph->points[glyph->contour_ends[0]].y;
+								n1.flags = glyph->points[glyph->contour_ends[0]].flags;
+							}
+							// Edge case for point being first of contour:
+							else if (c > 0 && (uint16_m)(glyph->contour_ends[c-1]+1) == p) {
+								// Wrap to last point of this contour
+								pn1 = &n1;
+								n1.x = glyph->points[glyph->contour_ends[c]].x;
+								n1.y = glyph->points[glyph->contour_ends[c]].y;
+								n1.flags = glyph->points[glyph->contour_ends[c]].flags;
+							}
+
+							// Leave if previous point is ON;
+							// this avoids duplicate lines from what I'm aware
+							if (pn1->flags & MUTTR_ON_CURVE) {
+								++p;
+								continue;
+							}
+
+							// Get next point:
+							muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
+
+							// x0 and y0 must be midpointed between pn1 and p0 since
+							// both are OFF curve:
+							float x0 = (pn1->x + p0->x) / 2.f;
+							float y0 = (pn1->y + p0->y) / 2.f;
+							// x1 and y1 are just p0 since it's OFF curve:
+							float x1 = p0->x;
+							float y1 = p0->y;
+							// x2 and y2 are just p1:
+							float x2 = p1->x;
+							float y2 = p1->y;
+							// ...unless it's OFF curve, in which case it must be
+							// midpointed:
+							if (!(p1->flags & MUTTR_ON_CURVE)) {
+								x2 = (x1 + x2) / 2.f;
+								y2 = (y1 + y2) / 2.f;
+							}
+
+							// Bezier and move on:
+							count += muttR_WalkCurve(&l, &f, &s, c, x0, y0, x1, y1, x2, y2, tolerance, fixed);
+							++p;
+							//continue;
+						}
+
+						// Return final count
+						return count;
+					}
+
+					// Converts a glyph to lines, returning the amount of lines
+					// If lines is 0, the lines are only counted, which is used to
+					// calculate the amount of lines needed to represent a glyph
+					uint32_m muttR_GlyphLines(muttRGlyph* glyph, muttR_Line* lines, float tolerance) {
+						return muttR_GlyphWalk(glyph, lines, 0, 0, tolerance, MU_FALSE);
+					}
+
+					// Converts a glyph to fixed-point lines, returning the amount of lines
+					// If lines is 0, the lines are only counted
+					uint32_m muttR_GlyphFixedLines(muttRGlyph* glyph, muttR_FixedLine* lines, float tolerance) {
+						return muttR_GlyphWalk(glyph, 0, lines, 0, tolerance, MU_TRUE);
+					}
+
+					// Converts a glyph to segments, returning the amount of segments
+					// segments must have room for at least one segment per point
+					uint32_m muttR_GlyphSegments(muttRGlyph* glyph, muttR_Segment* segments) {
+						return muttR_GlyphWalk(glyph, 0, 0, segments, 0.f, MU_FALSE);
+					}
+
+					// Converts an rglyph to a shape
+					// lines must have room for the amount of lines given by muttR_GlyphLines
+					void muttR_ShapeCreate(muttRGlyph* glyph, muttR_Shape* shape, float tolerance, muttR_Line* lines) {
+						// Convert glyph to lines
+						shape->lines = lines;
+						shape->num_lines = muttR_GlyphLines(glyph, lines, tolerance);
+
+						// Sort all lines
+						muttR_ShapeSort(shape);
+						// Set max x/y
+						shape->x_max = glyph->x_max;
+						shape->y_max = glyph->y_max;
+					}
+
+					// Converts an rglyph to a fixed-point shape
+					// lines must have room for the amount of lines given by muttR_GlyphFixedLines
+					void muttR_FixedShapeCreate(muttRGlyph* glyph, muttR_FixedShape* shape, float tolerance, muttR_FixedLine* lines) {
+						// Convert glyph to lines
+						shape->lines = lines;
+						shape->num_lines = muttR_GlyphFixedLines(glyph, lines, tolerance);
+
+						// Sort all lines
+						// (Nothing to sort without at least two lines, and lines may be 0 without any)
+						if (shape->num_lines > 1) {
+							mu_qsort(shape->lines, shape->num_lines, sizeof(muttR_FixedLine), muttR_CompareFixedLines);
+						}
+						// Set max x/y
+						shape->x_max = muttR_ToFixed(glyph->x_max);
+						shape->y_max = muttR_ToFixed(glyph->y_max);
+					}
+
+			/* Intersection/Hit logic */
+
+				// A hit:
+				struct muttR_Hit {
+					// The x-value of the intersection
+					float x;
+					// The line which it intersected with
+					uint32_m l;
+				};
+				typedef struct muttR_Hit muttR_Hit;
+
+				// An active line list; tracks the lines that the current ray is in range of
+				// This relies on the shape's lines being sorted in increasing order of bottom point
+				struct muttR_ActiveList {
+					// The next line to be considered for activation
+					uint32_m next;
+					// Number of active lines
+					uint32_m num_hits;
+					// Each active line, as a hit sorted in increasing order of x-value
+					muttR_Hit* hits;
+				};
+				typedef struct muttR_ActiveList muttR_ActiveList;
+
+				// Initializes an active line list with memory for at least the shape's line count
+				static inline void muttR_ActiveListInit(muttR_ActiveList* list, muttR_Hit* hits) {
+					list->next = 0;
+					list->num_hits = 0;
+					list->hits = hits;
+				}
+
+				// Updates the active line list based on the ray, giving the hits of all active lines
+				// Each call must be given a ray y-value greater than or equal to the last call
+				static inline void muttR_ActiveLines(muttR_Shape* shape, muttR_ActiveList* list, float ry) {
+					muttR_Line* lines = shape->lines;
+					muttR_Hit* hits = list->hits;
+
+					// Remove lines whose top point the ray has now passed
+					// (Order is preserved, so hits stay mostly sorted from the last ray)
+					uint32_m num_hits = 0;
+					for (uint32_m h = 0; h < list->num_hits; ++h) {
+						if (ry <= lines[hits[h].l].y1 + MUTTR_LINE_EPSILON32) {
+							hits[num_hits++] = hits[h];
+						}
+					}
+
+					// Add lines whose bottom point is now in range of the ray
+					while (list->next < shape->num_lines && ry >= lines[list->next].y0 - MUTTR_LINE_EPSILON32) {
+						muttR_Line* line = &lines[list->next];
+						// Horizontal lines never give a valid hit, and lines whose top point
+						// is already passed were fully skipped between rays
+						if (line->y1-line->y0 != 0.f && ry <= line->y1 + MUTTR_LINE_EPSILON32) {
+							hits[num_hits++].l = list->next;
+						}
+						++list->next;
+					}
+
+					// Calculate the x-value of each hit and insertion sort them by it;
+					// the order barely changes between rays, so this is usually linear
+					for (uint32_m h = 0; h < num_hits; ++h) {
+						muttR_Line* line = &lines[hits[h].l];
+						muttR_Hit hit;
+						hit.x = muttR_LineRayHit(ry, line->x0, line->y0, line->x1, line->y1);
+						hit.l = hits[h].l;
+
+						uint32_m i = h;
+						while (i > 0 && hits[i-1].x > hit.x) {
+							hits[i] = hits[i-1];
+							--i;
+						}
+						hits[i] = hit;
+					}
+
+					list->num_hits = num_hits;
+				}
+
+				// Gives the first hit within an active line list that is valid (x-value isn't negative)
+				static inline uint32_m muttR_FirstHit(muttR_Hit* hits, uint32_m num_hits) {
+					uint32_m ih = 0;
+					while (ih < num_hits && !(hits[ih].x >= 0.f)) {
+						++ih;
+					}
+					return ih;
+				}
+
+				// A fixed-point hit
+				struct muttR_FixedHit {
+					// The x-value of the intersection
+					int32_m x;
+					// The line which it intersected with
+					uint32_m l;
+				};
+				typedef struct muttR_FixedHit muttR_FixedHit;
+
+				// A fixed-point active line list; same as muttR_ActiveList, but for a fixed-point shape
+				// Unlike the float active line list, a line is active if y0 <= ray y < y1,
+				// which counts each point shared by two lines exactly once without epsilons
+				struct muttR_FixedList {
+					// The next line to be considered for activation
+					uint32_m next;
+					// Number of active lines
+					uint32_m num_hits;
+					// Each active line, as a hit sorted in increasing order of x-value
+					muttR_FixedHit* hits;
+				};
+				typedef struct muttR_FixedList muttR_FixedList;
+
+				// Updates the fixed-point active line list based on the ray, giving the hits of all active lines
+				// Each call must be given a ray y-value greater than or equal to the last call
+				static inline void muttR_FixedActiveLines(muttR_FixedShape* shape, muttR_FixedList* list, int32_m ry) {
+					muttR_FixedLine* lines = shape->lines;
+					muttR_FixedHit* hits = list->hits;
+
+					// Remove lines whose top point the ray has now reached
+					uint32_m num_hits = 0;
+					for (uint32_m h = 0; h < list->num_hits; ++h) {
+						if (ry < lines[hits[h].l].y1) {
+							hits[num_hits++] = hits[h];
+						}
+					}
+
+					// Add lines whose bottom point the ray has now reached
+					// (Horizontal lines are never active, since y0 == y1)
+					while (list->next < shape->num_lines && ry >= lines[list->next].y0) {
+						if (ry < lines[list->next].y1) {
+							hits[num_hits++].l = list->next;
+						}
+						++list->next;
+					}
+
+					// Calculate the x-value of each hit and insertion sort them by it
+					for (uint32_m h = 0; h < num_hits; ++h) {
+						muttR_FixedLine* line = &lines[hits[h].l];
+						muttR_FixedHit hit;
+						hit.x = muttR_FixedLineRayHit(ry, line->x0, line->y0, line->x1, line->y1);
+						hit.l = hits[h].l;
+
+						uint32_m i = h;
+						while (i > 0 && hits[i-1].x > hit.x) {
+							hits[i] = hits[i-1];
+							--i;
+						}
+						hits[i] = hit;
+					}
+
+					list->num_hits = num_hits;
+				}
+
+				// A fixed-point ray
+				struct muttR_FixedRay {
+					// Each line its hit
+					muttR_FixedHit* hits;
+					// Number of hits
+					uint32_m num_hits;
+					// Its winding
+					int32_m winding;
+					// Upcoming hit
+					uint32_m ih;
+				};
+				typedef struct muttR_FixedRay muttR_FixedRay;
+
+				// Fills information about a fixed-point ray
+				static inline void muttR_FixedRayCalc(muttR_FixedShape* shape, muttR_FixedList* list, muttR_FixedRay* ray, int32_m ray_y) {
+					// Update active lines and copy their hits
+					muttR_FixedActiveLines(shape, list, ray_y);
+					ray->num_hits = list->num_hits;
+					// (Hits may be 0 if the shape has no lines)
+					if (list->num_hits != 0) {
+						mu_memcpy(ray->hits, list->hits, list->num_hits*sizeof(muttR_FixedHit));
+					}
+					// Winding starts at 0 to the left of all hits
+					// (Hits with a negative x-value are still counted, since they still affect winding)
+					ray->winding = 0;
+					ray->ih = 0;
+				}
+
+				// Moves a fixed-point ray to an x-value, returning if the point is in the glyph
+				// Each call must be given an x-value greater than or equal to the last call
+				static inline muBool muttR_FixedRayIn(muttR_FixedShape* shape, muttR_FixedRay* ray, int32_m ray_x) {
+					// Skip over every hit we've passed, adding their windings
+					// (Same rule as the float version for a contour exactly on a pixel's center)
+					while (ray->ih < ray->num_hits && ray_x > ray->hits[ray->ih].x) {
+						ray->winding += shape->lines[ray->hits[ray->ih++].l].dir;
+					}
+					return ray->winding != 0;
+				}
+
+			/* Row kernels */
+
+				// Converts a row of coverage values (0 to 1) to pixels, where each pixel's
+				// last channel is (coverage*scale)+bias truncated, and all other channels are 255
+				static inline void muttR_RowPixels(float* cov, uint8_m* pixels, uint32_m width, uint8_m adv, float scale, float bias) {
+					uint32_m w = 0;
+
+					#if defined(MUTT_SIMD_AVX2)
+					__m256 scale8 = _mm256_set1_ps(scale), bias8 = _mm256_set1_ps(bias);
+					__m256 min8 = _mm256_setzero_ps(), max8 = _mm256_set1_ps(255.f);
+					if (adv == 4) {
+						// 8 RGBA pixels at a time: 0x00FFFFFF | (v << 24)
+						__m256i rgb8 = _mm256_set1_epi32(0x00FFFFFF);
+						for (; w+8 <= width; w += 8) {
+							__m256 v = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(cov+w), scale8), bias8);
+							v = _mm256_min_ps(_mm256_max_ps(v, min8), max8);
+							__m256i i = _mm256_or_si256(_mm256_slli_epi32(_mm256_cvttps_epi32(v), 24), rgb8);
+							_mm256_storeu_si256((__m256i*)(pixels+(w*4)), i);
+						}
+					}
+					#endif
+
+					#if defined(MUTT_SIMD_SSE2)
+					__m128 scale4 = _mm_set1_ps(scale), bias4 = _mm_set1_ps(bias);
+					__m128 min4 = _mm_setzero_ps(), max4 = _mm_set1_ps(255.f);
+					if (adv == 1) {
+						// 16 single-channel pixels at a time
+						for (; w+16 <= width; w += 16) {
+							__m128i i[4];
+							for (uint8_m q = 0; q < 4; ++q) {
+								__m128 v = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(cov+w+(q*4)), scale4), bias4);
+								v = _mm_min_ps(_mm_max_ps(v, min4), max4);
+								i[q] = _mm_cvttps_epi32(v);
+							}
+							__m128i b = _mm_packus_epi16(_mm_packs_epi32(i[0], i[1]), _mm_packs_epi32(i[2], i[3]));
+							_mm_storeu_si128((__m128i*)(pixels+w), b);
+						}
+					}
+					else if (adv == 4) {
+						// 4 RGBA pixels at a time: 0x00FFFFFF | (v << 24)
+						__m128i rgb4 = _mm_set1_epi32(0x00FFFFFF);
+						for (; w+4 <= width; w += 4) {
+							__m128 v = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(cov+w), scale4), bias4);
+							v = _mm_min_ps(_mm_max_ps(v, min4), max4);
+							__m128i i = _mm_or_si128(_mm_slli_epi32(_mm_cvttps_epi32(v), 24), rgb4);
+							_mm_storeu_si128((__m128i*)(pixels+(w*4)), i);
+						}
+					}
+					// (RGB falls through to scalar; there's no cheap 3-byte interleave in SSE2)
+					#endif
+
+					#if defined(MUTT_SIMD_NEON)
+					float32x4_t scale4 = vdupq_n_f32(scale), bias4 = vdupq_n_f32(bias);
+					float32x4_t min4 = vdupq_n_f32(0.f), max4 = vdupq_n_f32(255.f);
+					// 16 pixels at a time; RGB/RGBA use interleaved stores
+					uint8x16_t full = vdupq_n_u8(255);
+					for (; w+16 <= width && (adv == 1 || adv == 3 || adv == 4); w += 16) {
+						uint16x4_t h[4];
+						for (uint8_m q = 0; q < 4; ++q) {
+							float32x4_t v = vaddq_f32(vmulq_f32(vld1q_f32(cov+w+(q*4)), scale4), bias4);
+							v = vminq_f32(vmaxq_f32(v, min4), max4);
+							h[q] = vmovn_u32(vcvtq_u32_f32(v));
+						}
+						uint8x16_t b = vcombine_u8(
+							vmovn_u16(vcombine_u16(h[0], h[1])),
+							vmovn_u16(vcombine_u16(h[2], h[3]))
+						);
+						if (adv == 1) {
+							vst1q_u8(pixels+w, b);
+						} else if (adv == 3) {
+							uint8x16x3_t rgb;
+							rgb.val[0] = full; rgb.val[1] = full; rgb.val[2] = b;
+							vst3q_u8(pixels+(w*3), rgb);
+						} else {
+							uint8x16x4_t rgba;
+							rgba.val[0] = full; rgba.val[1] = full; rgba.val[2] = full; rgba.val[3] = b;
+							vst4q_u8(pixels+(w*4), rgba);
+						}
+					}
+					#endif
+
+					// Scalar for the remainder
+					for (; w < width; ++w) {
+						float v = (cov[w] * scale) + bias;
+						v = (v < 0.f) ?(0.f) :((v > 255.f) ?(255.f) :(v));
+						for (uint8_m a = 0; a < adv-1; ++a) {
+							pixels[(w*adv)+a] = 255;
+						}
+						pixels[(w*adv)+(adv-1)] = (uint8_m)v;
+					}
+				}
+
+				// Converts a row of accumulated area values to coverage values in place;
+				// coverage is the absolute value of the running sum, clamped to 1
+				static inline void muttR_RowCoverage(float* row, uint32_m width) {
+					uint32_m w = 0;
+					float sum = 0.f;
+
+					#if defined(MUTT_SIMD_SSE2)
+					__m128 carry = _mm_setzero_ps();
+					__m128 one = _mm_set1_ps(1.f);
+					__m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+					for (; w+4 <= width; w += 4) {
+						// Prefix sum within the 4 values, plus the carry from last 4
+						__m128 x = _mm_loadu_ps(row+w);
+						x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+						x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+						x = _mm_add_ps(x, carry);
+						carry = _mm_shuffle_ps(x, x, _MM_SHUFFLE(3,3,3,3));
+						// Absolute value, clamped
+						_mm_storeu_ps(row+w, _mm_min_ps(_mm_and_ps(x, abs_mask), one));
+					}
+					sum = _mm_cvtss_f32(carry);
+					#elif defined(MUTT_SIMD_NEON)
+					float32x4_t carry = vdupq_n_f32(0.f);
+					float32x4_t zero = vdupq_n_f32(0.f), one = vdupq_n_f32(1.f);
+					for (; w+4 <= width; w += 4) {
+						// Prefix sum within the 4 values, plus the carry from last 4
+						float32x4_t x = vld1q_f32(row+w);
+						x = vaddq_f32(x, vextq_f32(zero, x, 3));
+						x = vaddq_f32(x, vextq_f32(zero, x, 2));
+						x = vaddq_f32(x, carry);
+						carry = vdupq_n_f32(vgetq_lane_f32(x, 3));
+						// Absolute value, clamped
+						vst1q_f32(row+w, vminq_f32(vabsq_f32(x), one));
+					}
+					sum = vgetq_lane_f32(carry, 0);
+					#endif
+
+					// Scalar for the remainder
+					for (; w < width; ++w) {
+						sum += row[w];
+						float c = mu_fabsf(sum);
+						row[w] = (c > 1.f) ?(1.f) :(c);
 					}
+				}
 
-					// Progressive glyph data:
-					// (Move to endPtsOfContours[numContours-1])
-					muByte* data = header->data + (req-4);
-					// Read last element of endPtsOfContours
-					uint16_m num_points = MU_RBEU16(data);
-					data += 2;
-					// Verify it for number of points
-					if (num_points++ == 0xFFFF) {
-						return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+				// Converts a row of fixed-point coverage values (0 to MUTTR_FIXED_ONE) to pixels, where
+				// each pixel's last channel is out+(coverage*(in-out)) rounded, and all other channels are 255
+				static inline void muttR_RowPixelsFixed(uint16_m* cov, uint8_m* pixels, uint32_m width, uint8_m adv, int32_m in, int32_m out) {
+					int32_m range = in-out;
+					// (Integer division truncates towards 0, so round away from 0 by half)
+					int32_m round = (range < 0) ?(-MUTTR_FIXED_HALF) :(MUTTR_FIXED_HALF);
+					for (uint32_m w = 0; w < width; ++w) {
+						for (uint8_m a = 0; a < adv-1; ++a) {
+							pixels[(w*adv)+a] = 255;
+						}
+						pixels[(w*adv)+(adv-1)] = (uint8_m)(out + (((range*(int32_m)cov[w]) + round) / MUTTR_FIXED_ONE));
 					}
-					if (num_points > font->maxp->max_points) {
-						return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+				}
+
+			/* Row output */
+
+				// Outputs a span of row h (counted from the bottom)
+				static inline void muttR_SpanOut(muttRSpans* spans, muttRBitmap* bitmap, uint32_m h, uint32_m x0, uint32_m x1, uint8_m coverage) {
+					muttRSpan span;
+					span.x0 = x0;
+					span.x1 = x1;
+					span.y = (bitmap->height-h)-1;
+					span.coverage = coverage;
+
+					// Give to callback, or put in buffer if there's room
+					if (spans->callback) {
+						spans->callback(spans->user, &span);
+					} else if (spans->count < spans->capacity) {
+						spans->spans[spans->count] = span;
 					}
+					++spans->count;
+				}
 
-					// Read instructionLength
-					uint16_m instruction_len = MU_RBEU16(data);
-					data += 2;
-					// Verify instructions
-					req += instruction_len;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				// Outputs a run of pixels in row h with the same value
+				// If outputting spans, runs of out are skipped
+				static inline void muttR_RunOut(muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint32_m h, uint32_m x0, uint32_m x1, uint8_m value, uint8_m out) {
+					if (x1 <= x0) {
+						return;
 					}
-					// Move past instructions
-					data += instruction_len;
+					if (spans) {
+						if (value != out) {
+							muttR_SpanOut(spans, bitmap, h, x0, x1, value);
+						}
+						return;
+					}
+					mu_memset(&bitmap->pixels[(bitmap->stride*((bitmap->height-h)-1)) + (x0*adv)], value, (x1-x0)*adv);
+				}
 
-					// Allocate flags
-					uint8_m* flags = (uint8_m*)mu_malloc(num_points);
-					if (!flags) {
-						return MUTT_FAILED_MALLOC;
+				// Outputs the pixels x0 to x1 of row h from values (0 to 255), merging equal values into spans
+				// Values of 0 are skipped
+				static inline void muttR_RowSpans(uint8_m* values, muttRSpans* spans, muttRBitmap* bitmap, uint32_m h, uint32_m x0, uint32_m x1) {
+					uint32_m run = x0;
+					for (uint32_m w = x0+1; w <= x1; ++w) {
+						if (w == x1 || values[w-x0] != values[run-x0]) {
+							if (values[run-x0] != 0) {
+								muttR_SpanOut(spans, bitmap, h, run, w, values[run-x0]);
+							}
+							run = w;
+						}
 					}
+				}
 
-					// Loop through each flag
-					uint16_m pi = 0;
-					while (pi < num_points) {
-						// Verify length for this flag
-						if (header->length < ++req) {
-							mu_free(flags);
-							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				// Fills the pixels x0 to x1 of row h with a value, the same way as muttR_RowPixels
+				// would (all channels but the last are 255); used to skip pixels with no coverage
+				// within the glyph range
+				// If outputting spans, nothing is output if value is out
+				static inline void muttR_RowFill(muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint32_m h, uint32_m x0, uint32_m x1, uint8_m value, uint8_m out) {
+					if (x1 <= x0) {
+						return;
+					}
+					if (spans) {
+						if (value != out) {
+							muttR_SpanOut(spans, bitmap, h, x0, x1, value);
+						}
+						return;
+					}
+					uint8_m* pixels = &bitmap->pixels[bitmap->stride*((bitmap->height-h)-1)];
+					if (adv == 1) {
+						mu_memset(&pixels[x0], value, x1-x0);
+						return;
+					}
+					for (uint32_m w = x0; w < x1; ++w) {
+						for (uint8_m a = 0; a < adv-1; ++a) {
+							pixels[(w*adv)+a] = 255;
 						}
+						pixels[(w*adv)+(adv-1)] = value;
+					}
+				}
 
-						// Get flag
-						uint8_m flag = flags[pi] = *data;
+				// Fills the pixels from x0 to the end of row h, which have no coverage; the pixels
+				// before lim (within the glyph range) are filled like muttR_RowFill, and the pixels
+				// past it are filled with out in every channel, like rows outside of the glyph range
+				static inline void muttR_RowEnd(muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint32_m h, uint32_m x0, uint32_m lim, uint8_m out) {
+					muttR_RowFill(bitmap, spans, adv, h, x0, lim, out, out);
+					muttR_RunOut(bitmap, spans, adv, h, (x0 > lim) ?(x0) :(lim), bitmap->width, out, out);
+				}
 
-						// Get implied length of x- and y-coordinates based on flag
-						uint8_m coord_length = 0;
-						// - x
-						if (flag & MUTT_X_SHORT_VECTOR) {
-							// 1-byte x-coordinate
-							coord_length += 1;
-						} else if (!(flag & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR)) {
-							// 2-byte x-coordinate
-							coord_length += 2;
+				// Outputs the pixels x0 to x1 of row h from float coverage values (0 to 1); see muttR_RowPixels
+				// If outputting spans, spans are 1 channel, meaning in is 255 and out is 0,
+				// so the values are converted to pixels in the row's own memory first
+				static inline void muttR_RowOut(muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint32_m h, uint32_m x0, uint32_m x1, float* cov, float scale, float bias) {
+					if (x1 <= x0) {
+						return;
+					}
+					if (spans) {
+						muttR_RowPixels(cov+x0, (uint8_m*)(cov+x0), x1-x0, 1, scale, bias);
+						muttR_RowSpans((uint8_m*)(cov+x0), spans, bitmap, h, x0, x1);
+						return;
+					}
+					muttR_RowPixels(cov+x0, &bitmap->pixels[(bitmap->stride*((bitmap->height-h)-1)) + (x0*adv)], x1-x0, adv, scale, bias);
+				}
+
+				// Outputs the pixels x0 to x1 of row h from fixed-point coverage values; see muttR_RowPixelsFixed
+				static inline void muttR_RowOutFixed(muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint32_m h, uint32_m x0, uint32_m x1, uint16_m* cov, int32_m in, int32_m out) {
+					if (x1 <= x0) {
+						return;
+					}
+					if (spans) {
+						muttR_RowPixelsFixed(cov+x0, (uint8_m*)(cov+x0), x1-x0, 1, in, out);
+						muttR_RowSpans((uint8_m*)(cov+x0), spans, bitmap, h, x0, x1);
+						return;
+					}
+					muttR_RowPixelsFixed(cov+x0, &bitmap->pixels[(bitmap->stride*((bitmap->height-h)-1)) + (x0*adv)], x1-x0, adv, in, out);
+				}
+
+			/* Rasterization per method */
+
+				// Rounds memory up to a multiple of 16 so that everything after it stays aligned
+				#define MUTTR_ALIGN_MEMORY(s) (((s)+15) & ~((size_m)15))
+
+				// Row extents
+				// Only the pixels of a row between its first and last hit need to be calculated;
+				// every pixel before the first hit is out, and every pixel past the last hit has
+				// the same value as the first pixel past it, so both are filled in bulk.
+
+				// Calculates the limit of pixels in a row from the glyph's max x-value;
+				// this is the first pixel past x_max (+ double-pixel extra for bleeding and ceiling)
+				static inline uint32_m muttR_PixelLimit(float x_max, uint32_m width) {
+					float l = x_max + 2.f;
+					if (l < 0.f) {
+						return 0;
+					}
+					if (!(l < (float)width)) {
+						return width;
+					}
+					uint32_m w = ((uint32_m)mu_floorf(l)) + 1;
+					return (w > width) ?(width) :(w);
+				}
+
+				// Gives the pixel containing a non-negative x-value, clamped to lim
+				static inline uint32_m muttR_PixelFloor(float x, uint32_m lim) {
+					if (!(x < (float)lim)) {
+						return lim;
+					}
+					return (uint32_m)mu_floorf(x);
+				}
+
+				// Fixed-point version of muttR_PixelLimit
+				static inline uint32_m muttR_FixedPixelLimit(int32_m x_max, uint32_m width) {
+					int64_m l = ((int64_m)x_max) + (2*MUTTR_FIXED_ONE);
+					if (l < 0) {
+						return 0;
+					}
+					l = (l >> MUTTR_FIXED_SHIFT) + 1;
+					return (l > (int64_m)width) ?(width) :((uint32_m)l);
+				}
+
+				// Gives the pixel containing a fixed-point x-value, clamped to 0 and lim
+				static inline uint32_m muttR_FixedPixelFloor(int32_m x, uint32_m lim) {
+					if (x < 0) {
+						return 0;
+					}
+					x >>= MUTTR_FIXED_SHIFT;
+					return ((uint32_m)x > lim) ?(lim) :((uint32_m)x);
+				}
+
+				// MUTTR_FULL_PIXEL_BI_LEVEL
+				// Memory needed (besides lines)
+				static inline size_m muttR_FullPixelBiLevelMemory(uint32_m num_lines) {
+					// Hit tracker
+					return num_lines * sizeof(muttR_Hit);
+				}
+
+				// mem is given with size muttR_FullPixelBiLevelMemory
+				// If spans is given, the rows are output as spans rather than to bitmap's pixels
+				void muttR_FullPixelBiLevel(muttR_Shape* shape, muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint8_m in, uint8_m out, muByte* mem) {
+					// Hit tracker
+					muttR_Hit* hits = (muttR_Hit*)mem;
+
+					// Initialize active lines
+					muttR_ActiveList list;
+					muttR_ActiveListInit(&list, hits);
+					// Limit of pixels in glyph range
+					uint32_m w_lim = muttR_PixelLimit(shape->x_max, bitmap->width);
+
+					// Loop through each horizontal strip from bottom to top
+					for (uint32_m h = 0; h < bitmap->height; ++h) {
+						// Just fill all x-values with out if the height is now outside of the glyph range
+						// (+ double-pixel extra for bleeding and ceiling)
+						if (h > shape->y_max+2) {
+							muttR_RunOut(bitmap, spans, adv, h, 0, bitmap->width, out, out);
+							continue;
+						}
+
+						// Calculate y-value of ray (middle of pixel)
+						float ray_y = ((float)h) + .5f;
+
+						// Update active line list, calculating all hits with active lines
+						muttR_ActiveLines(shape, &list, ray_y);
+						uint32_m num_hits = list.num_hits;
+						// Winding starts at 0 to the left of all hits
+						int32_m winding = 0;
+
+						// Calculate row extents; only pixels from the first hit's pixel up to
+						// the first pixel past the last hit need to be calculated
+						uint32_m ih = muttR_FirstHit(hits, num_hits); // (Upcoming hit)
+						uint32_m w_start = 0, w_stop = 0;
+						if (ih < num_hits) {
+							w_start = muttR_PixelFloor(hits[ih].x, w_lim);
+							w_stop = muttR_PixelFloor(hits[num_hits-1].x + 2.f, w_lim);
+						}
+
+						// Loop through each x-value, filling runs of pixels with the same value at once
+						uint32_m run = 0; // (Start of current run)
+						uint8_m run_value = out; // (Value of current run)
+						uint32_m w = w_start;
+						for (; w < w_stop; ++w) {
+							// Calculate x-coordinate (middle of pixel)
+							float ray_x = ((float)w) + .5f;
+
+							// Skip over every hit we've passed, and remove their windings
+							// "ray_x > ..." ensures rule 2 of scan converting:
+							// "If a contour falls exactly on a pixel’s center, that pixel is turned on."
+							while (ih < num_hits && ray_x > hits[ih].x) {
+								winding -= muttR_LineWinding(ray_y, &shape->lines[hits[ih++].l]);
+							}
+
+							// Winding == 0 means in the glyph, and vice versa
+							uint8_m value = (winding == 0) ?(out) :(in);
+							// Fill last run if this pixel starts a new one
+							if (value != run_value) {
+								muttR_RunOut(bitmap, spans, adv, h, run, w, run_value, out);
+								run = w;
+								run_value = value;
+							}
+						}
+						// Pixels past the last hit continue the last run up to the glyph range
+						if (w > w_start) {
+							w = w_lim;
+						}
+
+						// Fill last run, and the remaining pixels with out
+						muttR_RunOut(bitmap, spans, adv, h, run, w, run_value, out);
+						muttR_RunOut(bitmap, spans, adv, h, w, bitmap->width, out, out);
+					}
+				}
+
+				// A ray
+				struct muttR_Ray {
+					// Its y-value
+					float y;
+					// Each line its hit
+					muttR_Hit* hits;
+					// Number of hits
+					uint32_m num_hits;
+					// Its winding
+					int32_m winding;
+					// Upcoming hit
+					uint32_m ih;
+				};
+				typedef struct muttR_Ray muttR_Ray;
+
+				// Fills information about a ray
+				static inline void muttR_PixelRayCalc(muttR_Shape* shape, muttR_ActiveList* list, muttR_Ray* ray, float ray_y) {
+					// Fill y-value
+					ray->y = ray_y;
+					// Update active lines and copy their hits
+					muttR_ActiveLines(shape, list, ray_y);
+					ray->num_hits = list->num_hits;
+					mu_memcpy(ray->hits, list->hits, list->num_hits*sizeof(muttR_Hit));
+					// Winding starts at 0 to the left of all hits
+					ray->winding = 0;
+					// Set upcoming hit to first valid hit
+					ray->ih = muttR_FirstHit(ray->hits, ray->num_hits);
+				}
+
+				// MUTTR_FULL_PIXEL_AANXN inner handling
+				void muttR_FullPixelAANXNInner(muttR_Shape* shape, muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, float in, float out, uint8_m vs, uint8_m hs, muttR_Ray* rays, muttR_ActiveList* list, float* cov) {
+					// Weight of each sample:
+					float weight = 1.f / ((float)(vs*hs));
+					// Limit of pixels in glyph range
+					uint32_m w_lim = muttR_PixelLimit(shape->x_max, bitmap->width);
+
+					// Loop through each horizontal strip from bottom to top
+					for (uint32_m h = 0; h < bitmap->height; ++h) {
+						// Just fill all x-values with out if the height is now outside of the glyph range
+						// (+ double-pixel extra for bleeding and ceiling)
+						if (h > shape->y_max+2) {
+							muttR_RunOut(bitmap, spans, adv, h, 0, bitmap->width, (uint8_m)out, (uint8_m)out);
+							continue;
+						}
+
+						// Calculate each ray, and the row extents from all of their hits
+						uint32_m w_start = w_lim, w_stop = 0;
+						for (uint8_m r = 0; r < hs; ++r) {
+							// a=\left[\frac{1}{n+1},\frac{2}{n+1}...\frac{n}{n+1}\right]
+							muttR_Ray* ray = rays+r;
+							muttR_PixelRayCalc(shape, list, ray, ((float)h) + (((float)(r+1)) / ((float)(hs+1))));
+							if (ray->ih < ray->num_hits) {
+								uint32_m first = muttR_PixelFloor(ray->hits[ray->ih].x, w_lim);
+								uint32_m last = muttR_PixelFloor(ray->hits[ray->num_hits-1].x + 2.f, w_lim);
+								w_start = (first < w_start) ?(first) :(w_start);
+								w_stop = (last > w_stop) ?(last) :(w_stop);
+							}
+						}
+						// Just fill all x-values with out if no ray hits anything
+						if (w_start >= w_stop) {
+							muttR_RowEnd(bitmap, spans, adv, h, 0, w_lim, (uint8_m)out);
+							continue;
+						}
+
+						// Loop through each x-value within the row extents
+						uint32_m w = w_start;
+						for (; w < w_stop; ++w) {
+							// Percentage amount the pixel is in
+							float in_per = 0.f;
+
+							// Loop through each vertical sample
+							for (uint8_m x = 0; x < vs; ++x) {
+								// Calculate x-coordinate
+								// (Same math as y-ray)
+								float ray_x = ((float)w) + (((float)(x+1)) / ((float)(vs+1)));
+
+								// Loop through each horizontal sample
+								for (uint8_m y = 0; y < hs; ++y) {
+									// Skip over each hit, removing windings
+									while (rays[y].ih < rays[y].num_hits && ray_x > rays[y].hits[rays[y].ih].x) {
+										// winding -= muttR_LineWinding(ray_y, &shape->lines[hits[ih++].l]);
+										rays[y].winding -= muttR_LineWinding(rays[y].y, &shape->lines[rays[y].hits[rays[y].ih++].l]);
+									}
+									// Add if sample is in
+									in_per += (rays[y].winding==0) ?(0.f) :(weight);
+								}
+							}
+
+							cov[w] = in_per;
+						}
+						// Pixels past the last hit are as in as the last pixel up to the glyph range
+						if (cov[w-1] != 0.f) {
+							for (; w < w_lim; ++w) {
+								cov[w] = cov[w-1];
+							}
+						}
+
+						// Calculate pixel colors based on how much each pixel is in, with
+						// the x-values outside of the row extents not in at all
+						// \left(a\right)\left(m_{1}-m_{0}\right)+m_{0}
+						muttR_RowFill(bitmap, spans, adv, h, 0, w_start, (uint8_m)out, (uint8_m)out);
+						muttR_RowOut(bitmap, spans, adv, h, w_start, w, cov, in-out, out);
+						muttR_RowEnd(bitmap, spans, adv, h, w, w_lim, (uint8_m)out);
+					}
+				}
+
+				// MUTTR_FULL_PIXEL_AANXN
+				// Memory needed (besides lines)
+				static inline size_m muttR_FullPixelAANXNMemory(uint32_m num_lines, muttRBitmap* bitmap, uint8_m hs) {
+					return
+						// Hits (one set per ray + one for the active line list)
+						(num_lines * (hs+1) * sizeof(muttR_Hit))
+						// Rays
+						+ (hs * sizeof(muttR_Ray))
+						// Coverage row
+						+ (bitmap->width * sizeof(float))
+					;
+				}
+
+				// mem is given with size muttR_FullPixelAANXNMemory
+				void muttR_FullPixelAANXN(muttR_Shape* shape, muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint8_m in, uint8_m out, uint8_m vs, uint8_m hs, muByte* mem) {
+					// Hits
+					muttR_Hit* hits = (muttR_Hit*)mem;
+					mem += shape->num_lines * (hs+1) * sizeof(muttR_Hit);
+					// Rays
+					muttR_Ray* rays = (muttR_Ray*)mem;
+					mem += hs * sizeof(muttR_Ray);
+					// Coverage row
+					float* cov = (float*)mem;
+
+					// Fill all rays with their hit pointer
+					for (uint8_m r = 0; r < hs; ++r) {
+						rays[r].hits = hits + (shape->num_lines * r);
+					}
+
+					// Initialize active lines
+					muttR_ActiveList list;
+					muttR_ActiveListInit(&list, hits + (shape->num_lines * hs));
+
+					// Rasterize
+					muttR_FullPixelAANXNInner(shape, bitmap, spans, adv, (float)in, (float)out, vs, hs, rays, &list, cov);
+				}
+
+				// Widens the extents of a row (first cell, last cell) to include a range of cells
+				static inline void muttR_ExtentAdd(uint32_m* ext, uint32_m first, uint32_m last) {
+					ext[0] = (first < ext[0]) ?(first) :(ext[0]);
+					ext[1] = (last > ext[1]) ?(last) :(ext[1]);
+				}
+
+				// Initializes the extents of each row to being empty
+				static inline void muttR_ExtentsInit(uint32_m* ext, uint32_m height) {
+					for (uint32_m h = 0; h < height; ++h) {
+						ext[h*2] = ~((uint32_m)0);
+						ext[(h*2)+1] = 0;
+					}
+				}
+
+				// MUTTR_FULL_PIXEL_AREA line accumulation
+				// Accumulates the signed area that a line covers in each cell of its rows;
+				// based on the accumulation method used by font-rs
+				// If ext is given, the extents of each row are widened to include each cell touched
+				static inline void muttR_AreaLine(muttR_Line* line, float* acc, uint32_m acc_stride, uint32_m width, uint32_m height, uint32_m* ext) {
+					// Horizontal lines cover no area
+					if (line->y1-line->y0 == 0.f) {
+						return;
+					}
+					// Lines fully below or above the bitmap cover no rows
+					if (line->y1 <= 0.f || line->y0 >= (float)height) {
+						return;
+					}
+					// Direction of the line, for winding
+					float dir = (line->vec > 0.f) ?(1.f) :(-1.f);
+					// Amount x moves per y
+					float dxdy = (line->x1 - line->x0) / (line->y1 - line->y0);
+
+					// Calculate starting row, clipping the line to the bottom of the bitmap
+					float x = line->x0;
+					float ystart = line->y0;
+					if (ystart < 0.f) {
+						x -= ystart * dxdy;
+						ystart = 0.f;
+					}
+					// Calculate ending row, clipping the line to the top of the bitmap
+					float yend = mu_ceilf(line->y1);
+					if (yend > (float)height) {
+						yend = (float)height;
+					}
+					if (!(ystart < yend)) {
+						return;
+					}
+
+					// Loop through each row the line is in
+					float fwidth = (float)width;
+					for (uint32_m h = (uint32_m)ystart; h < (uint32_m)yend; ++h) {
+						float* row = &acc[h*acc_stride];
+
+						// Calculate how much of the row's height the line covers
+						float rtop = (((float)(h+1)) < line->y1) ?((float)(h+1)) :(line->y1);
+						float rbot = (((float)h) > ystart) ?((float)h) :(ystart);
+						float dy = rtop - rbot;
+						// Calculate x-value at top of line in row
+						float xnext = x + (dxdy * dy);
+						float d = dy * dir;
+
+						// Get x-range of line in row, clamped to bitmap
+						float x0 = (x < xnext) ?(x) :(xnext);
+						float x1 = (x < xnext) ?(xnext) :(x);
+						x0 = (x0 < 0.f) ?(0.f) :((x0 > fwidth) ?(fwidth) :(x0));
+						x1 = (x1 < 0.f) ?(0.f) :((x1 > fwidth) ?(fwidth) :(x1));
+						float x0floor = mu_floorf(x0);
+						uint32_m x0i = (uint32_m)x0floor;
+						float x1ceil = mu_ceilf(x1);
+						uint32_m x1i = (uint32_m)x1ceil;
+
+						// Track cells touched
+						if (ext) {
+							muttR_ExtentAdd(&ext[h*2], x0i, (x1i > x0i+1) ?(x1i) :(x0i+1));
+						}
+
+						// Line is within one cell:
+						if (x1i <= x0i+1) {
+							// Area is split by the midpoint of the line in the cell
+							float xmf = (.5f * (x0 + x1)) - x0floor;
+							row[x0i]   += d - (d * xmf);
+							row[x0i+1] += d * xmf;
+						}
+						// Line spans multiple cells:
+						else {
+							float s = 1.f / (x1 - x0);
+							// First cell (triangle)
+							float x0f = x0 - x0floor;
+							float a0 = .5f * s * (1.f-x0f) * (1.f-x0f);
+							// Last cell (triangle)
+							float x1f = x1 - x1ceil + 1.f;
+							float am = .5f * s * x1f * x1f;
+							row[x0i] += d * a0;
+
+							// Just one cell in between:
+							if (x1i == x0i+2) {
+								row[x0i+1] += d * (1.f - a0 - am);
+							}
+							// Multiple cells in between:
+							else {
+								float a1 = s * (1.5f - x0f);
+								row[x0i+1] += d * (a1 - a0);
+								for (uint32_m xi = x0i+2; xi < x1i-1; ++xi) {
+									row[xi] += d * s;
+								}
+								float a2 = a1 + (((float)(x1i - x0i - 3)) * s);
+								row[x1i-1] += d * (1.f - a2 - am);
+							}
+							row[x1i] += d * am;
+						}
+
+						x = xnext;
+					}
+				}
+
+				// MUTTR_FULL_PIXEL_AREA
+				// Memory needed (besides lines)
+				static inline size_m muttR_FullPixelAreaMemory(muttRBitmap* bitmap) {
+					return
+						// Accumulation buffer
+						// (+2 per row since lines can touch the cell after their ceiling)
+						(((size_m)(bitmap->width+2)) * bitmap->height * sizeof(float))
+						// Row extents
+						+ (((size_m)bitmap->height) * 2 * sizeof(uint32_m))
+					;
+				}
+
+				// mem is given with size muttR_FullPixelAreaMemory
+				void muttR_FullPixelArea(muttR_Shape* shape, muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, float in, float out, muByte* mem) {
+					// Accumulation buffer
+					uint32_m acc_stride = bitmap->width+2;
+					size_m acc_size = ((size_m)acc_stride) * bitmap->height * sizeof(float);
+					float* acc = (float*)mem;
+					mu_memset(acc, 0, acc_size);
+					// Row extents
+					uint32_m* ext = (uint32_m*)(mem + acc_size);
+					muttR_ExtentsInit(ext, bitmap->height);
+
+					// Accumulate the area of each line
+					for (uint32_m l = 0; l < shape->num_lines; ++l) {
+						muttR_AreaLine(&shape->lines[l], acc, acc_stride, bitmap->width, bitmap->height, ext);
+					}
+					// Limit of pixels in glyph range
+					uint32_m w_lim = muttR_PixelLimit(shape->x_max, bitmap->width);
+
+					// Loop through each horizontal strip from bottom to top
+					for (uint32_m h = 0; h < bitmap->height; ++h) {
+						float* row = &acc[h*acc_stride];
+
+						// Just fill all x-values with out if the height is now outside of the glyph range
+						// (+ double-pixel extra for bleeding and ceiling)
+						if (h > shape->y_max+2) {
+							muttR_RunOut(bitmap, spans, adv, h, 0, bitmap->width, (uint8_m)out, (uint8_m)out);
+							continue;
+						}
+						// Just fill all x-values with out if no line touches this row
+						if (ext[h*2] > ext[(h*2)+1] || ext[h*2] >= w_lim) {
+							muttR_RowEnd(bitmap, spans, adv, h, 0, w_lim, (uint8_m)out);
+							continue;
 						}
-						// - y
-						if (flag & MUTT_Y_SHORT_VECTOR) {
-							// 1-byte y-coordinate
-							coord_length += 1;
-						} else if (!(flag & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR)) {
-							// 2-byte y-coordinate
-							coord_length += 2;
+						// Only the touched cells need to be summed; cells before them have no
+						// coverage, and cells past them have the same coverage as the last one
+						// (Rounded to multiples of 4 so that sums are grouped the same way by SIMD)
+						uint32_m w_start = ext[h*2] & ~((uint32_m)3);
+						uint32_m w_stop = (ext[(h*2)+1] + 4) & ~((uint32_m)3);
+						w_stop = (w_stop > bitmap->width) ?(bitmap->width) :(w_stop);
+
+						// Prefix-sum the row to get the coverage of each pixel
+						muttR_RowCoverage(row+w_start, w_stop-w_start);
+						// (Only pixels within the glyph range are output with their coverage)
+						w_stop = (w_stop > w_lim) ?(w_lim) :(w_stop);
+						if (row[w_stop-1] != 0.f) {
+							for (; w_stop < w_lim; ++w_stop) {
+								row[w_stop] = row[w_stop-1];
+							}
 						}
+						// Calculate pixel colors based on how much each pixel is in
+						// (Rounded, since accumulated area is rarely exactly 0 or 1)
+						muttR_RowFill(bitmap, spans, adv, h, 0, w_start, (uint8_m)out, (uint8_m)out);
+						muttR_RowOut(bitmap, spans, adv, h, w_start, w_stop, row, in-out, out+.5f);
+						muttR_RowEnd(bitmap, spans, adv, h, w_stop, w_lim, (uint8_m)out);
+					}
+				}
 
-						// Verify length based on coord length
-						req += coord_length;
-						if (header->length < req) {
-							mu_free(flags);
-							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				// MUTTR_LCD_RGB / MUTTR_LCD_BGR
+				// Memory needed (besides lines)
+				static inline size_m muttR_LCDMemory(muttRBitmap* bitmap) {
+					// Accumulation buffer, 3 subpixels per pixel
+					// (+2 per row since lines can touch the cell after their ceiling)
+					return ((size_m)(bitmap->width*3+2)) * bitmap->height * sizeof(float);
+				}
+
+				// Gets the LCD filter given by raster info, normalized
+				static inline void muttR_InfoLCDFilter(muttRInfo* info, float* filter) {
+					static const uint8_m def[5] = MUTTR_LCD_FILTER_DEFAULT;
+					const uint8_m* weights = def;
+					// Use info's filter if any weight is set
+					if (info) {
+						for (uint8_m i = 0; i < 5; ++i) {
+							if (info->lcd_filter[i]) {
+								weights = info->lcd_filter;
+								break;
+							}
 						}
+					}
 
-						// Increment past this point/flag
-						++pi;
-						++data;
+					// Normalize
+					float sum = 0.f;
+					for (uint8_m i = 0; i < 5; ++i) {
+						sum += (float)weights[i];
+					}
+					for (uint8_m i = 0; i < 5; ++i) {
+						filter[i] = ((float)weights[i]) / sum;
+					}
+				}
 
-						// Handle repeating flags:
-						if (flag & MUTT_REPEAT_FLAG) {
-							// Verify length for next flag
-							if (header->length < ++req) {
-								mu_free(flags);
-								return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				// Gets the coverage of a subpixel in a row; 0 outside of the row
+				static inline float muttR_LCDSubpixel(float* row, int64_m i, int64_m width) {
+					return (i < 0 || i >= width) ?(0.f) :(row[i]);
+				}
+
+				// mem is given with size muttR_LCDMemory
+				void muttR_LCD(muttR_Shape* shape, muttRBitmap* bitmap, uint8_m adv, float in, float out, muBool bgr, float* filter, muByte* mem) {
+					// Accumulation buffer
+					uint32_m sub_width = bitmap->width*3;
+					uint32_m acc_stride = sub_width+2;
+					float* acc = (float*)mem;
+					mu_memset(acc, 0, muttR_LCDMemory(bitmap));
+
+					// Accumulate the area of each line at 3x horizontal resolution
+					// (The lines are in our own memory, so they can just be scaled)
+					for (uint32_m l = 0; l < shape->num_lines; ++l) {
+						muttR_Line* line = &shape->lines[l];
+						line->x0 *= 3.f;
+						line->x1 *= 3.f;
+						muttR_AreaLine(line, acc, acc_stride, sub_width, bitmap->height, 0);
+					}
+
+					// Channel of each subpixel
+					uint8_m r = (bgr) ?(2) :(0);
+					uint8_m b = (bgr) ?(0) :(2);
+					float range = in-out;
+					// (Rounded, since accumulated area is rarely exactly 0 or 1)
+					float bias = out+.5f;
+
+					// Loop through each horizontal strip from bottom to top
+					for (uint32_m h = 0; h < bitmap->height; ++h) {
+						// Calculate horizontal pixel offset
+						uint8_m* pixels = &bitmap->pixels[bitmap->stride*((bitmap->height-h)-1)];
+						float* row = &acc[h*acc_stride];
+
+						// Prefix-sum the row to get the coverage of each subpixel
+						muttR_RowCoverage(row, sub_width);
+
+						// Loop through each pixel
+						for (uint32_m w = 0; w < bitmap->width; ++w) {
+							// Filter each subpixel
+							float c[3];
+							for (uint8_m s = 0; s < 3; ++s) {
+								int64_m center = ((int64_m)w)*3 + s;
+								float v = 0.f;
+								for (int64_m k = 0; k < 5; ++k) {
+									v += filter[k] * muttR_LCDSubpixel(row, center+k-2, sub_width);
+								}
+								c[s] = (v > 1.f) ?(1.f) :(v);
 							}
 
-							// Get next flag as length
-							uint8_m next = *data++;
-							// If next is 0, we don't repeat at all, and pretend
-							// like this never happened
-							if (next == 0) {
+							// Single channel: average
+							if (adv == 1) {
+								pixels[w] = (uint8_m)((((c[0]+c[1]+c[2]) / 3.f) * range) + bias);
 								continue;
 							}
-
-							// Verify length for repeated coordinate flags
-							req += ((uint32_m)coord_length) * ((uint32_m)(next-1));
-							if (header->length < req) {
-								mu_free(flags);
-								return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+							// Color channels in subpixel order
+							pixels[(w*adv)+r] = (uint8_m)((c[0]*range) + bias);
+							pixels[(w*adv)+1] = (uint8_m)((c[1]*range) + bias);
+							pixels[(w*adv)+b] = (uint8_m)((c[2]*range) + bias);
+							// Alpha: highest coverage
+							if (adv == 4) {
+								float a = (c[0] > c[1]) ?(c[0]) :(c[1]);
+								a = (a > c[2]) ?(a) :(c[2]);
+								pixels[(w*adv)+3] = (uint8_m)((a*range) + bias);
 							}
+						}
+					}
+				}
 
-							// Go through each repeat flag and copy it down
-							for (uint8_m r = 0; r < next && pi < num_points; ++r) {
-								flags[pi++] = flag;
+				// Fixed-point MUTTR_FULL_PIXEL_BI_LEVEL
+				// Memory needed (besides lines)
+				static inline size_m muttR_FixedBiLevelMemory(uint32_m num_lines) {
+					// Hit tracker (one set for the ray + one for the active line list)
+					return num_lines * 2 * sizeof(muttR_FixedHit);
+				}
+
+				// Checks if a fixed-point value is past a fixed-point maximum
+				// (+ double-pixel extra for bleeding and ceiling)
+				static inline muBool muttR_FixedPast(uint32_m v, int32_m max) {
+					return (((int64_m)v) << MUTTR_FIXED_SHIFT) > ((int64_m)max) + (2*MUTTR_FIXED_ONE);
+				}
+
+				// mem is given with size muttR_FixedBiLevelMemory
+				void muttR_FixedBiLevel(muttR_FixedShape* shape, muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint8_m in, uint8_m out, muByte* mem) {
+					// Hit trackers
+					muttR_FixedRay ray;
+					ray.hits = (muttR_FixedHit*)mem;
+					muttR_FixedList list;
+					list.next = list.num_hits = 0;
+					list.hits = ray.hits + shape->num_lines;
+					// Limit of pixels in glyph range
+					uint32_m w_lim = muttR_FixedPixelLimit(shape->x_max, bitmap->width);
+
+					// Loop through each horizontal strip from bottom to top
+					for (uint32_m h = 0; h < bitmap->height; ++h) {
+						// Just fill all x-values with out if the height is now outside of the glyph range
+						if (muttR_FixedPast(h, shape->y_max)) {
+							muttR_RunOut(bitmap, spans, adv, h, 0, bitmap->width, out, out);
+							continue;
+						}
+
+						// Calculate ray (middle of pixel)
+						muttR_FixedRayCalc(shape, &list, &ray, (int32_m)((h << MUTTR_FIXED_SHIFT) + MUTTR_FIXED_HALF));
+
+						// Calculate row extents; only pixels from the first hit's pixel up to
+						// the first pixel past the last hit need to be calculated
+						uint32_m w_start = 0, w_stop = 0;
+						if (ray.num_hits != 0) {
+							w_start = muttR_FixedPixelFloor(ray.hits[0].x, w_lim);
+							w_stop = muttR_FixedPixelFloor(ray.hits[ray.num_hits-1].x, w_lim) + 2;
+							w_stop = (w_stop > w_lim) ?(w_lim) :(w_stop);
+						}
+
+						// Loop through each x-value, filling runs of pixels with the same value at once
+						uint32_m run = 0; // (Start of current run)
+						uint8_m run_value = out; // (Value of current run)
+						uint32_m w = w_start;
+						for (; w < w_stop; ++w) {
+							// Check if middle of pixel is in
+							uint8_m value = (muttR_FixedRayIn(shape, &ray, (int32_m)((w << MUTTR_FIXED_SHIFT) + MUTTR_FIXED_HALF))) ?(in) :(out);
+							// Fill last run if this pixel starts a new one
+							if (value != run_value) {
+								muttR_RunOut(bitmap, spans, adv, h, run, w, run_value, out);
+								run = w;
+								run_value = value;
 							}
 						}
+						// Pixels past the last hit continue the last run up to the glyph range
+						if (w > w_start) {
+							w = w_lim;
+						}
+
+						// Fill last run, and the remaining pixels with out
+						muttR_RunOut(bitmap, spans, adv, h, run, w, run_value, out);
+						muttR_RunOut(bitmap, spans, adv, h, w, bitmap->width, out, out);
 					}
+				}
 
-					// Loop through each x-coordinate
-					pi = 0;
-					int16_m prev_x = 0;
-					while (pi < num_points) {
-						// Get x-coordinate
-						int16_m x;
-						if (flags[pi] & MUTT_X_SHORT_VECTOR) {
-							// 1-byte
-							if (flags[pi] & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
-								// Positive
-								x = (int16_m)*data++;
-							} else {
-								// Negative
-								x = -((int16_m)*data++);
-							}
-						} else {
-							if (flags[pi] & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
-								// Repeated x-coordinate
-								++pi;
-								continue;
-							} else {
-								// 2-bytes, signed
-								x = MU_RBES16(data);
-								data += 2;
-							}
+				// Fixed-point MUTTR_FULL_PIXEL_AANXN
+				// Memory needed (besides lines)
+				static inline size_m muttR_FixedAANXNMemory(uint32_m num_lines, muttRBitmap* bitmap, uint8_m hs) {
+					return
+						// Hits (one set per ray + one for the active line list)
+						MUTTR_ALIGN_MEMORY(num_lines * (hs+1) * sizeof(muttR_FixedHit))
+						// Coverage row
+						+ (bitmap->width * sizeof(uint16_m))
+					;
+				}
+
+				// mem is given with size muttR_FixedAANXNMemory
+				void muttR_FixedAANXN(muttR_FixedShape* shape, muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint8_m in, uint8_m out, uint8_m vs, uint8_m hs, muByte* mem) {
+					// Hits; fill all rays with their hit pointer
+					muttR_FixedHit* hits = (muttR_FixedHit*)mem;
+					mem += MUTTR_ALIGN_MEMORY(shape->num_lines * (hs+1) * sizeof(muttR_FixedHit));
+					muttR_FixedRay rays[8];
+					for (uint8_m r = 0; r < hs; ++r) {
+						rays[r].hits = hits + (shape->num_lines * r);
+					}
+					// Coverage row
+					uint16_m* cov = (uint16_m*)mem;
+
+					// Initialize active lines
+					muttR_FixedList list;
+					list.next = list.num_hits = 0;
+					list.hits = hits + (shape->num_lines * hs);
+
+					// Offset of each sample within a pixel (same math as float version)
+					int32_m xoff[8], yoff[8];
+					for (uint8_m x = 0; x < vs; ++x) {
+						xoff[x] = ((x+1) * MUTTR_FIXED_ONE) / (vs+1);
+					}
+					for (uint8_m y = 0; y < hs; ++y) {
+						yoff[y] = ((y+1) * MUTTR_FIXED_ONE) / (hs+1);
+					}
+					// Coverage of each sample (vs*hs is a power of 2 that divides MUTTR_FIXED_ONE)
+					uint16_m weight = (uint16_m)(MUTTR_FIXED_ONE / (vs*hs));
+					// Limit of pixels in glyph range
+					uint32_m w_lim = muttR_FixedPixelLimit(shape->x_max, bitmap->width);
+
+					// Loop through each horizontal strip from bottom to top
+					for (uint32_m h = 0; h < bitmap->height; ++h) {
+						// Just fill all x-values with out if the height is now outside of the glyph range
+						if (muttR_FixedPast(h, shape->y_max)) {
+							muttR_RunOut(bitmap, spans, adv, h, 0, bitmap->width, out, out);
+							continue;
 						}
 
-						// Add as vector to prior value
-						int32_m test_val = prev_x + x;
-						// Verify FUnit range
-						if (test_val < -16384 || test_val > 16383) {
-							mu_free(flags);
-							return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
+						// Calculate each ray, and the row extents from all of their hits
+						uint32_m w_start = w_lim, w_stop = 0;
+						for (uint8_m r = 0; r < hs; ++r) {
+							muttR_FixedRay* ray = rays+r;
+							muttR_FixedRayCalc(shape, &list, ray, (int32_m)(h << MUTTR_FIXED_SHIFT) + yoff[r]);
+							if (ray->num_hits != 0) {
+								uint32_m first = muttR_FixedPixelFloor(ray->hits[0].x, w_lim);
+								uint32_m last = muttR_FixedPixelFloor(ray->hits[ray->num_hits-1].x, w_lim) + 2;
+								last = (last > w_lim) ?(w_lim) :(last);
+								w_start = (first < w_start) ?(first) :(w_start);
+								w_stop = (last > w_stop) ?(last) :(w_stop);
+							}
 						}
-						// Consider it with currently calculated x min/max
-						if ((test_val < header->x_min) || (pi == 0)) {
-							header->x_min = test_val;
+						// Just fill all x-values with out if no ray hits anything
+						if (w_start >= w_stop) {
+							muttR_RowEnd(bitmap, spans, adv, h, 0, w_lim, out);
+							continue;
 						}
-						if ((test_val > header->x_max) || (pi == 0)) {
-							header->x_max = test_val;
+
+						// Loop through each x-value within the row extents
+						uint32_m w = w_start;
+						for (; w < w_stop; ++w) {
+							// Add each sample that is in
+							uint16_m in_per = 0;
+							for (uint8_m x = 0; x < vs; ++x) {
+								int32_m ray_x = (int32_m)(w << MUTTR_FIXED_SHIFT) + xoff[x];
+								for (uint8_m y = 0; y < hs; ++y) {
+									in_per += (muttR_FixedRayIn(shape, rays+y, ray_x)) ?(weight) :(0);
+								}
+							}
+							cov[w] = in_per;
 						}
-						// Set previous x as current x
-						prev_x = test_val;
-						++pi;
+						// Pixels past the last hit are as in as the last pixel up to the glyph range
+						if (cov[w-1] != 0) {
+							for (; w < w_lim; ++w) {
+								cov[w] = cov[w-1];
+							}
+						}
+
+						// Calculate pixel colors based on how much each pixel is in, with
+						// the x-values outside of the row extents not in at all
+						muttR_RowFill(bitmap, spans, adv, h, 0, w_start, out, out);
+						muttR_RowOutFixed(bitmap, spans, adv, h, w_start, w, cov, in, out);
+						muttR_RowEnd(bitmap, spans, adv, h, w, w_lim, out);
 					}
+				}
 
-					// Loop through each y-coordinate
-					pi = 0;
-					int16_m prev_y = 0;
-					while (pi < num_points) {
-						// Get y-coordinate
-						int16_m y;
-						if (flags[pi] & MUTT_Y_SHORT_VECTOR) {
-							// 1-byte
-							if (flags[pi] & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
-								// Positive
-								y = (int16_m)*data++;
+				// Fixed-point MUTTR_FULL_PIXEL_AREA
+				// Rather than the float version's accumulation, each cell (pixel) holds the
+				// height of the lines passing through it ("cover") and twice the area to their
+				// left ("area"), both in fixed-point; the coverage of a cell is then the sum of
+				// the covers of all cells before it minus its area, which needs no division.
+				// Adds a part of a line, which is within one cell, to a cell
+				static inline void muttR_FixedAreaCell(int32_m* cell, int32_m fx0, int32_m fx1, int32_m dy, int32_m dir) {
+					cell[0] += dir * dy;
+					cell[1] += dir * dy * (fx0 + fx1);
+				}
+
+				// Calculates the x-value of a fixed-point line at a y-value
+				static inline int32_m muttR_FixedLineX(muttR_FixedLine* line, int32_m y) {
+					return muttR_FixedLineRayHit(y, line->x0, line->y0, line->x1, line->y1);
+				}
+
+				// Accumulates the cover and area that a line has in each cell of its rows
+				// Each cell is two int32_m values: cover, then area
+				// The range of cells touched in each row is added to ext
+				static inline void muttR_FixedAreaLine(muttR_FixedLine* line, int32_m* cells, uint32_m cell_stride, uint32_m width, uint32_m height, uint32_m* ext) {
+					// Horizontal lines cover no area
+					if (line->dir == 0) {
+						return;
+					}
+
+					// Clip line's y-range to the bitmap
+					int64_m fw = ((int64_m)width) << MUTTR_FIXED_SHIFT;
+					int64_m fh = ((int64_m)height) << MUTTR_FIXED_SHIFT;
+					int32_m ystart = (line->y0 < 0) ?(0) :(line->y0);
+					int32_m yend = (line->y1 > fh) ?((int32_m)fh) :(line->y1);
+					if (ystart >= yend) {
+						return;
+					}
+
+					// Loop through each row the line is in
+					for (int32_m h = ystart >> MUTTR_FIXED_SHIFT; h <= ((yend-1) >> MUTTR_FIXED_SHIFT); ++h) {
+						int32_m* row = &cells[((uint32_m)h)*cell_stride*2];
+
+						// Calculate part of line within row, with x clamped to bitmap
+						int32_m ya = (line->y0 > (h << MUTTR_FIXED_SHIFT)) ?(line->y0) :(h << MUTTR_FIXED_SHIFT);
+						int32_m yb = (line->y1 < ((h+1) << MUTTR_FIXED_SHIFT)) ?(line->y1) :((h+1) << MUTTR_FIXED_SHIFT);
+						int32_m xa = muttR_FixedLineX(line, ya);
+						int32_m xb = muttR_FixedLineX(line, yb);
+						xa = (xa < 0) ?(0) :((xa > fw) ?((int32_m)fw) :(xa));
+						xb = (xb < 0) ?(0) :((xb > fw) ?((int32_m)fw) :(xb));
+						muttR_ExtentAdd(&ext[h*2], (uint32_m)(((xa < xb) ?(xa) :(xb)) >> MUTTR_FIXED_SHIFT), (uint32_m)(((xa > xb) ?(xa) :(xb)) >> MUTTR_FIXED_SHIFT));
+
+						// Vertical within row:
+						if (xa == xb) {
+							int32_m cx = xa >> MUTTR_FIXED_SHIFT;
+							int32_m fx = xa - (cx << MUTTR_FIXED_SHIFT);
+							muttR_FixedAreaCell(&row[cx*2], fx, fx, yb-ya, line->dir);
+							continue;
+						}
+
+						// Otherwise, walk each cell that the line crosses in the row
+						int32_m x = xa, y = ya;
+						while (x != xb) {
+							// Get cell and the x-value at which the line leaves it
+							int32_m cx, nx, ny;
+							if (xb > xa) {
+								cx = x >> MUTTR_FIXED_SHIFT;
+								nx = (cx+1) << MUTTR_FIXED_SHIFT;
+								nx = (xb < nx) ?(xb) :(nx);
+								ny = ya + (int32_m)muttR_FloorDiv(((int64_m)(nx-xa)) * (yb-ya), xb-xa);
 							} else {
-								// Negative
-								y = -((int16_m)*data++);
+								// (A point on the left edge of a cell belongs to the cell before)
+								cx = (x-1) >> MUTTR_FIXED_SHIFT;
+								nx = cx << MUTTR_FIXED_SHIFT;
+								nx = (xb > nx) ?(xb) :(nx);
+								ny = ya + (int32_m)muttR_FloorDiv(((int64_m)(xa-nx)) * (yb-ya), xa-xb);
 							}
-						} else {
-							if (flags[pi] & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
-								// Repeated y-coordinate
-								++pi;
-								continue;
-							} else {
-								// 2 bytes, signed
-								y = MU_RBES16(data);
-								data += 2;
+							// (Last part ends exactly at the end of the row part)
+							if (nx == xb) {
+								ny = yb;
 							}
-						}
 
-						// Add as vector to prior value
-						int32_m test_val = prev_y + y;
-						// Verify FUnit range
-						if (test_val < -16384 || test_val > 16383) {
-							mu_free(flags);
-							return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
-						}
-						// Consider it with currently calculated y min/max
-						if ((test_val < header->y_min) || (pi == 0)) {
-							header->y_min = test_val;
-						}
-						if ((test_val > header->y_max) || (pi == 0)) {
-							header->y_max = test_val;
+							int32_m cell_x = cx << MUTTR_FIXED_SHIFT;
+							muttR_FixedAreaCell(&row[cx*2], x - cell_x, nx - cell_x, ny - y, line->dir);
+							x = nx;
+							y = ny;
 						}
-						// Set previous y as current y
-						prev_y = test_val;
-						++pi;
 					}
+				}
 
-					// Deallocate flags
-					mu_free(flags);
-					return MUTT_SUCCESS; if (font) {}
+				// Memory needed (besides lines)
+				static inline size_m muttR_FixedAreaMemory(muttRBitmap* bitmap) {
+					return
+						// Cells
+						// (+2 per row since lines can touch the cell after their ceiling)
+						MUTTR_ALIGN_MEMORY(((size_m)(bitmap->width+2)) * bitmap->height * 2 * sizeof(int32_m)
+						// Row extents
+						+ (((size_m)bitmap->height) * 2 * sizeof(uint32_m)))
+						// Coverage row
+						+ (bitmap->width * sizeof(uint16_m))
+					;
 				}
 
-				// Fills in (or calculates memory needed for) "muttCompositeGlyph" struct
-				MUDEF muttResult mutt_composite_glyph(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muByte* data, uint32_m* written) {
-					// Placeholder variables
-					uint32_m req = 0; // Required length
-					muByte* gdata = header->data; // Progressive data pointer
+				// mem is given with size muttR_FixedAreaMemory
+				void muttR_FixedArea(muttR_FixedShape* shape, muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint8_m in, uint8_m out, muByte* mem) {
+					// Cells
+					uint32_m cell_stride = bitmap->width+2;
+					size_m cells_size = ((size_m)cell_stride) * bitmap->height * 2 * sizeof(int32_m);
+					int32_m* cells = (int32_m*)mem;
+					mu_memset(cells, 0, cells_size);
+					// Row extents
+					size_m ext_size = ((size_m)bitmap->height) * 2 * sizeof(uint32_m);
+					uint32_m* ext = (uint32_m*)(mem + cells_size);
+					muttR_ExtentsInit(ext, bitmap->height);
+					// Coverage row
+					uint16_m* cov = (uint16_m*)(mem + MUTTR_ALIGN_MEMORY(cells_size + ext_size));
+
+					// Accumulate the cover and area of each line
+					for (uint32_m l = 0; l < shape->num_lines; ++l) {
+						muttR_FixedAreaLine(&shape->lines[l], cells, cell_stride, bitmap->width, bitmap->height, ext);
+					}
+					// Limit of pixels in glyph range
+					uint32_m w_lim = muttR_FixedPixelLimit(shape->x_max, bitmap->width);
 
-					// For memory calculations:
-					if (!data) {
-						// Loop through each record
-						uint16_m flags = (header->length != 0) ?(MUTT_MORE_COMPONENTS) :(0);
-						uint32_m written_amt = 0;
-						muBool instructions = MU_FALSE;
-						uint32_m component_count = 0;
+					// Loop through each horizontal strip from bottom to top
+					for (uint32_m h = 0; h < bitmap->height; ++h) {
+						int32_m* row = &cells[h*cell_stride*2];
 
-						while (flags & MUTT_MORE_COMPONENTS) {
-							// Verify component count
-							if (++component_count > font->maxp->max_component_elements) {
-								return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
+						// Just fill all x-values with out if the height is now outside of the glyph range
+						if (muttR_FixedPast(h, shape->y_max)) {
+							muttR_RunOut(bitmap, spans, adv, h, 0, bitmap->width, out, out);
+							continue;
+						}
+						// Just fill all x-values with out if no line touches this row
+						if (ext[h*2] > ext[(h*2)+1] || ext[h*2] >= w_lim) {
+							muttR_RowEnd(bitmap, spans, adv, h, 0, w_lim, out);
+							continue;
+						}
+						// Only the touched cells need to be summed; cells before them have no
+						// coverage, and cells past them have only the total cover of the row
+						uint32_m w_start = ext[h*2];
+						uint32_m w_stop = ext[(h*2)+1] + 1;
+						w_stop = (w_stop > w_lim) ?(w_lim) :(w_stop);
+
+						// Sum the covers of the row to get the coverage of each pixel;
+						// coverage is the absolute value, clamped to 1, like the float version
+						int64_m cover = 0;
+						for (uint32_m w = w_start; w < w_stop; ++w) {
+							cover += row[w*2];
+							int64_m a = (cover * (2*MUTTR_FIXED_ONE)) - row[(w*2)+1];
+							a = ((a < 0) ?(-a) :(a)) / (2*MUTTR_FIXED_ONE);
+							cov[w] = (uint16_m)((a > MUTTR_FIXED_ONE) ?(MUTTR_FIXED_ONE) :(a));
+						}
+						cover = (cover < 0) ?(-cover) :(cover);
+						if (cover != 0) {
+							uint16_m rest = (uint16_m)((cover > MUTTR_FIXED_ONE) ?(MUTTR_FIXED_ONE) :(cover));
+							for (; w_stop < w_lim; ++w_stop) {
+								cov[w_stop] = rest;
 							}
-							// Add component to mem req
-							written_amt += sizeof(muttComponentGlyph);
+						}
 
-							// Verify length for flags and glyphIndex
-							req += 4;
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-							}
-							// Read flags for if we have more components and instructions
-							uint16_m this_flags = MU_RBEU16(gdata);
-							flags = this_flags & MUTT_MORE_COMPONENTS;
-							if (this_flags & MUTT_WE_HAVE_INSTRUCTIONS) {
-								instructions = MU_TRUE;
-							}
-							// Skip past flags and glyphIndex
-							gdata += 4;
+						// Calculate pixel colors based on how much each pixel is in
+						muttR_RowFill(bitmap, spans, adv, h, 0, w_start, out, out);
+						muttR_RowOutFixed(bitmap, spans, adv, h, w_start, w_stop, cov, in, out);
+						muttR_RowEnd(bitmap, spans, adv, h, w_stop, w_lim, out);
+					}
+				}
 
-							// Add arguments to req length and skip past
-							if (this_flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
-								// 2 bytes per
-								req += 4;
-								gdata += 4;
-							}
-							else {
-								// 1 byte per
-								req += 2;
-								gdata += 2;
-							}
+				// MUTTR_SDF / MUTTR_MSDF
+				// MSDF channel colors
+				#define MUTTR_SDF_RED     0x01
+				#define MUTTR_SDF_GREEN   0x02
+				#define MUTTR_SDF_BLUE    0x04
+				#define MUTTR_SDF_CYAN    (MUTTR_SDF_GREEN | MUTTR_SDF_BLUE)
+				#define MUTTR_SDF_MAGENTA (MUTTR_SDF_RED | MUTTR_SDF_BLUE)
+				#define MUTTR_SDF_YELLOW  (MUTTR_SDF_RED | MUTTR_SDF_GREEN)
+				#define MUTTR_SDF_WHITE   (MUTTR_SDF_RED | MUTTR_SDF_GREEN | MUTTR_SDF_BLUE)
+				// sin(3 radians); tangents whose angle passes this form a corner
+				#define MUTTR_SDF_CORNER_CROSS 0.14112000806f
+
+				// Solves at^2 + bt + c = 0, returning the amount of roots
+				static inline uint32_m muttR_SolveQuadratic(float a, float b, float c, float* t) {
+					// Linear
+					if (mu_fabsf(a) < 1e-12f) {
+						if (mu_fabsf(b) < 1e-12f) {
+							return 0;
+						}
+						t[0] = -c / b;
+						return 1;
+					}
+					// Quadratic
+					float disc = (b*b) - (4.f*a*c);
+					if (disc < 0.f) {
+						return 0;
+					}
+					disc = mu_sqrtf(disc);
+					t[0] = (-b + disc) / (2.f*a);
+					t[1] = (-b - disc) / (2.f*a);
+					return 2;
+				}
+
+				// Solves at^3 + bt^2 + ct + d = 0, returning the amount of roots
+				static inline uint32_m muttR_SolveCubic(float a, float b, float c, float d, float* t) {
+					// Cubics whose leading term is negligible are solved as quadratics
+					if (a == 0.f || mu_fabsf(b/a) > 1e6f) {
+						return muttR_SolveQuadratic(b, c, d, t);
+					}
+					b /= a; c /= a; d /= a;
+
+					// (https://en.wikipedia.org/wiki/Cubic_equation#Trigonometric_and_hyperbolic_solutions)
+					float b2 = b*b;
+					float q = (b2 - (3.f*c)) / 9.f;
+					float r = ((b*((2.f*b2) - (9.f*c))) + (27.f*d)) / 54.f;
+					float r2 = r*r;
+					float q3 = q*q*q;
+					b /= 3.f;
+					// - Three real roots
+					if (r2 < q3) {
+						float u = r / mu_sqrtf(q3);
+						u = (u < -1.f) ?(-1.f) :((u > 1.f) ?(1.f) :(u));
+						u = mu_acosf(u);
+						q = -2.f * mu_sqrtf(q);
+						t[0] = (q * mu_cosf(u / 3.f)) - b;
+						t[1] = (q * mu_cosf((u + 6.28318530718f) / 3.f)) - b;
+						t[2] = (q * mu_cosf((u - 6.28318530718f) / 3.f)) - b;
+						return 3;
+					}
+					// - One real root
+					float u = -mu_cbrtf(mu_fabsf(r) + mu_sqrtf(r2 - q3));
+					if (r < 0.f) {
+						u = -u;
+					}
+					float v = (u == 0.f) ?(0.f) :(q / u);
+					t[0] = (u + v) - b;
+					return 1;
+				}
+
+				// Gets the direction of a segment at its start (0) or end (1)
+				static inline void muttR_SegmentDir(muttR_Segment* seg, muBool end, float* dx, float* dy) {
+					if (end) {
+						*dx = seg->x2 - seg->x1;
+						*dy = seg->y2 - seg->y1;
+					} else {
+						*dx = seg->x1 - seg->x0;
+						*dy = seg->y1 - seg->y0;
+					}
+					// (Control point on top of an end point)
+					if (*dx == 0.f && *dy == 0.f) {
+						*dx = seg->x2 - seg->x0;
+						*dy = seg->y2 - seg->y0;
+					}
+				}
 
-							// Add transform to req length and skip past
-							// We're not checking for mutual exclusivity here, as
-							// it's not relevant to mem req
-							if (this_flags & MUTT_WE_HAVE_A_SCALE) {
-								// One F2DOT14
-								req += 2;
-								gdata += 2;
+				// The distance from a point to a segment
+				struct muttR_Distance {
+					// Unsigned distance to the closest point
+					float dist;
+					// How parallel the direction to the closest point is to the segment (0 to 1);
+					// used to pick between segments of equal distance, such as at corners
+					float dot;
+					// Signed distance to the closest point (positive is inside)
+					float sd;
+					// Signed distance to the segment extended past its end points at their tangents
+					float pseudo;
+				};
+				typedef struct muttR_Distance muttR_Distance;
+
+				// Whether or not distance d0 is closer than distance d1
+				static inline muBool muttR_DistanceCloser(muttR_Distance* d0, muttR_Distance* d1) {
+					if (mu_fabsf(d0->dist - d1->dist) <= 1e-5f) {
+						return d0->dot < d1->dot;
+					}
+					return d0->dist < d1->dist;
+				}
+
+				// Calculates the distance from a point to a segment
+				// Outer contours go clockwise, so the inside is to the right of each segment
+				static inline void muttR_SegmentDistance(muttR_Segment* seg, float px, float py, muttR_Distance* d) {
+					float t, cx, cy, dx, dy;
+
+					// Line
+					if (!seg->curve) {
+						dx = seg->x2 - seg->x0;
+						dy = seg->y2 - seg->y0;
+						float l2 = (dx*dx) + (dy*dy);
+						t = (l2 == 0.f) ?(0.f) :(((px-seg->x0)*dx + (py-seg->y0)*dy) / l2);
+						float tc = (t < 0.f) ?(0.f) :((t > 1.f) ?(1.f) :(t));
+						cx = seg->x0 + (tc*dx);
+						cy = seg->y0 + (tc*dy);
+					}
+					// Bezier
+					else {
+						// Closest point is where (B(t) - P) . B'(t) = 0; with B(t) = p0 + 2ta + t^2b,
+						// this is the cubic (b.b)t^3 + 3(a.b)t^2 + (2(a.a) + (q.b))t + (q.a) = 0
+						float ax = seg->x1 - seg->x0, ay = seg->y1 - seg->y0;
+						float bx = seg->x2 - (2.f*seg->x1) + seg->x0, by = seg->y2 - (2.f*seg->y1) + seg->y0;
+						float qx = seg->x0 - px, qy = seg->y0 - py;
+						float ca = (bx*bx) + (by*by);
+						float cb = 3.f * ((ax*bx) + (ay*by));
+						float cc = (2.f * ((ax*ax) + (ay*ay))) + ((qx*bx) + (qy*by));
+						float cd = (qx*ax) + (qy*ay);
+
+						// Start with end points
+						float best_t = 0.f;
+						float best = (qx*qx) + (qy*qy);
+						float ex = seg->x2 - px, ey = seg->y2 - py;
+						if ((ex*ex) + (ey*ey) < best) {
+							best_t = 1.f;
+							best = (ex*ex) + (ey*ey);
+						}
+
+						// Check each root within the curve
+						float roots[3];
+						uint32_m num_roots = muttR_SolveCubic(ca, cb, cc, cd, roots);
+						for (uint32_m r = 0; r < num_roots; ++r) {
+							float rt = roots[r];
+							// Polish with a Newton step
+							float df = (3.f*ca*rt*rt) + (2.f*cb*rt) + cc;
+							if (df != 0.f) {
+								rt -= ((((ca*rt) + cb)*rt + cc)*rt + cd) / df;
 							}
-							else if (this_flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-								// Two F2DOT14s
-								req += 4;
-								gdata += 4;
+							if (!(rt > 0.f && rt < 1.f)) {
+								continue;
 							}
-							else if (this_flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-								// Four F2DOT14s
-								req += 8;
-								gdata += 8;
+							float rx = qx + (2.f*rt*ax) + (rt*rt*bx);
+							float ry = qy + (2.f*rt*ay) + (rt*rt*by);
+							if ((rx*rx) + (ry*ry) < best) {
+								best_t = rt;
+								best = (rx*rx) + (ry*ry);
 							}
+						}
 
-							// Verify length for arguments and transform
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-							}
+						// Point and direction at closest t
+						muttR_Bezier(best_t, seg->x0, seg->y0, seg->x1, seg->y1, seg->x2, seg->y2, &cx, &cy);
+						if (best_t == 0.f || best_t == 1.f) {
+							muttR_SegmentDir(seg, best_t == 1.f, &dx, &dy);
+						} else {
+							dx = ax + (best_t*bx);
+							dy = ay + (best_t*by);
+						}
+						// (Beyond the end points on the side they face; for pseudo-distance)
+						t = best_t;
+						if (t == 0.f && ((px-seg->x0)*dx + (py-seg->y0)*dy) < 0.f) {
+							t = -1.f;
+						} else if (t == 1.f && ((px-seg->x2)*dx + (py-seg->y2)*dy) > 0.f) {
+							t = 2.f;
+						}
+					}
+
+					// Distance and sign
+					float vx = px - cx, vy = py - cy;
+					float dl = mu_sqrtf((dx*dx) + (dy*dy));
+					d->dist = mu_sqrtf((vx*vx) + (vy*vy));
+					d->dot = (d->dist == 0.f || dl == 0.f) ?(0.f) :(mu_fabsf(((dx*vx) + (dy*vy)) / (dl * d->dist)));
+					float cross = (dx*vy) - (dy*vx);
+					d->sd = (cross < 0.f) ?(d->dist) :(-d->dist);
+
+					// Pseudo-distance: distance to the tangent line past the end points
+					d->pseudo = d->sd;
+					if ((t < 0.f || t > 1.f) && dl != 0.f) {
+						float ox = (t < 0.f) ?(seg->x0) :(seg->x2);
+						float oy = (t < 0.f) ?(seg->y0) :(seg->y2);
+						float pseudo = -((dx*(py-oy)) - (dy*(px-ox))) / dl;
+						if (mu_fabsf(pseudo) <= d->dist) {
+							d->pseudo = pseudo;
 						}
+					}
+				}
 
-						// Instruction handling
-						if (instructions) {
-							// Verify length for instruction length
-							req += 2;
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-							}
+				// Whether or not two directions form a corner
+				static inline muBool muttR_SDFCorner(float ax, float ay, float bx, float by) {
+					float al = mu_sqrtf((ax*ax) + (ay*ay)), bl = mu_sqrtf((bx*bx) + (by*by));
+					if (al == 0.f || bl == 0.f) {
+						return MU_FALSE;
+					}
+					ax /= al; ay /= al; bx /= bl; by /= bl;
+					return ((ax*bx) + (ay*by)) <= 0.f || mu_fabsf((ax*by) - (ay*bx)) > MUTTR_SDF_CORNER_CROSS;
+				}
 
-							// Read instruction length
-							uint16_m instruction_length = MU_RBEU16(gdata);
-							// Verify with maxp
-							if (instruction_length > font->maxp->max_size_of_instructions) {
-								return MUTT_INVALID_GLYF_COMPOSITE_INSTRUCTION_LENGTH;
+				// Colors the segments of each contour for MSDF, such that the segments on
+				// both sides of a corner only share one channel
+				void muttR_SDFColor(muttR_Segment* segs, uint32_m num_segs) {
+					const uint8_m colors[3] = { MUTTR_SDF_CYAN, MUTTR_SDF_MAGENTA, MUTTR_SDF_YELLOW };
+
+					for (uint32_m s = 0; s < num_segs;) {
+						// Find range of segments in this contour
+						uint32_m e = s+1;
+						while (e < num_segs && segs[e].contour == segs[s].contour) {
+							++e;
+						}
+						uint32_m n = e - s;
+
+						// Find corners, and the first corner
+						// (A segment is a corner if it starts at a corner)
+						uint32_m num_corners = 0, first = 0;
+						for (uint32_m i = 0; i < n; ++i) {
+							float ax, ay, bx, by;
+							muttR_SegmentDir(&segs[s + ((i+n-1) % n)], MU_TRUE, &ax, &ay);
+							muttR_SegmentDir(&segs[s+i], MU_FALSE, &bx, &by);
+							if (muttR_SDFCorner(ax, ay, bx, by)) {
+								if (num_corners == 0) {
+									first = i;
+								}
+								++num_corners;
+								segs[s+i].color = 1;
+							} else {
+								segs[s+i].color = 0;
 							}
-							// Verify length for instructions
-							// Unneeded here since we're just calculating mem req
-							// ...
+						}
 
-							// Add instructions to mem req
-							written_amt += instruction_length;
+						// No corners; smooth contour, all channels
+						if (num_corners == 0) {
+							for (uint32_m i = s; i < e; ++i) {
+								segs[i].color = MUTTR_SDF_WHITE;
+							}
+						}
+						// One corner; split contour into three colors ("teardrop")
+						else if (num_corners == 1) {
+							const uint8_m tear[3] = { MUTTR_SDF_MAGENTA, MUTTR_SDF_WHITE, MUTTR_SDF_YELLOW };
+							for (uint32_m i = 0; i < n; ++i) {
+								segs[s + ((first+i) % n)].color = tear[(i*3) / n];
+							}
+						}
+						// Multiple corners; switch colors at each corner
+						else {
+							uint32_m c = 0, spline = 0;
+							for (uint32_m i = 0; i < n; ++i) {
+								muttR_Segment* seg = &segs[s + ((first+i) % n)];
+								if (i != 0 && seg->color == 1) {
+									++spline;
+									c = (c+1) % 3;
+									// (Last spline also neighbors the first)
+									if (spline == num_corners-1 && c == 0) {
+										c = 1;
+									}
+								}
+								seg->color = colors[c];
+							}
 						}
+						s = e;
+					}
+				}
 
-						// Give mem req and exit
-						*written = written_amt;
-						return MUTT_SUCCESS;
+				// Gets the SDF range given by raster info
+				static inline float muttR_InfoSDFRange(muttRInfo* info) {
+					if (!info || !(info->sdf_range > 0.f)) {
+						return MUTTR_DEFAULT_SDF_RANGE;
 					}
+					return info->sdf_range;
+				}
 
-					// Placeholder variables:
-					muByte* orig_data = data; // (Used for memory usage at the end)
-					uint32_m component_count = 0; // (Used for counting components; u32 to avoid overflow)
-					muBool instructions = MU_FALSE; // (To see if we've found instructions)
-					uint16_m flags = (header->length != 0) ?(MUTT_MORE_COMPONENTS) :(0);
+				// Memory needed (besides lines)
+				static inline size_m muttR_SDFMemory(muttRGlyph* glyph, uint32_m num_lines, muttRBitmap* bitmap) {
+					return
+						// Hit tracker
+						MUTTR_ALIGN_MEMORY(num_lines * sizeof(muttR_Hit))
+						// Segments (at most one per point)
+						+ MUTTR_ALIGN_MEMORY(glyph->num_points * sizeof(muttR_Segment))
+						// Segments near the current row
+						+ MUTTR_ALIGN_MEMORY(glyph->num_points * sizeof(uint32_m))
+						// Row values
+						+ (bitmap->width * sizeof(float))
+					;
+				}
 
-					// Point components array to current data (what we're filling in)
-					glyph->components = (muttComponentGlyph*)data;
-					muttComponentGlyph* c = glyph->components;
+				// mem is given with size muttR_SDFMemory
+				// If multi, the distance is calculated per channel (MSDF)
+				void muttR_SDF(muttRGlyph* glyph, muttR_Shape* shape, muttRBitmap* bitmap, uint8_m adv, float in, float out, float range, muBool multi, muByte* mem) {
+					// Hit tracker
+					muttR_Hit* hits = (muttR_Hit*)mem;
+					mem += MUTTR_ALIGN_MEMORY(shape->num_lines * sizeof(muttR_Hit));
+					// Segments
+					muttR_Segment* segs = (muttR_Segment*)mem;
+					uint32_m num_segs = muttR_GlyphSegments(glyph, segs);
+					mem += MUTTR_ALIGN_MEMORY(glyph->num_points * sizeof(muttR_Segment));
+					if (multi) {
+						muttR_SDFColor(segs, num_segs);
+					}
+					// Segments near row
+					uint32_m* near = (uint32_m*)mem;
+					mem += MUTTR_ALIGN_MEMORY(glyph->num_points * sizeof(uint32_m));
+					// Row values
+					float* row = (float*)mem;
 
-					// Loop through each component:
-					while (flags & MUTT_MORE_COMPONENTS) {
-						// Verify component count
-						if (component_count > font->maxp->max_component_elements) {
-							return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
-						}
+					// Initialize active lines
+					muttR_ActiveList list;
+					muttR_ActiveListInit(&list, hits);
 
-						// Verify length for flags and glyphIndex
-						req += 4;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+					// Distances beyond the range are clamped, so single-channel
+					// fields only need to consider segments within range
+					float max_dist = (multi) ?(3.402823466e+38f) :(range);
+					float scale = .5f / range;
 
-						// Read flags
-						c->flags = MU_RBEU16(gdata);
-						gdata += 2;
-						// Mark next component
-						flags = c->flags & MUTT_MORE_COMPONENTS;
-						// Mark instructions flag
-						if (c->flags & MUTT_WE_HAVE_INSTRUCTIONS) {
-							instructions = MU_TRUE;
-						}
+					// Loop through each horizontal strip from bottom to top
+					for (uint32_m h = 0; h < bitmap->height; ++h) {
+						uint64_m hpix_offset = bitmap->stride*((bitmap->height-h)-1);
+						float ray_y = ((float)h) + .5f;
 
-						// Read glyphIndex
-						c->glyph_index = MU_RBEU16(gdata);
-						gdata += 2;
-						// Verify index range
-						if (c->glyph_index >= font->maxp->num_glyphs) {
-							return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
+						// Gather segments within range of row
+						uint32_m num_near = 0;
+						for (uint32_m s = 0; s < num_segs; ++s) {
+							if (ray_y >= segs[s].y_min-max_dist && ray_y <= segs[s].y_max+max_dist) {
+								near[num_near++] = s;
+							}
 						}
 
-						// Arguments handling:
-						if (c->flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
-							// 2 bytes per argument
+						// Update active line list for the winding of each pixel
+						muttR_ActiveLines(shape, &list, ray_y);
+						uint32_m num_hits = list.num_hits;
+						int32_m winding = 0;
+						uint32_m ih = muttR_FirstHit(hits, num_hits);
 
-							// Verify length
-							req += 4;
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						for (uint32_m w = 0; w < bitmap->width; ++w) {
+							float ray_x = ((float)w) + .5f;
+
+							// Calculate winding for sign
+							while (ih < num_hits && ray_x > hits[ih].x) {
+								winding -= muttR_LineWinding(ray_y, &shape->lines[hits[ih++].l]);
 							}
+							float sign = (winding == 0) ?(-1.f) :(1.f);
+
+							// Find closest segment overall, and per channel
+							muttR_Distance best, cbest[3];
+							best.dist = max_dist;
+							best.dot = 1.f;
+							best.sd = best.pseudo = max_dist;
+							cbest[0] = cbest[1] = cbest[2] = best;
+							muBool cfound[3] = { MU_FALSE, MU_FALSE, MU_FALSE };
+
+							for (uint32_m n = 0; n < num_near; ++n) {
+								muttR_Segment* seg = &segs[near[n]];
+								// Skip segments whose bounding box is further than what's been found
+								float bx = (ray_x < seg->x_min) ?(seg->x_min-ray_x) :((ray_x > seg->x_max) ?(ray_x-seg->x_max) :(0.f));
+								float by = (ray_y < seg->y_min) ?(seg->y_min-ray_y) :((ray_y > seg->y_max) ?(ray_y-seg->y_max) :(0.f));
+								float bound = best.dist;
+								if (multi) {
+									for (uint8_m c = 0; c < 3; ++c) {
+										if ((seg->color & (1 << c)) && cbest[c].dist > bound) {
+											bound = cbest[c].dist;
+										}
+									}
+								}
+								if ((bx*bx) + (by*by) > bound*bound) {
+									continue;
+								}
 
-							// Read values
-							if (c->flags & MUTT_ARGS_ARE_XY_VALUES) {
-								// int16 xy values
-								c->argument1 = MU_RBES16(gdata);
-								gdata += 2;
-								c->argument2 = MU_RBES16(gdata);
-								gdata += 2;
-							} else {
-								// uint16 point numbers
-								c->argument1 = MU_RBEU16(gdata);
-								gdata += 2;
-								c->argument2 = MU_RBEU16(gdata);
-								gdata += 2;
+								muttR_Distance d;
+								muttR_SegmentDistance(seg, ray_x, ray_y, &d);
+								if (d.dist < best.dist) {
+									best = d;
+								}
+								if (multi) {
+									for (uint8_m c = 0; c < 3; ++c) {
+										if ((seg->color & (1 << c)) && (!cfound[c] || muttR_DistanceCloser(&d, &cbest[c]))) {
+											cbest[c] = d;
+											cfound[c] = MU_TRUE;
+										}
+									}
+								}
 							}
-						} else {
-							// 1 byte per argument
 
-							// Verify length
-							req += 2;
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+							// Single-channel: true distance, signed by winding
+							float v = .5f + (sign * best.dist * scale);
+							row[w] = (v < 0.f) ?(0.f) :((v > 1.f) ?(1.f) :(v));
+							if (!multi || adv == 1) {
+								continue;
 							}
 
-							// Read values
-							if (c->flags & MUTT_ARGS_ARE_XY_VALUES) {
-								// int8 xy values
-								c->argument1 = MU_RBES8(gdata++);
-								c->argument2 = MU_RBES8(gdata++);
-							} else {
-								// uint8 point numbers
-								c->argument1 = *gdata++;
-								c->argument2 = *gdata++;
+							// Multi-channel: pseudo-distance of the closest segment per channel
+							uint8_m* pixel = &bitmap->pixels[hpix_offset + (w*adv)];
+							for (uint8_m c = 0; c < 3; ++c) {
+								float cv = (cfound[c]) ?(.5f + (cbest[c].pseudo * scale)) :(row[w]);
+								cv = (cv < 0.f) ?(0.f) :((cv > 1.f) ?(1.f) :(cv));
+								pixel[c] = (uint8_m)((cv * (in-out)) + out + .5f);
+							}
+							// (Alpha holds the single-channel distance)
+							if (adv == 4) {
+								pixel[3] = (uint8_m)((row[w] * (in-out)) + out + .5f);
 							}
 						}
 
-						// Transform data handling
-						if (c->flags & MUTT_WE_HAVE_A_SCALE) {
-							// One F2DOT14
+						// Convert single-channel values to pixels
+						if (!multi || adv == 1) {
+							muttR_RowPixels(row, &bitmap->pixels[hpix_offset], bitmap->width, adv, in-out, out+.5f);
+						}
+					}
+				}
 
-							// Ensure flag exclusivity
-							if ((c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) || (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
-								return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
-							}
+			/* Rasterization */
 
-							// Verify length
-							req += 2;
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-							}
+				// Converts channels to advance
+				uint8_m muttR_ChannelsAdv(muttRChannels channels) {
+					switch (channels) {
+						default: return 1; break;
+						case MUTTR_R: return 1; break;
+						case MUTTR_RGB: return 3; break;
+						case MUTTR_RGBA: return 4; break;
+					}
+				}
 
-							// Read
-							c->scales[0] = MUTT_F2DOT14(gdata);
-							gdata += 2;
-						}
-						else if (c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-							// Two F2DOT14s
+				// Gets the Bezier tolerance given by raster info
+				static inline float muttR_InfoTolerance(muttRInfo* info) {
+					if (!info || !(info->tolerance > 0.f)) {
+						return MUTTR_DEFAULT_TOLERANCE;
+					}
+					return info->tolerance;
+				}
 
-							// Ensure flag exclusivity
-							if ((c->flags & MUTT_WE_HAVE_A_SCALE) || (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
-								return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
-							}
+				// Checks if a method is known
+				static inline muBool muttR_MethodKnown(muttRMethod method) {
+					switch (method) {
+						default: return MU_FALSE; break;
+						case MUTTR_FULL_PIXEL_BI_LEVEL: case MUTTR_FULL_PIXEL_AA2X2: case MUTTR_FULL_PIXEL_AA4X4: case MUTTR_FULL_PIXEL_AA8X8: case MUTTR_FULL_PIXEL_AREA:
+						case MUTTR_SDF: case MUTTR_MSDF:
+						case MUTTR_LCD_RGB: case MUTTR_LCD_BGR:
+							return MU_TRUE; break;
+					}
+				}
 
-							// Verify length
-							req += 4;
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-							}
+				// Gets whether or not raster info asks for fixed-point rasterization for a method
+				// (Methods without a fixed-point version just use float)
+				static inline muBool muttR_InfoFixed(muttRInfo* info, muttRMethod method) {
+					if (!info || !info->fixed) {
+						return MU_FALSE;
+					}
+					return method <= MUTTR_FULL_PIXEL_AREA;
+				}
+
+				// Calculates the memory needed for a fixed-point method (besides lines)
+				static inline size_m muttR_FixedMethodMemory(muttRMethod method, uint32_m num_lines, muttRBitmap* bitmap) {
+					switch (method) {
+						default: return 0; break;
+						case MUTTR_FULL_PIXEL_BI_LEVEL: return muttR_FixedBiLevelMemory(num_lines); break;
+						case MUTTR_FULL_PIXEL_AA2X2: return muttR_FixedAANXNMemory(num_lines, bitmap, 2); break;
+						case MUTTR_FULL_PIXEL_AA4X4: return muttR_FixedAANXNMemory(num_lines, bitmap, 4); break;
+						case MUTTR_FULL_PIXEL_AA8X8: return muttR_FixedAANXNMemory(num_lines, bitmap, 8); break;
+						case MUTTR_FULL_PIXEL_AREA: return muttR_FixedAreaMemory(bitmap); break;
+					}
+				}
+
+				// Calculates the memory needed for a method (besides lines)
+				// This can be 0 for a known method (bi-level with no lines), so unknown
+				// methods are checked with muttR_MethodKnown rather than by this
+				static inline size_m muttR_MethodMemory(muttRGlyph* glyph, muttRMethod method, uint32_m num_lines, muttRBitmap* bitmap, muBool fixed) {
+					if (fixed) {
+						return muttR_FixedMethodMemory(method, num_lines, bitmap);
+					}
+					switch (method) {
+						default: return 0; break;
+						case MUTTR_FULL_PIXEL_BI_LEVEL: return muttR_FullPixelBiLevelMemory(num_lines); break;
+						case MUTTR_FULL_PIXEL_AA2X2: return muttR_FullPixelAANXNMemory(num_lines, bitmap, 2); break;
+						case MUTTR_FULL_PIXEL_AA4X4: return muttR_FullPixelAANXNMemory(num_lines, bitmap, 4); break;
+						case MUTTR_FULL_PIXEL_AA8X8: return muttR_FullPixelAANXNMemory(num_lines, bitmap, 8); break;
+						case MUTTR_FULL_PIXEL_AREA: return muttR_FullPixelAreaMemory(bitmap); break;
+						case MUTTR_SDF: case MUTTR_MSDF: return muttR_SDFMemory(glyph, num_lines, bitmap); break;
+						case MUTTR_LCD_RGB: case MUTTR_LCD_BGR: return muttR_LCDMemory(bitmap); break;
+					}
+				}
+
+				// Calculates the total memory needed for rasterization
+				static inline size_m muttR_RasterMemory(muttRGlyph* glyph, muttRMethod method, uint32_m num_lines, muttRBitmap* bitmap, muBool fixed) {
+					size_m line_size = (fixed) ?(sizeof(muttR_FixedLine)) :(sizeof(muttR_Line));
+					return MUTTR_ALIGN_MEMORY(num_lines*line_size) + muttR_MethodMemory(glyph, method, num_lines, bitmap, fixed);
+				}
+
+				// Calculates the amount of lines needed for rasterization
+				static inline uint32_m muttR_RasterLines(muttRGlyph* glyph, float tolerance, muBool fixed) {
+					return (fixed) ?(muttR_GlyphFixedLines(glyph, 0, tolerance)) :(muttR_GlyphLines(glyph, 0, tolerance));
+				}
+
+				// Rasterizes a fixed-point shape based on method
+				void muttR_FixedRaster(muttR_FixedShape* shape, muttRMethod method, muttRBitmap* bitmap, muttRSpans* spans, uint8_m adv, uint8_m in, uint8_m out, muByte* mem) {
+					switch (method) {
+						default: break;
+						case MUTTR_FULL_PIXEL_BI_LEVEL: muttR_FixedBiLevel(shape, bitmap, spans, adv, in, out, mem); break;
+						case MUTTR_FULL_PIXEL_AA2X2: muttR_FixedAANXN(shape, bitmap, spans, adv, in, out, 2, 2, mem); break;
+						case MUTTR_FULL_PIXEL_AA4X4: muttR_FixedAANXN(shape, bitmap, spans, adv, in, out, 4, 4, mem); break;
+						case MUTTR_FULL_PIXEL_AA8X8: muttR_FixedAANXN(shape, bitmap, spans, adv, in, out, 8, 8, mem); break;
+						case MUTTR_FULL_PIXEL_AREA: muttR_FixedArea(shape, bitmap, spans, adv, in, out, mem); break;
+					}
+				}
+
+				// Rasterizes a glyph
+				MUDEF muttResult mutt_raster_glyph(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method) {
+					return mutt_raster_glyph_info(glyph, bitmap, method, 0);
+				}
+
+				// Rasterizes a glyph to bitmap, or to spans if spans is given
+				muttResult muttR_RasterGlyph(muttRGlyph* glyph, muttRBitmap* bitmap, muttRSpans* spans, muttRMethod method, muttRInfo* info) {
+					float tolerance = muttR_InfoTolerance(info);
+					muBool fixed = muttR_InfoFixed(info, method);
+
+					// Calculate memory needed
+					if (!muttR_MethodKnown(method)) {
+						return MUTT_UNKNOWN_RASTER_METHOD;
+					}
+					uint32_m num_lines = muttR_RasterLines(glyph, tolerance, fixed);
+					size_m mem_size = muttR_RasterMemory(glyph, method, num_lines, bitmap, fixed);
+
+					// Get memory from scratch, or temporary scratch if none was given
+					muttRScratch temp_scratch = MU_ZERO_STRUCT(muttRScratch);
+					muttRScratch* scratch = (info) ?(info->scratch) :(0);
+					if (!scratch) {
+						scratch = &temp_scratch;
+					}
+					muttResult res = mutt_rscratch_reserve(scratch, mem_size);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+					muByte* mem = scratch->data;
+
+					// Per-pixel advance based on channels:
+					uint8_m adv = muttR_ChannelsAdv(bitmap->channels);
+					// In/Out value based on io_color:
+					uint8_m in  = (bitmap->io_color == MUTTR_BW) ?(255) :(0);
+					uint8_m out = ~in;
+
+					// Convert rglyph to fixed-point shape and render it if requested
+					if (fixed) {
+						muttR_FixedShape fshape;
+						muttR_FixedShapeCreate(glyph, &fshape, tolerance, (muttR_FixedLine*)mem);
+						mem += MUTTR_ALIGN_MEMORY(num_lines*sizeof(muttR_FixedLine));
+						muttR_FixedRaster(&fshape, method, bitmap, spans, adv, in, out, mem);
+					}
+
+					// Otherwise, convert rglyph to shape and render it
+					else {
+						muttR_Shape shape;
+						muttR_ShapeCreate(glyph, &shape, tolerance, (muttR_Line*)mem);
+						mem += MUTTR_ALIGN_MEMORY(num_lines*sizeof(muttR_Line));
 
-							// Read
-							c->scales[0] = MUTT_F2DOT14(gdata);
-							gdata += 2;
-							c->scales[1] = MUTT_F2DOT14(gdata);
-							gdata += 2;
-						}
-						else if (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-							// Four F2DOT14s
+						// Render shape based on method
+						switch (method) {
+							// (Unrecognized methods are handled above)
+							default: break;
 
-							// Ensure flag exclusivity
-							if ((c->flags & MUTT_WE_HAVE_A_SCALE) || (c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE)) {
-								return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
-							}
+							// Full-pixel bi-level
+							case MUTTR_FULL_PIXEL_BI_LEVEL: {
+								muttR_FullPixelBiLevel(&shape, bitmap, spans, adv, in, out, mem);
+							} break;
 
-							// Verify length
-							req += 8;
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-							}
+							// Full-pixel AA 2x2
+							case MUTTR_FULL_PIXEL_AA2X2: {
+								muttR_FullPixelAANXN(&shape, bitmap, spans, adv, in, out, 2, 2, mem);
+							} break;
+							// Full-pixel AA 4x4
+							case MUTTR_FULL_PIXEL_AA4X4: {
+								muttR_FullPixelAANXN(&shape, bitmap, spans, adv, in, out, 4, 4, mem);
+							} break;
+							// Full-pixel AA 8x8
+							case MUTTR_FULL_PIXEL_AA8X8: {
+								muttR_FullPixelAANXN(&shape, bitmap, spans, adv, in, out, 8, 8, mem);
+							} break;
 
-							// Read
-							c->scales[0] = MUTT_F2DOT14(gdata);
-							gdata += 2;
-							c->scales[1] = MUTT_F2DOT14(gdata);
-							gdata += 2;
-							c->scales[2] = MUTT_F2DOT14(gdata);
-							gdata += 2;
-							c->scales[3] = MUTT_F2DOT14(gdata);
-							gdata += 2;
-						}
+							// Full-pixel area coverage
+							case MUTTR_FULL_PIXEL_AREA: {
+								muttR_FullPixelArea(&shape, bitmap, spans, adv, (float)in, (float)out, mem);
+							} break;
 
-						// Increment handle for component and component count
-						++c;
-						++component_count;
+							// Signed distance fields
+							case MUTTR_SDF: {
+								muttR_SDF(glyph, &shape, bitmap, adv, (float)in, (float)out, muttR_InfoSDFRange(info), MU_FALSE, mem);
+							} break;
+							case MUTTR_MSDF: {
+								muttR_SDF(glyph, &shape, bitmap, adv, (float)in, (float)out, muttR_InfoSDFRange(info), MU_TRUE, mem);
+							} break;
+
+							// LCD subpixel
+							case MUTTR_LCD_RGB: case MUTTR_LCD_BGR: {
+								float filter[5];
+								muttR_InfoLCDFilter(info, filter);
+								muttR_LCD(&shape, bitmap, adv, (float)in, (float)out, method == MUTTR_LCD_BGR, filter, mem);
+							} break;
+						}
 					}
-					// Verify component count
-					if (component_count > font->maxp->max_component_elements) {
-						return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
+
+					// Free temporary scratch and return
+					if (scratch == &temp_scratch) {
+						mutt_rscratch_free(scratch);
 					}
-					// Move past component array
-					data += sizeof(muttComponentGlyph) * component_count;
+					return res;
+				}
 
-					// Instruction handling
-					if (instructions) {
-						// Point to data
-						glyph->instructions = data;
+				// Rasterizes a glyph with raster info
+				MUDEF muttResult mutt_raster_glyph_info(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method, muttRInfo* info) {
+					return muttR_RasterGlyph(glyph, bitmap, 0, method, info);
+				}
 
-						// Verify length for instruction length
-						req += 2;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+				// Rasterizes a glyph to spans
+				MUDEF muttResult mutt_raster_glyph_spans(muttRGlyph* glyph, uint32_m width, uint32_m height, muttRMethod method, muttRInfo* info, muttRSpans* spans) {
+					// Only coverage methods can be output as spans
+					// (Unrecognized methods are handled by rasterization)
+					switch (method) {
+						default: break;
+						case MUTTR_SDF: case MUTTR_MSDF: case MUTTR_LCD_RGB: case MUTTR_LCD_BGR:
+							return MUTT_UNSUPPORTED_SPAN_METHOD; break;
+					}
+
+					// Single-channel bitmap with no pixels, giving dimensions
+					muttRBitmap bitmap;
+					bitmap.width = width;
+					bitmap.height = height;
+					bitmap.channels = MUTTR_R;
+					bitmap.stride = width;
+					bitmap.pixels = 0;
+					bitmap.io_color = MUTTR_BW;
+
+					// Rasterize, and indicate if not all spans fit in the buffer
+					spans->count = 0;
+					muttResult res = muttR_RasterGlyph(glyph, &bitmap, spans, method, info);
+					if (res == MUTT_SUCCESS && !spans->callback && spans->count > spans->capacity) {
+						return MUTT_RASTER_SPANS_FULL;
+					}
+					return res;
+				}
 
-						// Read instruction length
-						glyph->instruction_length = MU_RBEU16(gdata);
-						gdata += 2;
-						// Verify with maxp
-						if (glyph->instruction_length > font->maxp->max_size_of_instructions) {
-							return MUTT_INVALID_GLYF_COMPOSITE_INSTRUCTION_LENGTH;
-						}
+				// Calculates the scratch memory needed to rasterize a glyph
+				MUDEF size_m mutt_raster_glyph_scratch(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method, muttRInfo* info) {
+					if (!muttR_MethodKnown(method)) {
+						return 0;
+					}
+					muBool fixed = muttR_InfoFixed(info, method);
+					uint32_m num_lines = muttR_RasterLines(glyph, muttR_InfoTolerance(info), fixed);
+					return muttR_RasterMemory(glyph, method, num_lines, bitmap, fixed);
+				}
 
-						if (glyph->instruction_length > 0) {
-							// Verify length for instructions
-							req += glyph->instruction_length;
-							if (header->length < req) {
-								return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-							}
+			/* Scratch */
 
-							// Memcpy instructions
-							mu_memcpy(glyph->instructions, gdata, glyph->instruction_length);
-							// Move data past instructions
-							data += glyph->instruction_length;
-						}
-					} else {
-						glyph->instruction_length = 0;
-						glyph->instructions = 0;
+				// Ensures scratch has at least size bytes
+				MUDEF muttResult mutt_rscratch_reserve(muttRScratch* scratch, size_m size) {
+					// Nothing to do if scratch is already large enough
+					if (scratch->size >= size) {
+						return MUTT_SUCCESS;
 					}
 
-					// Copy over component count
-					glyph->component_count = (uint16_m)component_count;
-					// Write data written
-					if (written) {
-						*written = data-orig_data;
+					// Reallocate; old contents don't need to be kept
+					if (scratch->data) {
+						mutt_Free(scratch->allocator, scratch->data);
+					}
+					scratch->data = (muByte*)mutt_Malloc(scratch->allocator, size);
+					if (!scratch->data) {
+						scratch->size = 0;
+						return MUTT_FAILED_MALLOC;
 					}
+					scratch->size = size;
 					return MUTT_SUCCESS;
 				}
 
-				// Gets a component of a composite glyph
-				// no_more is set to true when no more components exist
-				MUDEF muttResult mutt_composite_component(muttFont* font, muttGlyphHeader* header, muByte** prog, muttComponentGlyph* component, muBool* no_more) {
-					// Much of this code is very similar to the code in mutt_composite_glyph
+				// Frees scratch memory
+				MUDEF void mutt_rscratch_free(muttRScratch* scratch) {
+					if (scratch->data) {
+						mutt_Free(scratch->allocator, scratch->data);
+						scratch->data = 0;
+					}
+					scratch->size = 0;
+				}
 
-					// So-far component length:
-					uint32_m req = (*prog) - header->data;
+			/* Conversion */
 
-					// Verify length for flags and glyphIndex
-					req += 4;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+				// FUnits to pixel-units
+				MUDEF float mutt_funits_to_punits(muttFont* font, float funits, float point_size, float ppi) {
+					MUTT_LAZY_LOAD(font, MUTT_LOAD_HEAD)
+					return point_size * funits * ppi / (72.f * font->head->units_per_em);
+				}
+
+				// Gets the ascent/descent/lsb/advance-width of an rglyph for a glyph ID
+				MUDEF void mutt_rglyph_metrics(muttFont* font, muttGlyphHeader* header, uint16_m glyph_id, muttRGlyph* rglyph, float point_size, float ppi) {
+					mutt_rglyph_metrics_subpixel(font, header, glyph_id, rglyph, point_size, ppi, 0.f);
+				}
+
+				// Gets the ascent/descent/lsb/advance-width of an rglyph for a glyph ID with a subpixel y-offset
+				MUDEF void mutt_rglyph_metrics_subpixel(muttFont* font, muttGlyphHeader* header, uint16_m glyph_id, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_y) {
+					MUTT_LAZY_LOAD(font, MUTT_LAZY_METRICS)
+
+					// Offsets
+					float py = -mutt_funits_to_punits(font, header->y_min, point_size, ppi) + 1.f + subpixel_y;
+
+					// Ascender + Descender
+					rglyph->ascender  = py + mutt_funits_to_punits(font, font->hhea->ascender , point_size, ppi);
+					rglyph->descender = py + mutt_funits_to_punits(font, font->hhea->descender, point_size, ppi);
+
+					// Left-side bearing + Advance width
+					rglyph->lsb = mutt_funits_to_punits(font, font->hmtx->lsbs[glyph_id], point_size, ppi);
+					rglyph->advance_width = mutt_funits_to_punits(font, font->hmtx->advance_widths[glyph_id], point_size, ppi);
+				}
+
+				// Scales FUnit values to pixel units in place
+				// (Operations are in the same order as mutt_funits_to_punits to give the same results)
+				void muttR_ScaleFunits(float* values, uint32_m count, float point_size, float ppi, float denom) {
+					uint32_m i = 0;
+
+					#if defined(MUTT_SIMD_AVX2)
+					__m256 size8 = _mm256_set1_ps(point_size), ppi8 = _mm256_set1_ps(ppi), denom8 = _mm256_set1_ps(denom);
+					for (; i+8 <= count; i += 8) {
+						__m256 v = _mm256_mul_ps(_mm256_mul_ps(size8, _mm256_loadu_ps(values+i)), ppi8);
+						_mm256_storeu_ps(values+i, _mm256_div_ps(v, denom8));
 					}
+					#endif
 
-					// Read flags
-					component->flags = MU_RBEU16(*prog);
-					*prog += 2;
-					// Mark next component
-					if (!(component->flags & MUTT_MORE_COMPONENTS)) {
-						*no_more = MU_TRUE;
+					#if defined(MUTT_SIMD_SSE2)
+					__m128 size4 = _mm_set1_ps(point_size), ppi4 = _mm_set1_ps(ppi), denom4 = _mm_set1_ps(denom);
+					for (; i+4 <= count; i += 4) {
+						__m128 v = _mm_mul_ps(_mm_mul_ps(size4, _mm_loadu_ps(values+i)), ppi4);
+						_mm_storeu_ps(values+i, _mm_div_ps(v, denom4));
 					}
+					#elif defined(MUTT_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+					// (Vector division is only available on AArch64)
+					float32x4_t size4 = vdupq_n_f32(point_size), ppi4 = vdupq_n_f32(ppi), denom4 = vdupq_n_f32(denom);
+					for (; i+4 <= count; i += 4) {
+						float32x4_t v = vmulq_f32(vmulq_f32(size4, vld1q_f32(values+i)), ppi4);
+						vst1q_f32(values+i, vdivq_f32(v, denom4));
+					}
+					#endif
 
-					// Read glyphIndex
-					component->glyph_index = MU_RBEU16(*prog);
-					*prog += 2;
-					// Verify index range
-					if (component->glyph_index >= font->maxp->num_glyphs) {
-						return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
+					// Scalar for the remainder
+					for (; i < count; ++i) {
+						values[i] = point_size * values[i] * ppi / denom;
 					}
+				}
 
-					// Argument handling:
-					if (component->flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
-						// 2 bytes per arg.
-						req += 4;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+				// Gets the advance widths/lsbs of several glyph IDs
+				MUDEF void mutt_glyph_advances(muttFont* font, uint16_m* glyph_ids, uint32_m count, float point_size, float ppi, float* advances, float* lsbs) {
+					MUTT_LAZY_LOAD(font, MUTT_LAZY_METRICS)
+					float denom = 72.f * font->head->units_per_em;
 
-						// Read values
-						if (component->flags & MUTT_ARGS_ARE_XY_VALUES) {
-							// int16 xy values
-							component->argument1 = MU_RBES16(*prog);
-							*prog += 2;
-							component->argument2 = MU_RBES16(*prog);
-							*prog += 2;
-						} else {
-							// uint16 point numbers
-							component->argument1 = MU_RBEU16(*prog);
-							*prog += 2;
-							component->argument2 = MU_RBEU16(*prog);
-							*prog += 2;
-						}
+					// Advance widths
+					for (uint32_m i = 0; i < count; ++i) {
+						advances[i] = font->hmtx->advance_widths[glyph_ids[i]];
 					}
-					else {
-						// 1 byte per arg.
-						req += 2;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+					muttR_ScaleFunits(advances, count, point_size, ppi, denom);
 
-						// Read values
-						if (component->flags & MUTT_ARGS_ARE_XY_VALUES) {
-							// int8 xy values
-							component->argument1 = MU_RBES8((*prog)++);
-							component->argument2 = MU_RBES8((*prog)++);
-						} else {
-							// uint8 point numbers
-							component->argument1 = MU_RBEU8((*prog)++);
-							component->argument2 = MU_RBEU8((*prog)++);
+					// Left-side bearings
+					if (lsbs) {
+						for (uint32_m i = 0; i < count; ++i) {
+							lsbs[i] = font->hmtx->lsbs[glyph_ids[i]];
 						}
+						muttR_ScaleFunits(lsbs, count, point_size, ppi, denom);
 					}
+				}
 
-					// Transform data handling
-					if (component->flags & MUTT_WE_HAVE_A_SCALE) {
-						// One F2DOT14
-						req += 2;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+				// Splits a position into a whole pixel and a quantized subpixel offset
+				MUDEF float mutt_subpixel_split(float position, uint8_m steps, int32_m* whole) {
+					if (steps == 0) {
+						steps = 1;
+					}
+					// Round to nearest step
+					int32_m q = (int32_m)mu_floorf((position * (float)steps) + .5f);
+					// Split into whole pixel and step within it (floor division)
+					int32_m w = q / (int32_m)steps;
+					if (q < 0 && w * (int32_m)steps != q) {
+						--w;
+					}
+					*whole = w;
+					return ((float)(q - (w * (int32_m)steps))) / ((float)steps);
+				}
 
-						// Flag exclusivity
-						if ((component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) || (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
-							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+				/* Outlines */
+
+					// Converts an rglyph whose points are in FUnits to pixel units
+					// bounds holds the x/y min/max of the outline in FUnits
+					void muttR_OutlinePunits(muttFont* font, muttRGlyph* rglyph, float* bounds, float point_size, float ppi, float subpixel_x, float subpixel_y) {
+						// Calculate point offsets based on glyph's min/max values
+						float px = -mutt_funits_to_punits(font, bounds[0], point_size, ppi) + 1.f + subpixel_x;
+						float py = -mutt_funits_to_punits(font, bounds[1], point_size, ppi) + 1.f + subpixel_y;
+
+						// Loop through each point
+						for (uint16_m p = 0; p < rglyph->num_points; ++p) {
+							// X and Y
+							rglyph->points[p].x = px + mutt_funits_to_punits(font, rglyph->points[p].x, point_size, ppi);
+							rglyph->points[p].y = py + mutt_funits_to_punits(font, rglyph->points[p].y, point_size, ppi);
 						}
 
-						// Read value
-						component->scales[0] = MUTT_F2DOT14(*prog);
-						*prog += 2;
+						// Calculate x/y max
+						rglyph->x_max = px + mutt_funits_to_punits(font, bounds[2], point_size, ppi);
+						rglyph->y_max = py + mutt_funits_to_punits(font, bounds[3], point_size, ppi);
 					}
-					else if (component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-						// Two F2DOT14s
-						req += 4;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
 
-						// Flag exclusivity
-						if ((component->flags & MUTT_WE_HAVE_A_SCALE) || (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
-							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+				/* Simple */
+
+					// Simple glyph -> raster glyph in FUnits
+					// Data must be the size calculated by mutt_simple_rglyph
+					void muttR_SimpleOutline(muttGlyphHeader* header, muttSimpleGlyph* glyph, muttRGlyph* rglyph, muByte* data, float* bounds) {
+						// Get data for arrays
+						// - points
+						rglyph->num_points = glyph->end_pts_of_contours[header->number_of_contours-1] + 1;
+						rglyph->points = (muttRPoint*)data;
+						data += sizeof(muttRPoint) * ((uint32_m)rglyph->num_points);
+						// - contour_ends
+						rglyph->num_contours = header->number_of_contours;
+						rglyph->contour_ends = (uint16_m*)data;
+
+						// Loop through each point
+						for (uint16_m p = 0; p < rglyph->num_points; ++p) {
+							// X and Y
+							rglyph->points[p].x = glyph->points[p].x;
+							rglyph->points[p].y = glyph->points[p].y;
+							// Flags
+							rglyph->points[p].flags = (glyph->points[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
 						}
 
-						// Read values
-						component->scales[0] = MUTT_F2DOT14(*prog);
-						*prog += 2;
-						component->scales[1] = MUTT_F2DOT14(*prog);
-						*prog += 2;
+						// Copy over contour ends
+						mu_memcpy(rglyph->contour_ends, glyph->end_pts_of_contours, sizeof(uint16_m) * ((uint32_m)rglyph->num_contours));
+
+						// x/y min/max are the header's
+						bounds[0] = header->x_min;
+						bounds[1] = header->y_min;
+						bounds[2] = header->x_max;
+						bounds[3] = header->y_max;
 					}
-					else if (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-						// Four F2DOT14s
-						req += 8;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+
+					// Simple glyph -> raster glyph
+					MUDEF muttResult mutt_simple_rglyph(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
+						return mutt_simple_rglyph_subpixel(font, header, glyph, rglyph, point_size, ppi, 0.f, 0.f, data, written);
+					}
+
+					// Simple glyph -> raster glyph with subpixel offset
+					MUDEF muttResult mutt_simple_rglyph_subpixel(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_x, float subpixel_y, muByte* data, uint32_m* written) {
+						// For written calculations:
+						if (!data) {
+							uint32_m write = 0;
+							// points
+							write += sizeof(muttRPoint) * (glyph->end_pts_of_contours[header->number_of_contours-1] + 1);
+							// contour_ends
+							write += sizeof(uint16_m) * header->number_of_contours;
+							// Write data needed
+							*written = write;
+							return MUTT_SUCCESS;
 						}
 
-						// Flag exclusivity
-						if ((component->flags & MUTT_WE_HAVE_A_SCALE) || (component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE)) {
-							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+						// Convert outline
+						float bounds[4];
+						muttR_SimpleOutline(header, glyph, rglyph, data, bounds);
+						// Write written data amount
+						if (written) {
+							*written = (sizeof(muttRPoint) * ((uint32_m)rglyph->num_points)) + (sizeof(uint16_m) * ((uint32_m)rglyph->num_contours));
 						}
 
-						// Read values
-						component->scales[0] = MUTT_F2DOT14(*prog);
-						*prog += 2;
-						component->scales[1] = MUTT_F2DOT14(*prog);
-						*prog += 2;
-						component->scales[2] = MUTT_F2DOT14(*prog);
-						*prog += 2;
-						component->scales[3] = MUTT_F2DOT14(*prog);
-						*prog += 2;
+						// Convert to pixel units
+						muttR_OutlinePunits(font, rglyph, bounds, point_size, ppi, subpixel_x, subpixel_y);
+						return MUTT_SUCCESS;
 					}
 
-					return MUTT_SUCCESS;
-				}
-
-				// Gets the glyph index component by component within a composite glyph
-				// no_more is set to true when no more components exist
-				// ^ There will always be at least one component from what I'm aware
-				MUDEF muttResult mutt_composite_component_glyph(muttFont* font, muttGlyphHeader* header, muByte** prog, uint16_m* glyph_index, muBool* no_more) {
-					// prog is always at the beginning of a component record
-
-					// Ensure length for flags + glyphIndex
-					if (((*prog+4)-header->data) > header->length) {
-						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					// Memory maximum
+					MUDEF uint32_m mutt_simple_rglyph_max(muttFont* font) {
+						MUTT_LAZY_LOAD(font, MUTT_LOAD_MAXP)
+						return
+							// points
+							(sizeof(muttRPoint) * font->maxp->max_points)
+							// contour_ends
+							+ (sizeof(uint16_m) * font->maxp->max_contours)
+						;
 					}
 
-					// Read flags to see if there's any more after this
-					uint16_m flags = MU_RBEU16(*prog);
-					*prog += 2;
-					if (!(flags & MUTT_MORE_COMPONENTS)) {
-						*no_more = MU_TRUE;
-					}
-					// Read glyphIndex
-					uint16_m read_glyph_index = MU_RBEU16(*prog);
-					*prog += 2;
-					if (read_glyph_index >= font->maxp->num_glyphs) {
-						return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
-					}
+				/* Composite */
 
-					// Increment prog past argument1 and argument2
-					if (flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
-						*prog += 4;
-					} else {
-						*prog += 2;
-					}
+					// Used to pass data between function calls within composite glyph processing
+					struct muttR_CompProg {
+						// Progressives (move up between rglyphs):
+						uint32_m num_contours;
+						uint32_m num_points;
+						uint16_m* contour_ends;
+						muttRPoint* points;
+						float x_min;
+						float y_min;
+						float x_max;
+						float y_max;
+						// Actual rglyph being filled in:
+						muttRGlyph* rglyph;
+						// Temp simple glyph mem:
+						muByte* temp_simple_max;
+						// Max values:
+						uint16_m max_contours;
+						uint16_m max_points;
+					};
+					typedef struct muttR_CompProg muttR_CompProg;
 
-					// Increment prog past transform data
-					// (Not checking for flag exclusivity)
-					if (flags & MUTT_WE_HAVE_A_SCALE) {
-						*prog += 2;
-					} else if (flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-						*prog += 4;
-					} else if (flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-						*prog += 8;
+					// Initializes a CompProg struct
+					void muttR_CompProg_init(muttR_CompProg* prog, muttRGlyph* rglyph, muByte* temp_simple_max, muttFont* font) {
+						// Set numerical progressives to 0
+						prog->num_contours = 0;
+						prog->num_points = 0;
+						prog->x_min = 0.f;
+						prog->y_min = 0.f;
+						prog->x_max = 0.f;
+						prog->y_max = 0.f;
+						// Set initial progressive pointers
+						prog->contour_ends = rglyph->contour_ends;
+						prog->points = rglyph->points;
+						// Rglyph
+						prog->rglyph = rglyph;
+						rglyph->num_points = 0;
+						rglyph->num_contours = 0;
+						// Temp simple max
+						prog->temp_simple_max = temp_simple_max;
+						// Max values
+						prog->max_contours = font->maxp->max_composite_contours;
+						prog->max_points = font->maxp->max_composite_points;
 					}
 
-					// (Not checking for length after argument1, argument2, and transform
-					// since we're not reading data from there)
+					// Converts simple glyph component to rglyph within the CompProg
+					// Glyph must have at least 1 contour
+					// This process gives the raw TrueType coordinates in float form;
+					// point and PPI are accounted for afterwards to separate that
+					// logic from the point alignment and such.
+					muttResult mutt_composite_simple_rglyph(muttR_CompProg* prog, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttComponentGlyph* comp) {
+						// Account for number of contours
+						prog->num_contours += header->number_of_contours;
+						if (prog->num_contours > prog->max_contours) {
+							return MUTT_INVALID_RGLYPH_COMPOSITE_CONTOUR_COUNT;
+						}
+						// Account for number of points
+						prog->num_points += glyph->end_pts_of_contours[header->number_of_contours-1]+1;
+						if (prog->num_points > prog->max_points) {
+							return MUTT_INVALID_RGLYPH_COMPOSITE_POINT_COUNT;
+						}
+						uint16_m num_points = glyph->end_pts_of_contours[header->number_of_contours-1]+1;
 
-					// Write gylphIndex and give success
-					*glyph_index = read_glyph_index;
-					return MUTT_SUCCESS;
-				}
+						// Calculate scales
+						float xscale=1.f, scale01=0.f, scale10=0.f, yscale=1.f;
 
-				// Composite glyph memory maximum
-				MUDEF uint32_m mutt_composite_glyph_max_size(muttFont* font) {
-					return
-						// components
-						(font->maxp->max_component_elements*sizeof(muttComponentGlyph))
-						// instructions
-						+(font->maxp->max_size_of_instructions)
-					;
-				}
+						if (comp->flags & MUTT_WE_HAVE_A_SCALE) {
+							// One scale applied to x and y
+							xscale = yscale = comp->scales[0];
+						}
+						else if (comp->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+							// Individual x and y scale
+							xscale = comp->scales[0];
+							yscale = comp->scales[1];
+						}
+						else if (comp->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+							// Full 2x2 affine transformation
+							xscale  = comp->scales[0];
+							scale01 = comp->scales[1];
+							scale10 = comp->scales[2];
+							yscale  = comp->scales[3];
+						}
 
-				// Glyph memory maximum
-				MUDEF uint32_m mutt_glyph_max_size(muttFont* font) {
-					// Simple:
-					uint32_m s = mutt_simple_glyph_max_size(font);
-					// Composite:
-					uint32_m c = mutt_composite_glyph_max_size(font);
-					// Return greatest
-					return (s>c) ?(s) :(c);
-				}
 
-			/* Misc. */
+						// Calculate argument1 & argument2 offsets
+						float argument1, argument2;
+						if (comp->flags & MUTT_ARGS_ARE_XY_VALUES) {
+							// Just read the offsets
+							argument1 = comp->argument1;
+							argument2 = comp->argument2;
+							// Possible scaling:
+							if (comp->flags & MUTT_SCALED_COMPONENT_OFFSET) {
+								float n_argument1 = (xscale  * argument1) + (scale10 * argument2);
+								float n_argument2 = (scale01 * argument1) + (yscale  * argument2);
+								argument1 = n_argument1;
+								argument2 = n_argument2;
+								// Possible rounding:
+								if (comp->flags & MUTT_ROUND_XY_TO_GRID) {
+									argument1 = mu_roundf(argument1);
+									argument2 = mu_roundf(argument2);
+								}
+							}
+						}
+						else {
+							// argument1 is parent (prog->rglyph) point number
+							// argument2 is child (glyph) point number
+							// Offset should align these two points
 
-				// Performs idDelta logic
-				MUDEF uint16_m mutt_id_delta(uint16_m character_code, int16_m delta) {
-					// Just return if idDelta is 0
-					if (delta == 0) {
-						return character_code;
-					}
+							// NOTE: phantom points can be used in this process, but
+							// mutt v1.0.0 doesn't have support for gvar (which, as
+							// far as I can tell, is needed to process the phantom
+							// points); composite glyphs that depend on phantom
+							// points will, for now, render incorrectly or possibly
+							// not render successfully at all.
 
-					// Do modulo 65536 on a larger type to add without overflow
-					int32_m big_id = (int32_m)(character_code + delta) % 65536;
-					// Prevent negative cases by adding 65536 for cases under 0
-					if (big_id < 0) {
-						big_id += 65536;
-					}
-					// Return that but now u16, which (I think) big_id is guaranteed to fit in
-					return (uint16_m)big_id;
-				}
+							// - Parent point -
+							// Ensure point number is in range
+							if (comp->argument1 >= prog->rglyph->num_points) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1;
+							}
+							// Get parent x and y
+							float parent_x = prog->rglyph->points[comp->argument1].x;
+							float parent_y = prog->rglyph->points[comp->argument1].y;
 
-		/* Raster API */
+							// - Child point -
+							// Ensure point number is in range
+							if (comp->argument2 >= num_points) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2;
+							}
+							// Get child x and y
+							float t_child_x = glyph->points[comp->argument2].x;
+							float t_child_y = glyph->points[comp->argument2].y;
+							// Calculate it with scales applied so that point is still
+							// aligned with scales
+							float child_x = (xscale  * t_child_x) + (scale10 * t_child_y);
+							float child_y = (scale01 * t_child_x) + (yscale  * t_child_y);
 
-			/* Math */
+							// Calcaulte argument1 & argument2 to be offsets that align
+							// the child point to the parent point
+							argument1 = parent_x - child_x;
+							argument2 = parent_y - child_y;
+						}
 
-				// Float epsilon macro used for countering floating point imprecision in line calculations
-				// This value is unabashedly stolen from stb_truetype, but it works real well
-				#define MUTTR_LINE_EPSILON32 (1.f/1024.f)
+						// Loop through each point
+						for (uint16_m p = 0; p < num_points; ++p) {
+							// Calculate scaled point
+							float point_x = glyph->points[p].x;
+							float point_y = glyph->points[p].y;
+							prog->points[p].x = (xscale  * point_x) + (scale10 * point_y);
+							prog->points[p].y = (scale01 * point_x) + (yscale  * point_y);
+							// Add offsets
+							prog->points[p].x += argument1;
+							prog->points[p].y += argument2;
+
+							// Flags of this point
+							prog->points[p].flags = (glyph->points[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
+						}
+						// Push progressive points pointer
+						prog->points += num_points;
 
-				// Double epsilon macro used for same purpose as MUTTR_LINE_EPSILON32; not used as of right now
-				// This value should be tested and vetted more thoroughly if it's going to be used
-				#define MUTTR_LINE_EPSILON64 0.00000001
+						// Loop through each contour end
+						for (uint16_m c = 0; c < header->number_of_contours; ++c) {
+							// Each contour end is the glyph-relative contour end
+							// with the offset of all the previous points
+							// I'm bad at explaining numbers
+							prog->contour_ends[c] = prog->rglyph->num_points + glyph->end_pts_of_contours[c];
+						}
+						// Push progressive contour ends pointer
+						prog->contour_ends += header->number_of_contours;
 
-				// Calculates IF a ray intersects a line
-				static inline muBool muttR_LineRay(float ry, float y0, float y1) {
-					// Any of these conditions must be true for intersection:
-					return
-						// Ray y is between y0 and y1 with forgiving epsilons:
-						(ry >= y0-MUTTR_LINE_EPSILON32 && ry <= y1+MUTTR_LINE_EPSILON32) ||
-						(ry >= y1-MUTTR_LINE_EPSILON32 && ry <= y0+MUTTR_LINE_EPSILON32)
-						// Line is horizontal:
-						|| (y1-y0 == 0.f)
-					;
-				}
+						// Add to rglyph
+						prog->rglyph->num_points += num_points;
+						prog->rglyph->num_contours += header->number_of_contours;
+						return MUTT_SUCCESS;
+					}
 
-				// Calculates the x-value intersection of a ray and a line
-				static inline float muttR_LineRayHit(float ry, float x0, float y0, float x1, float y1) {
-					// (https://math.stackexchange.com/a/2297532)
-					return x0 + (
-						((ry-y0) * (x1-x0))
-						/
-						(y1-y0)
-					);
-				}
+					// Processes composite component for CompProg
+					muttResult mutt_component_rglyph(muttFont* font, muttR_CompProg* prog, muttComponentGlyph* comp, uint32_m depth) {
+						muttResult res = MUTT_SUCCESS;
 
-				// Calculates the x- and y-value of a point on a Bezier curve (on, off, on) given t.
-				static inline void muttR_Bezier(float t,
-					float x0, float y0, float x1, float y1, float x2, float y2,
-					float* x, float* y
-				) {
-					// I think this can be optimized, but idk...
-					*x = ((1.f-t)*(1.f-t)*x0) + (2.f*(1.f-t)*t*x1) + (t*t*x2);
-					*y = ((1.f-t)*(1.f-t)*y0) + (2.f*(1.f-t)*t*y1) + (t*t*y2);
-				}
+						// Store point stuff BEFORE all points for this component are processed
+						uint16_m prev_num_points = prog->num_points;
+						muttRPoint* prev_points = prog->points;
 
-			/* Raster shape setup */
+						// Get header of glyph index
+						muttGlyphHeader header;
+						res = mutt_glyph_header(font, comp->glyph_index, &header);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
 
-				/* Definitions */
+						// Simple glyph with contours:
+						if (header.number_of_contours > 0) {
+							// Get simple glyph
+							muttSimpleGlyph glyph;
+							res = mutt_simple_glyph(font, &header, &glyph, prog->temp_simple_max, 0);
+							if (mutt_result_is_fatal(res)) {
+								return res;
+							}
 
-					// A raster shape is made up of lines, a line is defined by two points
-					struct muttR_Line {
-						// 0 is bottom, 1 is top (y0 <= y1)
-						float x0;
-						float y0;
-						float x1;
-						float y1;
-						// vec = y1-y0 (for direction)
-						float vec;
-					};
-					typedef struct muttR_Line muttR_Line;
+							// Process simple glyph
+							res = mutt_composite_simple_rglyph(prog, &header, &glyph, comp);
+							if (mutt_result_is_fatal(res)) {
+								return res;
+							}
 
-					// Used to sort the lines in increasing order of bottom point
-					int muttR_CompareLines(const void* p, const void* q) {
-						// Get lines
-						muttR_Line* l0 = (muttR_Line*)p, * l1 = (muttR_Line*)q;
-						// Return value to indicate greatest y1 value
-						if (l0->y0 < l1->y0) {
-							return -1;
-						} else if (l0->y0 > l1->y0) {
-							return 1;
+							return res;
 						}
-						return 0;
-					}
 
-					// Calculates the winding for a given line
-					static inline int8_m muttR_LineWinding(float ry, muttR_Line* line) {
-						// Don't consider winding if we're directly intersecting the high point of line
-						if (mu_fabsf(ry - line->y0) <= MUTTR_LINE_EPSILON32) {
-							return 0;
+						// Simple glyph with no contours:
+						else if (header.number_of_contours == 0) {
+							// Do nothing for this guy
+							return res;
 						}
 
-						// Return winding order based on vector; down is +1, up is -1, neither is 0
-						if (line->vec < 0.f) {
-							return 1;
-						} else if (line->vec > 0.f) {
-							return -1;
+						// Composite glyph
+						else {
+							// Increment depth tracker
+							if (++depth > font->maxp->max_component_depth) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_DEPTH;
+							}
+
+							// Loop through each component
+							uint32_m component_count = 0;
+							muBool no_more = MU_FALSE;
+							muByte* bprog = header.data;
+							while (!no_more) {
+								// Verify incremented component count
+								if (++component_count > font->maxp->max_component_elements) {
+									return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT;
+								}
+
+								// Get individual component
+								muttComponentGlyph this_component;
+								res = mutt_composite_component(font, &header, &bprog, &this_component, &no_more);
+								if (mutt_result_is_fatal(res)) {
+									return res;
+								}
+								// Process component with this current function
+								// (Scary recursion)
+								res = mutt_component_rglyph(font, prog, &this_component, depth);
+								if (mutt_result_is_fatal(res)) {
+									return res;
+								}
+							}
 						}
-						return 0;
-					}
 
-					// A raster shape is just a collection of lines representing a glyph
-					struct muttR_Shape {
-						uint32_m num_lines;
-						muttR_Line* lines;
-						float x_max;
-						float y_max;
-					};
-					typedef struct muttR_Shape muttR_Shape;
+						// This code is considerably similar to mutt_composite_simple_rglyph
 
-					// Sorts the lines of a shape in increasing order of bottom point
-					// This does nothing currently; not sorting because it's usually
-					// used for the active line list, but I failed to implement it
-					void muttR_ShapeSort(muttR_Shape* shape) {
-						// Just call qsort for the job
-						//mu_qsort(shape->lines, shape->num_lines, sizeof(muttR_Line), muttR_CompareLines);
-						return; if (shape) {}
-					}
+						// Calculate this component's values
+						uint16_m num_points = prog->num_points - prev_num_points;
 
-				/* Conversions */
+						// Calculate scales
+						float xscale=1.f, scale01=0.f, scale10=0.f, yscale=1.f;
 
-					// Converts two points to a line
-					void muttR_GlyphLine(muttR_Line* line, float x0, float y0, float x1, float y1) {
-						// Determine lowest y0 value
-						if (y0 < y1) {
-							line->x0 = x0;
-							line->y0 = y0;
-							line->x1 = x1;
-							line->y1 = y1;
+						if (comp->flags & MUTT_WE_HAVE_A_SCALE) {
+							// One scale applied to x and y
+							xscale = yscale = comp->scales[0];
 						}
-						else {
-							line->x0 = x1;
-							line->y0 = y1;
-							line->x1 = x0;
-							line->y1 = y0;
+						else if (comp->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+							// Individual x and y scale
+							xscale = comp->scales[0];
+							yscale = comp->scales[1];
+						}
+						else if (comp->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+							// Full 2x2 affine transformation
+							xscale  = comp->scales[0];
+							scale01 = comp->scales[1];
+							scale10 = comp->scales[2];
+							yscale  = comp->scales[3];
 						}
-						// Calculate vec
-						line->vec = y1-y0;
-					}
 
-					// Converts three-point Bezier (on, off, on) to lines
-					// - Constants:
-					#define MUTTR_LINES_PER_BEZIER 25
-					//#define MUTTR_LINES_PER_BEZIER 1
-					static const float MUTTR_LINES_PER_BEZIER_F = ((float)MUTTR_LINES_PER_BEZIER);
-					static const float MUTTR_LINES_PER_BEZIER_INV = 1.f / ((float)MUTTR_LINES_PER_BEZIER);
-					// - Function:
-					static inline void muttR_GlyphCurve(muttR_Line* line, float x0, float y0, float x1, float y1, float x2, float y2) {
-						// Loop through each line per Bezier
-						for (uint32_m l = 0; l < MUTTR_LINES_PER_BEZIER; ++l) {
-							// Calculate Bezier for the first point
-							float t = ((float)l) / MUTTR_LINES_PER_BEZIER_F;
-							float bx0, by0;
-							muttR_Bezier(t, x0, y0, x1, y1, x2, y2, &bx0, &by0);
-							
-							// + Second point
-							float bx1, by1;
-							muttR_Bezier(t+MUTTR_LINES_PER_BEZIER_INV, x0, y0, x1, y1, x2, y2, &bx1, &by1);
+						// Calculate argument1 and argument2 offsets
+						float argument1, argument2;
+						if (comp->flags & MUTT_ARGS_ARE_XY_VALUES) {
+							// Just read the offsets
+							argument1 = comp->argument1;
+							argument2 = comp->argument2;
+							// Possible scaling:
+							if (comp->flags & MUTT_SCALED_COMPONENT_OFFSET) {
+								float n_argument1 = (xscale  * argument1) + (scale10 * argument2);
+								float n_argument2 = (scale01 * argument1) + (yscale  * argument2);
+								argument1 = n_argument1;
+								argument2 = n_argument2;
+								// Possible rounding:
+								if (comp->flags & MUTT_ROUND_XY_TO_GRID) {
+									argument1 = mu_roundf(argument1);
+									argument2 = mu_roundf(argument2);
+								}
+							}
+						}
+						else {
+							// argument1 is parent (rglyph->points, prev_num_points)
+							// argument2 is child (prev_points, num_points)
 
-							// Make line based on this strip of the Bezier
-							muttR_GlyphLine(line++, bx0, by0, bx1, by1);
+							// - Parent point -
+							// Ensure point range
+							if (comp->argument1 >= prev_num_points) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1;
+							}
+							// Get parent x and y
+							float parent_x = prog->rglyph->points[comp->argument1].x;
+							float parent_y = prog->rglyph->points[comp->argument1].y;
+
+							// - Child point -
+							// Ensure point range
+							if (comp->argument2 >= num_points) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2;
+							}
+							// Get child x and y
+							float t_child_x = prev_points[comp->argument2].x;
+							float t_child_y = prev_points[comp->argument2].y;
+							// Calculate it with scales applied so that point is still
+							// aligned with scales
+							float child_x = (xscale  * t_child_x) + (scale10 * t_child_y);
+							float child_y = (scale01 * t_child_x) + (yscale  * t_child_y);
+
+							// Calculate argument1 & argument2 to be offsets that align
+							// the child point to the parent point
+							argument1 = parent_x - child_x;
+							argument2 = parent_y - child_y;
+						}
+
+						// Loop through each point
+						for (uint16_m p = 0; p < num_points; ++p) {
+							// Calculate scaled point
+							float point_x = prev_points[p].x;
+							float point_y = prev_points[p].y;
+							prev_points[p].x = (xscale  * point_x) + (scale10 * point_y);
+							prev_points[p].y = (scale01 * point_x) + (yscale  * point_y);
+							// Add offsets
+							prev_points[p].x += argument1;
+							prev_points[p].y += argument2;
 						}
+
+						return res;
 					}
 
-					// Gets the next point of a glyph based on the contour ends
-					static inline muttRPoint* muttR_GlyphNextPoint(muttRGlyph* glyph, uint32_m p, uint32_m i, uint32_m c) {
-						// The next point is p incremented
-						muttRPoint* pn = &glyph->points[p+i];
-						// ...unless this goes over the contour's end...
-						if (p+i > glyph->contour_ends[c]) {
-							// ..in which case the next point wraps back around to the first
-							// point of the contour
-							pn -= glyph->contour_ends[c]+1;
-							if (c > 0) {
-								pn += glyph->contour_ends[c-1]+1;
+					// Calculates the x/y min/max within prog of the TrueType-calculated coordinates
+					// from a composite-converted rglyph
+					muttResult mutt_composite_rglyph_coords(muttR_CompProg* prog, muttRGlyph* rglyph) {
+						// Calculate x/y min/max values
+						prog->x_min = prog->x_max = rglyph->points[0].x;
+						prog->y_min = prog->y_max = rglyph->points[0].y;
+						for (uint16_m p = 1; p < rglyph->num_points; ++p) {
+							// x min/max
+							if (rglyph->points[p].x < prog->x_min) {
+								prog->x_min = rglyph->points[p].x;
+							}
+							if (rglyph->points[p].x > prog->x_max) {
+								prog->x_max = rglyph->points[p].x;
+							}
+							// y min/max
+							if (rglyph->points[p].y < prog->y_min) {
+								prog->y_min = rglyph->points[p].y;
+							}
+							if (rglyph->points[p].y > prog->y_max) {
+								prog->y_max = rglyph->points[p].y;
 							}
 						}
-						return pn;
-					}
 
-					// Calculates the amount of lines needed to represent a glyph
-					uint32_m muttR_GlyphLineCount(muttRGlyph* glyph) {
-						// Keep count of lines:
-						uint32_m count = 0;
-						// Keep count of contours:
-						uint16_m c = 0;
+						// Ensure FUnit range
+						if (prog->x_min < -16384.f || prog->x_min > 16383.f ||
+							prog->x_max < -16384.f || prog->x_max > 16383.f) {
+							return MUTT_INVALID_GLYF_COMPOSITE_X_COORD_FUNITS;
+						}
+						if (prog->y_min < -16384.f || prog->y_min > 16383.f ||
+							prog->y_max < -16384.f || prog->y_max > 16383.f) {
+							return MUTT_INVALID_GLYF_COMPOSITE_Y_COORD_FUNITS;
+						}
 
-						// Loop through each point
-						for (uint32_m p = 0; p < glyph->num_points;) {
-							// Increment contour ID if necessary
-							if (p > glyph->contour_ends[c]) {
-								// Go to beginning of contour to avoid over-counting sometimes
-								p = glyph->contour_ends[c]+1;
-								++c;
-							}
+						return MUTT_SUCCESS;
+					}
 
-							// Get current point
-							muttRPoint* p0 = &glyph->points[p];
+					// Composite glyph -> raster glyph in FUnits
+					// Data must be the size of mutt_composite_rglyph_max
+					muttResult muttR_CompositeOutline(muttFont* font, muttCompositeGlyph* glyph, muttRGlyph* rglyph, muByte* data, float* bounds) {
+						muttResult res = MUTT_SUCCESS;
 
-							// If current point is ON curve (ON...):
-							if (p0->flags & MUTTR_ON_CURVE) {
-								// Get next point
-								muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
-								// If next point is ON curve (ON, ON):
-								if (p1->flags & MUTTR_ON_CURVE) {
-									// One more line, go to next point
-									++count;
-									++p;
-									continue;
-								}
+						// Allocate temp simple max memory
+						// This cannot be allocated within font, as it could lead to
+						// very unpredictable multi-threaded behavior
+						muByte* temp_simple_max = (muByte*)mutt_Malloc(font->allocator, mutt_simple_glyph_max_size(font));
+						if (!temp_simple_max) {
+							return MUTT_FAILED_MALLOC;
+						}
 
-								// If we're here, the next point is OFF curve (ON, OFF...)
-								// It must be a Bezier, and we must go forward two points
-								count += MUTTR_LINES_PER_BEZIER;
-								p += 2;
-								continue;
-							}
+						// Set rglyph data
+						rglyph->contour_ends = (uint16_m*)data;
+						rglyph->points = (muttRPoint*)((data + (((uint32_m)font->maxp->max_composite_contours)*2)));
 
-							// Get previous point
-							muttRPoint* pn1 = &glyph->points[p-1];
-							muttRPoint n1;
-							// Edge case for point being 0:
-							if (p == 0) {
-								// Wrap to end of this contour
-								pn1 = &n1;
-								n1.flags = glyph->points[glyph->contour_ends[0]].flags;
-							}
-							// Edge case for point being first point of this contour:
-							else if (c > 0 && (uint16_m)(glyph->contour_ends[c-1]+1) == p) {
-								// Wrap to end of this contour
-								pn1 = &n1;
-								n1.flags = glyph->points[glyph->contour_ends[c]].flags;
-							}
+						// Initialize CompProg
+						muttR_CompProg prog;
+						muttR_CompProg_init(&prog, rglyph, temp_simple_max, font);
 
-							// Skip is previous point is ON curve;
-							// this avoids duplicate lines from what I'm aware
-							if (pn1->flags & MUTTR_ON_CURVE) {
-								++p;
-								continue;
+						// Loop through each component
+						for (uint16_m c = 0; c < glyph->component_count; ++c) {
+							// Process component
+							res = mutt_component_rglyph(font, &prog, &glyph->components[c], 1);
+							if (mutt_result_is_fatal(res)) {
+								mutt_Free(font->allocator, temp_simple_max);
+								return res;
 							}
+						}
 
-							// If we're here, we started on an OFF point
-							// It must be a Bezier, and we must go forward one point
-							count += MUTTR_LINES_PER_BEZIER;
-							++p;
-							//continue;
+						// Calculate x/y min/max of collected TrueType coordinates
+						res = mutt_composite_rglyph_coords(&prog, rglyph);
+						if (mutt_result_is_fatal(res)) {
+							mutt_Free(font->allocator, temp_simple_max);
+							return res;
 						}
+						bounds[0] = prog.x_min;
+						bounds[1] = prog.y_min;
+						bounds[2] = prog.x_max;
+						bounds[3] = prog.y_max;
 
-						// Return final count
-						return count;
+						// Free temp simple max memory
+						mutt_Free(font->allocator, temp_simple_max);
+						return res;
 					}
 
-					// Converts an rglyph to a shape
-					muttResult muttR_ShapeCreate(muttRGlyph* glyph, muttR_Shape* shape) {
-						// Calculate number of lines needed
-						shape->num_lines = muttR_GlyphLineCount(glyph);
-						// Allocate lines
-						shape->lines = (muttR_Line*)mu_malloc(sizeof(muttR_Line)*shape->num_lines);
-						if (!shape->lines) {
-							return MUTT_FAILED_MALLOC;
+					// Composite glyph -> raster glyph
+					// NO mem req abilities unfortunately
+					MUDEF muttResult mutt_composite_rglyph(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data) {
+						return mutt_composite_rglyph_subpixel(font, header, glyph, rglyph, point_size, ppi, 0.f, 0.f, data);
+					}
+
+					// Composite glyph -> raster glyph with subpixel offset
+					MUDEF muttResult mutt_composite_rglyph_subpixel(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_x, float subpixel_y, muByte* data) {
+						// Get outline in FUnits
+						float bounds[4];
+						muttResult res = muttR_CompositeOutline(font, glyph, rglyph, data, bounds);
+						if (mutt_result_is_fatal(res)) {
+							return res;
 						}
 
-						// Loop through each point
-						uint32_m c = 0; // (contour tracker)
-						muttR_Line* l = shape->lines; // (shape tracker)
-						for (uint32_m p = 0; p < glyph->num_points;) {
-							// Increment contour ID if necessary
-							if (p > glyph->contour_ends[c]) {
-								// Go to beginning of contour to avoid over-counting sometimes
-								p = glyph->contour_ends[c]+1;
-								++c;
-							}
+						// Convert to pixel units
+						muttR_OutlinePunits(font, rglyph, bounds, point_size, ppi, subpixel_x, subpixel_y);
+						return res; if (header) {}
+					}
 
-							// Get current point
-							muttRPoint* p0 = &glyph->points[p];
+					// X/Y min/max composite calculator
+					MUDEF muttResult mutt_composite_glyph_min_max(muttFont* font, muttGlyphHeader* header) {
+						muttResult res = MUTT_SUCCESS;
 
-							// If current point is ON curve (ON...):
-							if (p0->flags & MUTTR_ON_CURVE) {
-								// Get next point
-								muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
-								// If next point is ON curve (ON, ON):
-								if (p1->flags & MUTTR_ON_CURVE) {
-									// Form line between two points and move on by one
-									muttR_GlyphLine(l++, p0->x, p0->y, p1->x, p1->y);
-									++p;
-									continue;
-								}
+						// Unfortunately, there's no realistic way to do this without
+						// doing the usual allocation as far as I'm aware.
 
-								// If we're here, the next point is OFF curve (ON, OFF...)
-								// Get next-next point
-								muttRPoint* p2 = muttR_GlyphNextPoint(glyph, p, 2, c);
-								// If next-next point is ON the curve (ON, OFF, ON):
-								if (p2->flags & MUTTR_ON_CURVE) {
-									// Form basic Bezier and move on
-									muttR_GlyphCurve(l, p0->x, p0->y, p1->x, p1->y, p2->x, p2->y);
-									l += MUTTR_LINES_PER_BEZIER;
-									p += 2;
-									continue;
-								}
+						// Much of this code is considerably similar to mutt_composite_rglyph
 
-								// If we're here, the next-next point is OFF the curve: (ON, OFF, OFF):
-								else {
-									// Bezier, with last point needing to be mid-pointed
-									muttR_GlyphCurve(l, p0->x, p0->y, p1->x, p1->y,
-										(p1->x + p2->x) / 2.f, (p1->y + p2->y) / 2.f
-									);
+						// Allocate composite memory
+						muByte* composite_mem = (muByte*)mutt_Malloc(font->allocator, mutt_composite_rglyph_max(font));
+						if (!composite_mem) {
+							return MUTT_FAILED_MALLOC;
+						}
+						// Allocate temp simple max memory
+						muByte* temp_simple_max = (muByte*)mutt_Malloc(font->allocator, mutt_simple_glyph_max_size(font));
+						if (!temp_simple_max) {
+							mutt_Free(font->allocator, composite_mem);
+							return MUTT_FAILED_MALLOC;
+						}
 
-									l += MUTTR_LINES_PER_BEZIER;
-									p += 2;
-									continue;
-								}
-							}
+						// Set rglyph data
+						muttRGlyph rglyph;
+						rglyph.contour_ends = (uint16_m*)composite_mem;
+						rglyph.points = (muttRPoint*)((composite_mem + (((uint32_m)font->maxp->max_composite_contours)*2)));
 
-							// If we're here, the current point is OFF curve (OFF...)
-							// Get previous point:
-							muttRPoint* pn1 = &glyph->points[p-1];
-							muttRPoint n1;
-							// Edge case for point being 0:
-							if (p == 0) {
-								// Wrap to last point of this contour
-								pn1 = &n1;
-								n1.x = glyph->points[glyph->contour_ends[0]].x;
-								n1.y = glyph->points[glyph->contour_ends[0]].y;
-								n1.flags = glyph->points[glyph->contour_ends[0]].flags;
-							}
-							// Edge case for point being first of contour:
-							else if (c > 0 && (uint16_m)(glyph->contour_ends[c-1]+1) == p) {
-								// Wrap to last point of this contour
-								pn1 = &n1;
-								n1.x = glyph->points[glyph->contour_ends[c]].x;
-								n1.y = glyph->points[glyph->contour_ends[c]].y;
-								n1.flags = glyph->points[glyph->contour_ends[c]].flags;
-							}
+						// Initialize CompProg
+						muttR_CompProg prog;
+						muttR_CompProg_init(&prog, &rglyph, temp_simple_max, font);
 
-							// Leave if previous point is ON;
-							// this avoids duplicate lines from what I'm aware
-							if (pn1->flags & MUTTR_ON_CURVE) {
-								++p;
-								continue;
+						// Loop through each component
+						uint32_m component_count = 0;
+						muBool no_more = MU_FALSE;
+						muByte* bprog = header->data;
+						while (!no_more) {
+							// Verify incremented component count
+							if (++component_count > font->maxp->max_component_elements) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT;
 							}
 
-							// Get next point:
-							muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
+							// Get individual component
+							muttComponentGlyph this_component;
+							res = mutt_composite_component(font, header, &bprog, &this_component, &no_more);
+							if (mutt_result_is_fatal(res)) {
+								mutt_Free(font->allocator, temp_simple_max);
+								mutt_Free(font->allocator, composite_mem);
+								return res;
+							}
 
-							// x0 and y0 must be midpointed between pn1 and p0 since
-							// both are OFF curve:
-							float x0 = (pn1->x + p0->x) / 2.f;
-							float y0 = (pn1->y + p0->y) / 2.f;
-							// x1 and y1 are just p0 since it's OFF curve:
-							float x1 = p0->x;
-							float y1 = p0->y;
-							// x2 and y2 are just p1:
-							float x2 = p1->x;
-							float y2 = p1->y;
-							// ...unless it's OFF curve, in which case it must be
-							// midpointed:
-							if (!(p1->flags & MUTTR_ON_CURVE)) {
-								x2 = (x1 + x2) / 2.f;
-								y2 = (y1 + y2) / 2.f;
+							// Process component
+							res = mutt_component_rglyph(font, &prog, &this_component, 1);
+							if (mutt_result_is_fatal(res)) {
+								mutt_Free(font->allocator, temp_simple_max);
+								mutt_Free(font->allocator, composite_mem);
+								return res;
 							}
+						}
 
-							// Bezier and move on:
-							muttR_GlyphCurve(l, x0, y0, x1, y1, x2, y2);
-							l += MUTTR_LINES_PER_BEZIER;
-							++p;
-							//continue;
+						// Calculate x/y min/max
+						res = mutt_composite_rglyph_coords(&prog, &rglyph);
+						if (mutt_result_is_fatal(res)) {
+							mutt_Free(font->allocator, temp_simple_max);
+							mutt_Free(font->allocator, composite_mem);
+							return res;
 						}
 
-						// Sort all lines
-						muttR_ShapeSort(shape);
-						// Set max x/y
-						shape->x_max = glyph->x_max;
-						shape->y_max = glyph->y_max;
+						// Set x/y min/max values
+						header->x_min = mu_ceilf(prog.x_min);
+						header->y_min = mu_ceilf(prog.y_min);
+						header->x_max = mu_ceilf(prog.x_max);
+						header->y_max = mu_ceilf(prog.y_max);
 
-						return MUTT_SUCCESS;
+						// Free and return
+						mutt_Free(font->allocator, temp_simple_max);
+						mutt_Free(font->allocator, composite_mem);
+						return res;
 					}
 
-					// Frees all memory used by a shape
-					void muttR_ShapeDestroy(muttR_Shape* shape) {
-						if (shape->lines) {
-							mu_free(shape->lines);
-						}
+					// Memory maximum
+					MUDEF uint32_m mutt_composite_rglyph_max(muttFont* font) {
+						MUTT_LAZY_LOAD(font, MUTT_LOAD_MAXP)
+						return
+							// contour_ends
+							(sizeof(uint16_m) * font->maxp->max_composite_contours)
+							// points
+							+ (sizeof(muttRPoint) * font->maxp->max_composite_points)
+						;
 					}
 
-			/* Intersection/Hit logic */
-
-				// A hit:
-				struct muttR_Hit {
-					// The x-value of the intersection
-					float x;
-					// The line which it intersected with
-					uint32_m l;
-				};
-				typedef struct muttR_Hit muttR_Hit;
+				/* Outline cache */
+
+					// A cached outline, followed in memory by its points and contour ends
+					typedef struct muttR_Outline muttR_Outline;
+					struct muttR_Outline {
+						// Neighbors in the least-recently-used list
+						muttR_Outline* prev;
+						muttR_Outline* next;
+						// What the outline was cached with
+						uint16_m glyph_id;
+						muByte* glyph_data;
+						// Memory taken up by the outline
+						uint32_m size;
+						// Conversion information
+						muttResult res;
+						uint32_m written;
+						float bounds[4];
+						uint16_m num_points;
+						uint16_m num_contours;
+					};
 
-				// Used to sort intersections in order of increasing x-value
-				int muttR_HitCompare(const void* p, const void* q) {
-					// Get hits
-					muttR_Hit* h0 = (muttR_Hit*)p, * h1 = (muttR_Hit*)q;
-					// Indicate which hit's x-value is greater
-					if (h0->x < h1->x) {
-						return -1;
-					} else if (h0->x > h1->x) {
-						return 1;
-					}
-					return 0;
-				}
+					struct muttOutlineCache {
+						muttLock lock;
+						// Outline for each glyph ID, or 0 if not cached
+						muttR_Outline** lookup;
+						uint16_m num_glyphs;
+						// Least-recently-used list; first is the most recently used
+						muttR_Outline* first;
+						muttR_Outline* last;
+						muttOutlineCacheStats stats;
+					};
 
-				// Updates the active line list based on the ray
-				// This function should totally work from what I'm aware, but it
-				// seems to not work properly. Don't know why
-				static inline void muttR_ActiveLines(muttR_Line* lines, uint32_m num_lines, uint32_m* first, uint32_m* len, float ry) {
-					// Increase length to include possible new in-range lines
-					while (*first + *len < num_lines) {
-						if (ry >= lines[*first + *len].y0 - MUTTR_LINE_EPSILON32) {
-							++*len;
+					// Removes an outline from the least-recently-used list
+					void muttR_OutlineUnlink(muttOutlineCache* cache, muttR_Outline* outline) {
+						if (outline->prev) {
+							outline->prev->next = outline->next;
 						} else {
-							break;
+							cache->first = outline->next;
+						}
+						if (outline->next) {
+							outline->next->prev = outline->prev;
+						} else {
+							cache->last = outline->prev;
 						}
 					}
 
-					// Move up the first active line until we're in range of the next nearest line
-					while (*len != 0) {
-						if (ry > lines[*first].y1 + MUTTR_LINE_EPSILON32) {
-							++*first;
-							--*len;
+					// Adds an outline to the front of the least-recently-used list
+					void muttR_OutlineLink(muttOutlineCache* cache, muttR_Outline* outline) {
+						outline->prev = 0;
+						outline->next = cache->first;
+						if (cache->first) {
+							cache->first->prev = outline;
 						} else {
-							break;
+							cache->last = outline;
 						}
+						cache->first = outline;
 					}
-				}
-
-				// Calculates all hits for a given ray and its active lines
-				// Returns amount of hits, and gives winding as well
-				static inline uint32_m muttR_Hits(muttR_Line* lines, uint32_m num_lines, float ry, muttR_Hit* hits, int32_m* winding) {
-					uint32_m num_hits = 0;
 
-					// Loop through each line
-					for (uint32_m l = 0; l < num_lines; ++l) {
-						// If ray intersects with line:
-						if (muttR_LineRay(ry, lines[l].y0, lines[l].y1)) {
-							// Add intersection values
-							float x = muttR_LineRayHit(ry, lines[l].x0, lines[l].y0, lines[l].x1, lines[l].y1);
-							// Add if intersection is valid
-							if (x >= 0.f) {
-								hits[num_hits  ].x = x;
-								hits[num_hits++].l = l;
-							}
-						}
+					// Frees an outline within the cache
+					void muttR_OutlineFree(muttFont* font, muttOutlineCache* cache, muttR_Outline* outline) {
+						muttR_OutlineUnlink(cache, outline);
+						cache->lookup[outline->glyph_id] = 0;
+						cache->stats.memory -= outline->size;
+						--cache->stats.entries;
+						mutt_Free(font->allocator, outline);
 					}
 
-					// Sort hits
-					mu_qsort(hits, num_hits, sizeof(muttR_Hit), muttR_HitCompare);
+					// Fills in an rglyph in FUnits from the cache
+					// Returns MU_FALSE if the glyph isn't cached
+					muBool muttR_OutlineGet(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, muByte* data, float* bounds, muttResult* res, uint32_m* written) {
+						muttOutlineCache* cache = font->outline_cache;
+						mutt_Lock(&cache->lock);
 
-					// Calculate total winding order
-					*winding = 0;
-					for (uint32_m hitw = 0; hitw < num_hits; ++hitw) {
-						winding += muttR_LineWinding(ry, &lines[hits[hitw].l]);
-					}
+						// Find outline
+						muttR_Outline* outline = 0;
+						if (header->glyph_id < cache->num_glyphs) {
+							outline = cache->lookup[header->glyph_id];
+						}
+						if (!outline || outline->glyph_data != header->data) {
+							++cache->stats.misses;
+							mutt_Unlock(&cache->lock);
+							return MU_FALSE;
+						}
+						++cache->stats.hits;
 
-					return num_hits;
-				}
+						// Move to front
+						muttR_OutlineUnlink(cache, outline);
+						muttR_OutlineLink(cache, outline);
 
-			/* Rasterization per method */
+						// Copy points and contour ends
+						muByte* odata = (muByte*)(outline+1);
+						rglyph->num_points = outline->num_points;
+						rglyph->points = (muttRPoint*)data;
+						mu_memcpy(rglyph->points, odata, sizeof(muttRPoint) * ((uint32_m)outline->num_points));
+						data += sizeof(muttRPoint) * ((uint32_m)outline->num_points);
+						odata += sizeof(muttRPoint) * ((uint32_m)outline->num_points);
+						rglyph->num_contours = outline->num_contours;
+						rglyph->contour_ends = (uint16_m*)data;
+						mu_memcpy(rglyph->contour_ends, odata, sizeof(uint16_m) * ((uint32_m)outline->num_contours));
 
-				// MUTTR_FULL_PIXEL_BI_LEVEL
-				muttResult muttR_FullPixelBiLevel(muttR_Shape* shape, muttRBitmap* bitmap, uint8_m adv, uint8_m in, uint8_m out) {
-					// Allocate hit tracker
-					muttR_Hit* hits = (muttR_Hit*)mu_malloc(shape->num_lines*sizeof(muttR_Hit));
-					if (!hits) {
-						return MUTT_FAILED_MALLOC;
+						// Copy conversion information
+						mu_memcpy(bounds, outline->bounds, sizeof(outline->bounds));
+						*res = outline->res;
+						*written = outline->written;
+
+						mutt_Unlock(&cache->lock);
+						return MU_TRUE;
 					}
 
-					// Initialize active lines
-					//uint32_m first_line = 0;
-					//uint32_m line_len = 0;
+					// Adds an rglyph in FUnits to the cache
+					void muttR_OutlinePut(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float* bounds, muttResult res, uint32_m written) {
+						muttOutlineCache* cache = font->outline_cache;
+						if (header->glyph_id >= cache->num_glyphs) {
+							return;
+						}
 
-					// Loop through each horizontal strip from bottom to top
-					for (uint32_m h = 0; h < bitmap->height; ++h) {
-						// Calculate horizontal pixel offset
-						uint64_m hpix_offset = bitmap->stride*((bitmap->height-h)-1);
+						// Calculate size
+						uint32_m size = sizeof(muttR_Outline)
+							+ (sizeof(muttRPoint) * ((uint32_m)rglyph->num_points))
+							+ (sizeof(uint16_m) * ((uint32_m)rglyph->num_contours))
+						;
+						if (size > cache->stats.budget) {
+							return;
+						}
 
-						// Just fill all x-values with out if the height is now outside of the glyph range
-						// (+ double-pixel extra for bleeding and ceiling)
-						if (h > shape->y_max+2) {
-							mu_memset(&bitmap->pixels[hpix_offset], out, bitmap->width*adv);
-							continue;
+						mutt_Lock(&cache->lock);
+
+						// Don't add if another thread already has
+						if (cache->lookup[header->glyph_id]) {
+							mutt_Unlock(&cache->lock);
+							return;
 						}
 
-						// Calculate y-value of ray (middle of pixel)
-						float ray_y = ((float)h) + .5f;
+						// Evict least-recently-used outlines until it fits
+						while (cache->last && cache->stats.memory + size > cache->stats.budget) {
+							muttR_OutlineFree(font, cache, cache->last);
+							++cache->stats.evictions;
+						}
 
-						// Update active line list
-						//muttR_ActiveLines(shape->lines, shape->num_lines, &first_line, &line_len, ray_y);
-						// ^ Not doing this because it doesn't work for some reason...
-						// Calculate all hits with active lines (+ winding)
-						int32_m winding;
-						uint32_m num_hits = muttR_Hits(shape->lines, shape->num_lines, ray_y, hits, &winding);
+						// Allocate outline
+						muttR_Outline* outline = (muttR_Outline*)mutt_Malloc(font->allocator, size);
+						if (!outline) {
+							mutt_Unlock(&cache->lock);
+							return;
+						}
 
-						// Loop through each x-value
-						uint32_m ih = 0; // (Upcoming hit)
-						for (uint32_m w = 0; w < bitmap->width; ++w) {
-							// Just fill all remaining x-values with out if width is now outside of glyph range
-							// (+ double-pixel extra for bleeding and ceiling)
-							if (w > shape->x_max+2) {
-								mu_memset(&bitmap->pixels[hpix_offset+(w*adv)], out, (bitmap->width-w)*adv);
-								continue;
-							}
+						// Fill in outline
+						outline->glyph_id = header->glyph_id;
+						outline->glyph_data = header->data;
+						outline->size = size;
+						outline->res = res;
+						outline->written = written;
+						mu_memcpy(outline->bounds, bounds, sizeof(outline->bounds));
+						outline->num_points = rglyph->num_points;
+						outline->num_contours = rglyph->num_contours;
+						muByte* odata = (muByte*)(outline+1);
+						mu_memcpy(odata, rglyph->points, sizeof(muttRPoint) * ((uint32_m)rglyph->num_points));
+						odata += sizeof(muttRPoint) * ((uint32_m)rglyph->num_points);
+						mu_memcpy(odata, rglyph->contour_ends, sizeof(uint16_m) * ((uint32_m)rglyph->num_contours));
 
-							// Calculate x-coordinate (middle of pixel)
-							float ray_x = ((float)w) + .5f;
+						// Add to cache
+						cache->lookup[header->glyph_id] = outline;
+						muttR_OutlineLink(cache, outline);
+						cache->stats.memory += size;
+						++cache->stats.entries;
 
-							// Skip over every hit we've passed, and remove their windings
-							// "ray_x > ..." ensures rule 2 of scan converting:
-							// "If a contour falls exactly on a pixel’s center, that pixel is turned on."
-							while (ih < num_hits && ray_x > hits[ih].x) {
-								winding -= muttR_LineWinding(ray_y, &shape->lines[hits[ih++].l]);
-							}
+						mutt_Unlock(&cache->lock);
+					}
 
-							// Set pixel to whether or not we're in glyph
-							// Winding == 0 means in the glyph, and vice versa
-							if (winding == 0) {
-								mu_memset(&bitmap->pixels[hpix_offset+(w*adv)], out, adv);
-							} else {
-								mu_memset(&bitmap->pixels[hpix_offset+(w*adv)], in, adv);
-							}
+					MUDEF muttResult mutt_outline_cache_create(muttFont* font, uint32_m budget) {
+						MUTT_LAZY_LOAD(font, MUTT_LOAD_MAXP)
+						if (!font->maxp) {
+							return MUTT_TABLE_NOT_LOADED;
 						}
-					}
 
-					mu_free(hits);
-					return MUTT_SUCCESS;
-				}
+						// Destroy previous cache
+						if (font->outline_cache) {
+							mutt_outline_cache_destroy(font);
+						}
 
-				// A ray
-				struct muttR_Ray {
-					// Its y-value
-					float y;
-					// Each line its hit
-					muttR_Hit* hits;
-					// Number of hits
-					uint32_m num_hits;
-					// Its winding
-					int32_m winding;
-					// Upcoming hit
-					uint32_m ih;
-				};
-				typedef struct muttR_Ray muttR_Ray;
+						// Allocate cache
+						muttOutlineCache* cache = (muttOutlineCache*)mutt_Malloc(font->allocator, sizeof(muttOutlineCache));
+						if (!cache) {
+							return MUTT_FAILED_MALLOC;
+						}
+						// Allocate lookup
+						cache->num_glyphs = font->maxp->num_glyphs;
+						cache->lookup = (muttR_Outline**)mutt_Malloc(font->allocator, ((uint32_m)cache->num_glyphs)*sizeof(muttR_Outline*));
+						if (!cache->lookup) {
+							mutt_Free(font->allocator, cache);
+							return MUTT_FAILED_MALLOC;
+						}
+						mu_memset(cache->lookup, 0, ((uint32_m)cache->num_glyphs)*sizeof(muttR_Outline*));
 
-				// Fills information about a ray
-				static inline void muttR_PixelRayCalc(muttR_Shape* shape, muttR_Ray* ray, float ray_y) {
-					// Fill y-value
-					ray->y = ray_y;
-					// Calculate hit and winding
-					ray->num_hits = muttR_Hits(shape->lines, shape->num_lines, ray_y, ray->hits, &ray->winding);
-					// Set upcoming hit to 0
-					ray->ih = 0;
-				}
+						// Fill in the rest
+						cache->first = 0;
+						cache->last = 0;
+						cache->stats = MU_ZERO_STRUCT(muttOutlineCacheStats);
+						cache->stats.budget = budget;
+						mutt_LockInit(&cache->lock);
 
-				// MUTTR_FULL_PIXEL_AANXN inner handling
-				void muttR_FullPixelAANXNInner(muttR_Shape* shape, muttRBitmap* bitmap, uint8_m adv, float in, float out, uint8_m vs, uint8_m hs, muttR_Ray* rays) {
-					// Weight of each sample:
-					float weight = 1.f / ((float)(vs*hs));
+						font->outline_cache = cache;
+						return MUTT_SUCCESS;
+					}
 
-					// Loop through each horizontal strip from bottom to top
-					for (uint32_m h = 0; h < bitmap->height; ++h) {
-						// Calculate horizontal pixel offset
-						uint64_m hpix_offset = bitmap->stride*((bitmap->height-h)-1);
+					MUDEF void mutt_outline_cache_destroy(muttFont* font) {
+						muttOutlineCache* cache = font->outline_cache;
+						if (!cache) {
+							return;
+						}
 
-						// Just fill all x-values with out if the height is now outside of the glyph range
-						// (+ double-pixel extra for bleeding and ceiling)
-						if (h > shape->y_max+2) {
-							mu_memset(&bitmap->pixels[hpix_offset], out, bitmap->width*adv);
-							continue;
+						// Free outlines
+						while (cache->first) {
+							muttR_OutlineFree(font, cache, cache->first);
 						}
+						// Free cache
+						mutt_LockFree(&cache->lock);
+						mutt_Free(font->allocator, cache->lookup);
+						mutt_Free(font->allocator, cache);
+						font->outline_cache = 0;
+					}
 
-						// Calculate each ray
-						for (uint8_m r = 0; r < hs; ++r) {
-							// a=\left[\frac{1}{n+1},\frac{2}{n+1}...\frac{n}{n+1}\right]
-							muttR_PixelRayCalc(shape, rays+r, ((float)h) + (((float)(r+1)) / ((float)(hs+1))));
+					MUDEF void mutt_outline_cache_stats(muttFont* font, muttOutlineCacheStats* stats) {
+						muttOutlineCache* cache = font->outline_cache;
+						if (!cache) {
+							*stats = MU_ZERO_STRUCT(muttOutlineCacheStats);
+							return;
 						}
 
-						// Loop through each x-value
-						for (uint32_m w = 0; w < bitmap->width; ++w) {
-							// Just fill all remaining x-values with out if width is now outside of glyph range
-							// (+ double-pixel extra for bleeding and ceiling)
-							if (w > shape->x_max+2) {
-								mu_memset(&bitmap->pixels[hpix_offset+(w*adv)], out, (bitmap->width-w)*adv);
-								continue;
-							}
+						mutt_Lock(&cache->lock);
+						*stats = cache->stats;
+						mutt_Unlock(&cache->lock);
+					}
 
-							// Percentage amount the pixel is in
-							float in_per = 0.f;
+				/* Header */
 
-							// Loop through each vertical sample
-							for (uint8_m x = 0; x < vs; ++x) {
-								// Calculate x-coordinate
-								// (Same math as y-ray)
-								float ray_x = ((float)w) + (((float)(x+1)) / ((float)(vs+1)));
+					// Glyph header -> raster glyph
+					MUDEF muttResult mutt_header_rglyph(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
+						return mutt_header_rglyph_subpixel(font, header, rglyph, point_size, ppi, 0.f, 0.f, data, written);
+					}
 
-								// Loop through each horizontal sample
-								for (uint8_m y = 0; y < hs; ++y) {
-									// Skip over each hit, removing windings
-									while (rays[y].ih < rays[y].num_hits && ray_x > rays[y].hits[rays[y].ih].x) {
-										// winding -= muttR_LineWinding(ray_y, &shape->lines[hits[ih++].l]);
-										rays[y].winding -= muttR_LineWinding(rays[y].y, &shape->lines[rays[y].hits[rays[y].ih++].l]);
-									}
-									// Add if sample is in
-									in_per += (rays[y].winding==0) ?(0.f) :(weight);
+					// Glyph header -> raster glyph with subpixel offset
+					MUDEF muttResult mutt_header_rglyph_subpixel(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_x, float subpixel_y, muByte* data, uint32_m* written) {
+						muttResult res = MUTT_SUCCESS;
+						uint32_m write0 = 0, write1 = 0;
+
+						// Just memory calculations:
+						if (!data) {
+							// Simple:
+							if (header->number_of_contours >= 0) {
+								// Glyph data:
+								res = mutt_simple_glyph(font, header, 0, 0, &write0);
+								if (mutt_result_is_fatal(res)) {
+									return res;
+								}
+								// Rglyph data:
+								res = mutt_simple_rglyph(font, header, 0, 0, point_size, ppi, 0, &write1);
+								if (mutt_result_is_fatal(res)) {
+									return res;
+								}
+							}
+							// Composite:
+							else {
+								// Glyph data:
+								res = mutt_composite_glyph(font, header, 0, 0, &write0);
+								if (mutt_result_is_fatal(res)) {
+									return res;
 								}
+								// Rglyph data:
+								write1 = mutt_composite_rglyph_max(font);
 							}
 
-							// Calculate pixel color based on how much the pixel is in
-							// \left(a\right)\left(m_{1}-m_{0}\right)+m_{0}
-							for (uint8_m a = 0; a < adv-1; ++a) {
-								bitmap->pixels[hpix_offset+(w*adv)+a] = 255;
+							// Write sum of memory needed
+							*written = write0 + write1;
+							return res;
+						}
+
+						// Cached:
+						float bounds[4];
+						if (font->outline_cache && muttR_OutlineGet(font, header, rglyph, data, bounds, &res, &write0)) {
+							muttR_OutlinePunits(font, rglyph, bounds, point_size, ppi, subpixel_x, subpixel_y);
+							if (written) {
+								*written = write0;
 							}
-							bitmap->pixels[hpix_offset+(w*adv)+(adv-1)] = (in_per * (in-out)) + out;
+							return res;
 						}
-					}
-				}
 
-				// MUTTR_FULL_PIXEL_AANXN
-				muttResult muttR_FullPixelAANXN(muttR_Shape* shape, muttRBitmap* bitmap, uint8_m adv, uint8_m in, uint8_m out, uint8_m vs, uint8_m hs) {
-					// Allocate hits
-					muttR_Hit* hits = (muttR_Hit*)mu_malloc(shape->num_lines * hs * sizeof(muttR_Hit));
-					if (!hits) {
-						return MUTT_FAILED_MALLOC;
-					}
-					// Allocate rays
-					muttR_Ray* rays = (muttR_Ray*)mu_malloc(hs * sizeof(muttR_Ray));
-					if (!rays) {
-						mu_free(hits);
-						return MUTT_FAILED_MALLOC;
-					}
+						// Simple:
+						if (header->number_of_contours >= 0) {
+							// Load simple glyph
+							muttSimpleGlyph glyph;
+							res = mutt_simple_glyph(font, header, &glyph, data, &write0);
+							if (mutt_result_is_fatal(res)) {
+								return res;
+							}
+							data += write0;
 
-					// Fill all rays with their hit pointer
-					for (uint8_m r = 0; r < hs; ++r) {
-						rays[r].hits = hits + (shape->num_lines * r);
-					}
+							// Convert to rglyph in FUnits
+							muttR_SimpleOutline(header, &glyph, rglyph, data, bounds);
+							res = MUTT_SUCCESS;
+							write1 = (sizeof(muttRPoint) * ((uint32_m)rglyph->num_points)) + (sizeof(uint16_m) * ((uint32_m)rglyph->num_contours));
+							//data += write1;
+						}
+						// Composite:
+						else {
+							// Load composite glyph
+							muttCompositeGlyph glyph;
+							res = mutt_composite_glyph(font, header, &glyph, data, &write0);
+							if (mutt_result_is_fatal(res)) {
+								return res;
+							}
+							data += write0;
 
-					// Rasterize
-					muttR_FullPixelAANXNInner(shape, bitmap, adv, (float)in, (float)out, vs, hs, rays);
+							// Convert to rglyph in FUnits
+							res = muttR_CompositeOutline(font, &glyph, rglyph, data, bounds);
+							if (mutt_result_is_fatal(res)) {
+								return res;
+							}
+							write1 = mutt_composite_rglyph_max(font);
+							//data += write1;
+						}
 
-					// Deallocate and return
-					mu_free(rays);
-					mu_free(hits);
-					return MUTT_SUCCESS;
-				}
+						// Cache outline
+						if (font->outline_cache) {
+							muttR_OutlinePut(font, header, rglyph, bounds, res, write0 + write1);
+						}
 
-			/* Rasterization */
+						// Convert to pixel units
+						muttR_OutlinePunits(font, rglyph, bounds, point_size, ppi, subpixel_x, subpixel_y);
 
-				// Converts channels to advance
-				uint8_m muttR_ChannelsAdv(muttRChannels channels) {
-					switch (channels) {
-						default: return 1; break;
-						case MUTTR_R: return 1; break;
-						case MUTTR_RGB: return 3; break;
-						case MUTTR_RGBA: return 4; break;
+						// Write written
+						if (written) {
+							*written = write0 + write1;
+						}
+						return res;
+					}
+
+					// Glyph header x/y min/max -> raster x/y max
+					MUDEF void mutt_funits_punits_min_max(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi) {
+						mutt_funits_punits_min_max_subpixel(font, header, rglyph, point_size, ppi, 0.f, 0.f);
+					}
+
+					// Glyph header x/y min/max -> raster x/y max with subpixel offset
+					MUDEF void mutt_funits_punits_min_max_subpixel(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, float subpixel_x, float subpixel_y) {
+						rglyph->x_max = (-mutt_funits_to_punits(font, header->x_min, point_size, ppi) + 1.f + subpixel_x)
+							+ mutt_funits_to_punits(font, header->x_max, point_size, ppi);
+						rglyph->y_max = (-mutt_funits_to_punits(font, header->y_min, point_size, ppi) + 1.f + subpixel_y)
+							+ mutt_funits_to_punits(font, header->y_max, point_size, ppi);
+					}
+
+					MUDEF uint32_m mutt_header_rglyph_max(muttFont* font) {
+						// Simple:
+						uint32_m sim = mutt_simple_glyph_max_size(font) + mutt_simple_rglyph_max(font);
+						// Composite:
+						uint32_m com = mutt_composite_glyph_max_size(font) + mutt_composite_rglyph_max(font);
+						// Return greater
+						return (sim > com) ?(sim) :(com);
 					}
-				}
 
-				// Rasterizes a glyph
-				MUDEF muttResult mutt_raster_glyph(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method) {
-					// Convert rglyph to shape
-					muttR_Shape shape;
-					muttResult res = muttR_ShapeCreate(glyph, &shape);
+			/* Batch */
+
+				// Holds the information for one thread of a batch
+				struct muttR_BatchWorker {
+					// Shared (read-only) batch information
+					muttFont* font;
+					muttRJob* jobs;
+					uint32_m job_count;
+					muttRMethod method;
+					// Jobs done by this worker: first, first+step, first+2*step...
+					uint32_m first;
+					uint32_m step;
+					// Worker-owned memory
+					muttRInfo info;
+					muttRScratch scratch;
+					muByte* rdata;
+					// Thread handle
+					#if defined(MUTT_THREADS_WIN32)
+					HANDLE thread;
+					#elif defined(MUTT_THREADS_PTHREAD)
+					pthread_t thread;
+					#endif
+					muBool threaded;
+				};
+				typedef struct muttR_BatchWorker muttR_BatchWorker;
+
+				// Performs a single job
+				muttResult muttR_BatchJob(muttR_BatchWorker* worker, muttRJob* job) {
+					// Get glyph header
+					muttGlyphHeader header;
+					muttResult res = mutt_glyph_header(worker->font, job->glyph_id, &header);
 					if (mutt_result_is_fatal(res)) {
 						return res;
 					}
+					// Nothing to rasterize if there's no contours
+					if (header.number_of_contours == 0) {
+						return res;
+					}
 
-					// Per-pixel advance based on channels:
-					uint8_m adv = muttR_ChannelsAdv(bitmap->channels);
-					// In/Out value based on io_color:
-					uint8_m in  = (bitmap->io_color == MUTTR_BW) ?(255) :(0);
-					uint8_m out = ~in;
-
-					// Render shape based on method
-					switch (method) {
-						// Unrecognized method:
-						default: {
-							res = MUTT_UNKNOWN_RASTER_METHOD;
-						} break;
+					// Convert to rglyph
+					muttRGlyph rglyph;
+					res = mutt_header_rglyph(worker->font, &header, &rglyph, job->point_size, job->ppi, worker->rdata, 0);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
 
-						// Full-pixel bi-level
-						case MUTTR_FULL_PIXEL_BI_LEVEL: {
-							res = muttR_FullPixelBiLevel(&shape, bitmap, adv, in, out);
-						} break;
+					// Rasterize
+					muttResult rres = mutt_raster_glyph_info(&rglyph, job->bitmap, worker->method, &worker->info);
+					// (Give the raster result if it's not successful; conversion result otherwise)
+					return (rres != MUTT_SUCCESS) ?(rres) :(res);
+				}
 
-						// Full-pixel AA 2x2
-						case MUTTR_FULL_PIXEL_AA2X2: {
-							res = muttR_FullPixelAANXN(&shape, bitmap, adv, in, out, 2, 2);
-						} break;
-						// Full-pixel AA 4x4
-						case MUTTR_FULL_PIXEL_AA4X4: {
-							res = muttR_FullPixelAANXN(&shape, bitmap, adv, in, out, 4, 4);
-						} break;
-						// Full-pixel AA 8x8
-						case MUTTR_FULL_PIXEL_AA8X8: {
-							res = muttR_FullPixelAANXN(&shape, bitmap, adv, in, out, 8, 8);
-						} break;
+				// Performs all jobs of a worker
+				void muttR_BatchWork(muttR_BatchWorker* worker) {
+					for (uint32_m j = worker->first; j < worker->job_count; j += worker->step) {
+						worker->jobs[j].result = muttR_BatchJob(worker, &worker->jobs[j]);
 					}
+				}
 
-					// Free resources and return latest non-fatal result
-					muttR_ShapeDestroy(&shape);
-					return res;
+				// Thread entry points
+				#if defined(MUTT_THREADS_WIN32)
+				DWORD WINAPI muttR_BatchThread(LPVOID p) {
+					muttR_BatchWork((muttR_BatchWorker*)p);
+					return 0;
 				}
+				#elif defined(MUTT_THREADS_PTHREAD)
+				void* muttR_BatchThread(void* p) {
+					muttR_BatchWork((muttR_BatchWorker*)p);
+					return 0;
+				}
+				#endif
 
-			/* Conversion */
+				// Starts a worker's thread, performing it on this thread if not possible
+				void muttR_BatchStart(muttR_BatchWorker* worker) {
+					worker->threaded = MU_FALSE;
+					#if defined(MUTT_THREADS_WIN32)
+					worker->thread = CreateThread(0, 0, muttR_BatchThread, worker, 0, 0);
+					worker->threaded = (worker->thread != 0);
+					#elif defined(MUTT_THREADS_PTHREAD)
+					worker->threaded = (pthread_create(&worker->thread, 0, muttR_BatchThread, worker) == 0);
+					#endif
 
-				// FUnits to pixel-units
-				MUDEF float mutt_funits_to_punits(muttFont* font, float funits, float point_size, float ppi) {
-					return point_size * funits * ppi / (72.f * font->head->units_per_em);
+					if (!worker->threaded) {
+						muttR_BatchWork(worker);
+					}
 				}
 
-				// Gets the ascent/descent/lsb/advance-width of an rglyph for a glyph ID
-				MUDEF void mutt_rglyph_metrics(muttFont* font, muttGlyphHeader* header, uint16_m glyph_id, muttRGlyph* rglyph, float point_size, float ppi) {
-					// Offsets
-					float py = -mutt_funits_to_punits(font, header->y_min, point_size, ppi) + 1.f;
+				// Waits for a worker's thread to finish
+				void muttR_BatchWait(muttR_BatchWorker* worker) {
+					if (!worker->threaded) {
+						return;
+					}
+					#if defined(MUTT_THREADS_WIN32)
+					WaitForSingleObject(worker->thread, INFINITE);
+					CloseHandle(worker->thread);
+					#elif defined(MUTT_THREADS_PTHREAD)
+					pthread_join(worker->thread, 0);
+					#endif
+				}
 
-					// Ascender + Descender
-					rglyph->ascender  = py + mutt_funits_to_punits(font, font->hhea->ascender , point_size, ppi);
-					rglyph->descender = py + mutt_funits_to_punits(font, font->hhea->descender, point_size, ppi);
+				// Rasterizes several TrueType glyphs across threads
+				MUDEF muttResult mutt_raster_glyphs(muttFont* font, muttRJob* jobs, uint32_m job_count, muttRMethod method, muttRInfo* info, uint32_m thread_count) {
+					// Parse needed tables before any threads read from font
+					MUTT_LAZY_LOAD(font, MUTT_LAZY_GLYPH | MUTT_LAZY_METRICS)
 
-					// Left-side bearing + Advance width
-					if (glyph_id >= font->hhea->number_of_hmetrics) {
-						// lsb is in lsb array:
-						rglyph->lsb = mutt_funits_to_punits(font, font->hmtx->left_side_bearings[glyph_id - font->hhea->number_of_hmetrics], point_size, ppi);
-						// Advance width is last advance width
-						if (font->hhea->number_of_hmetrics > 0) {
-							rglyph->advance_width = mutt_funits_to_punits(font, font->hmtx->hmetrics[font->hhea->number_of_hmetrics - 1].advance_width, point_size, ppi);
-						} else {
-							// Defaulting on 0 for advance width with no hmetrics specified
-							rglyph->advance_width = 0;
-						}
-					} else {
-						// lsb is in hmetrics array:
-						rglyph->lsb = mutt_funits_to_punits(font, font->hmtx->hmetrics[glyph_id].lsb, point_size, ppi);
-						// As well as advance width:
-						rglyph->advance_width = mutt_funits_to_punits(font, font->hmtx->hmetrics[glyph_id].advance_width, point_size, ppi);
+					// Clamp thread count
+					#if !defined(MUTT_THREADS_WIN32) && !defined(MUTT_THREADS_PTHREAD)
+					thread_count = 1;
+					#endif
+					if (thread_count == 0) {
+						thread_count = 1;
+					}
+					// (Threads are created per call, so each needs enough jobs to be worth it)
+					uint32_m max_threads = job_count / MUTT_BATCH_MIN_JOBS;
+					if (thread_count > max_threads) {
+						thread_count = (max_threads == 0) ?(1) :(max_threads);
 					}
-				}
 
-				/* Simple */
+					// Allocate workers
+					muttR_BatchWorker* workers = (muttR_BatchWorker*)mutt_Malloc(font->allocator, thread_count*sizeof(muttR_BatchWorker));
+					if (!workers) {
+						return MUTT_FAILED_MALLOC;
+					}
 
-					// Simple glyph -> raster glyph
-					MUDEF muttResult mutt_simple_rglyph(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
-						// For written calculations:
-						if (!data) {
-							uint32_m write = 0;
-							// points
-							write += sizeof(muttRPoint) * (glyph->end_pts_of_contours[header->number_of_contours-1] + 1);
-							// contour_ends
-							write += sizeof(uint16_m) * header->number_of_contours;
-							// Write data needed
-							*written = write;
-							return MUTT_SUCCESS;
+					// Allocate each worker's rglyph memory
+					uint32_m rdata_size = mutt_header_rglyph_max(font);
+					for (uint32_m t = 0; t < thread_count; ++t) {
+						muttR_BatchWorker* worker = &workers[t];
+						worker->rdata = (muByte*)mutt_Malloc(font->allocator, rdata_size);
+						if (!worker->rdata) {
+							for (uint32_m f = 0; f < t; ++f) {
+								mutt_Free(font->allocator, workers[f].rdata);
+							}
+							mutt_Free(font->allocator, workers);
+							return MUTT_FAILED_MALLOC;
 						}
 
-						// Get data for arrays
-						muByte* orig_data = data;
-						// - points
-						rglyph->num_points = glyph->end_pts_of_contours[header->number_of_contours-1] + 1;
-						rglyph->points = (muttRPoint*)data;
-						data += sizeof(muttRPoint) * ((uint32_m)rglyph->num_points);
-						// - contour_ends
-						rglyph->num_contours = header->number_of_contours;
-						rglyph->contour_ends = (uint16_m*)data;
-						data += sizeof(uint16_m) * ((uint32_m)rglyph->num_contours);
-						// Write written data amount
-						if (written) {
-							*written = data-orig_data;
+						// Fill in worker information
+						worker->font = font;
+						worker->jobs = jobs;
+						worker->job_count = job_count;
+						worker->method = method;
+						worker->first = t;
+						worker->step = thread_count;
+						// (Each worker gets its own scratch)
+						if (info) {
+							worker->info = *info;
+						} else {
+							worker->info = MU_ZERO_STRUCT(muttRInfo);
 						}
+						worker->scratch = MU_ZERO_STRUCT(muttRScratch);
+						worker->scratch.allocator = font->allocator;
+					}
+					// (Scratch pointer set after all workers are placed in memory)
+					for (uint32_m t = 0; t < thread_count; ++t) {
+						workers[t].info.scratch = &workers[t].scratch;
+					}
 
-						// Calculate point offsets based on glyph's min/max values
-						float px = -mutt_funits_to_punits(font, header->x_min, point_size, ppi) + 1.f;
-						float py = -mutt_funits_to_punits(font, header->y_min, point_size, ppi) + 1.f;
+					// Start all workers but the first, which runs on this thread
+					for (uint32_m t = 1; t < thread_count; ++t) {
+						muttR_BatchStart(&workers[t]);
+					}
+					muttR_BatchWork(&workers[0]);
 
-						// Loop through each point
-						for (uint16_m p = 0; p < rglyph->num_points; ++p) {
-							// X and Y
-							rglyph->points[p].x = px + mutt_funits_to_punits(font, glyph->points[p].x, point_size, ppi);
-							rglyph->points[p].y = py + mutt_funits_to_punits(font, glyph->points[p].y, point_size, ppi);
-							// Flags
-							rglyph->points[p].flags = (glyph->points[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
+					// Wait for all workers and free their memory
+					for (uint32_m t = 0; t < thread_count; ++t) {
+						if (t != 0) {
+							muttR_BatchWait(&workers[t]);
 						}
-
-						// Copy over contour ends
-						mu_memcpy(rglyph->contour_ends, glyph->end_pts_of_contours, sizeof(uint16_m) * ((uint32_m)rglyph->num_contours));
-
-						// Caclculate x_max and y_max
-						rglyph->x_max = px + mutt_funits_to_punits(font, header->x_max, point_size, ppi);
-						rglyph->y_max = py + mutt_funits_to_punits(font, header->y_max, point_size, ppi);
-
-						return MUTT_SUCCESS;
+						mutt_rscratch_free(&workers[t].scratch);
+						mutt_Free(font->allocator, workers[t].rdata);
 					}
+					mutt_Free(font->allocator, workers);
+					return MUTT_SUCCESS;
+				}
 
-					// Memory maximum
-					MUDEF uint32_m mutt_simple_rglyph_max(muttFont* font) {
-						return
-							// points
-							(sizeof(muttRPoint) * font->maxp->max_points)
-							// contour_ends
-							+ (sizeof(uint16_m) * font->maxp->max_contours)
-						;
-					}
+		/* Atlas API */
 
-				/* Composite */
+			/* Skyline packing */
 
-					// Used to pass data between function calls within composite glyph processing
-					struct muttR_CompProg {
-						// Progressives (move up between rglyphs):
-						uint32_m num_contours;
-						uint32_m num_points;
-						uint16_m* contour_ends;
-						muttRPoint* points;
-						float x_min;
-						float y_min;
-						float x_max;
-						float y_max;
-						// Actual rglyph being filled in:
-						muttRGlyph* rglyph;
-						// Temp simple glyph mem:
-						muByte* temp_simple_max;
-						// Max values:
-						uint16_m max_contours;
-						uint16_m max_points;
-					};
-					typedef struct muttR_CompProg muttR_CompProg;
+				// Skyline nodes are stored as 3 values: x, y (height), and width
+				#define MUTTA_NODE_X(page, n) (page)->nodes[((n)*3)]
+				#define MUTTA_NODE_Y(page, n) (page)->nodes[((n)*3)+1]
+				#define MUTTA_NODE_W(page, n) (page)->nodes[((n)*3)+2]
 
-					// Initializes a CompProg struct
-					void muttR_CompProg_init(muttR_CompProg* prog, muttRGlyph* rglyph, muByte* temp_simple_max, muttFont* font) {
-						// Set numerical progressives to 0
-						prog->num_contours = 0;
-						prog->num_points = 0;
-						prog->x_min = 0.f;
-						prog->y_min = 0.f;
-						prog->x_max = 0.f;
-						prog->y_max = 0.f;
-						// Set initial progressive pointers
-						prog->contour_ends = rglyph->contour_ends;
-						prog->points = rglyph->points;
-						// Rglyph
-						prog->rglyph = rglyph;
-						rglyph->num_points = 0;
-						rglyph->num_contours = 0;
-						// Temp simple max
-						prog->temp_simple_max = temp_simple_max;
-						// Max values
-						prog->max_contours = font->maxp->max_composite_contours;
-						prog->max_points = font->maxp->max_composite_points;
-					}
+				// Moves node src to node dst
+				#define MUTTA_NODE_MOVE(page, dst, src) \
+					MUTTA_NODE_X(page, dst) = MUTTA_NODE_X(page, src); \
+					MUTTA_NODE_Y(page, dst) = MUTTA_NODE_Y(page, src); \
+					MUTTA_NODE_W(page, dst) = MUTTA_NODE_W(page, src);
 
-					// Converts simple glyph component to rglyph within the CompProg
-					// Glyph must have at least 1 contour
-					// This process gives the raw TrueType coordinates in float form;
-					// point and PPI are accounted for afterwards to separate that
-					// logic from the point alignment and such.
-					muttResult mutt_composite_simple_rglyph(muttR_CompProg* prog, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttComponentGlyph* comp) {
-						// Account for number of contours
-						prog->num_contours += header->number_of_contours;
-						if (prog->num_contours > prog->max_contours) {
-							return MUTT_INVALID_RGLYPH_COMPOSITE_CONTOUR_COUNT;
-						}
-						// Account for number of points
-						prog->num_points += glyph->end_pts_of_contours[header->number_of_contours-1]+1;
-						if (prog->num_points > prog->max_points) {
-							return MUTT_INVALID_RGLYPH_COMPOSITE_POINT_COUNT;
-						}
-						uint16_m num_points = glyph->end_pts_of_contours[header->number_of_contours-1]+1;
+				// Removes node n
+				void muttA_SkylineRemove(muttAtlasPage* page, uint32_m n) {
+					for (; n+1 < page->num_nodes; ++n) {
+						MUTTA_NODE_MOVE(page, n, n+1)
+					}
+					--page->num_nodes;
+				}
 
-						// Calculate scales
-						float xscale=1.f, scale01=0.f, scale10=0.f, yscale=1.f;
+				// Calculates the y-value that a rect of width w can be placed at from node n
+				// Returns MU_FALSE if the rect goes past the page's width
+				muBool muttA_SkylineFit(muttAtlasPage* page, uint32_m page_width, uint32_m n, uint32_m w, uint32_m* y) {
+					// Verify that it fits horizontally
+					if (MUTTA_NODE_X(page, n) + w > page_width) {
+						return MU_FALSE;
+					}
 
-						if (comp->flags & MUTT_WE_HAVE_A_SCALE) {
-							// One scale applied to x and y
-							xscale = yscale = comp->scales[0];
-						}
-						else if (comp->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-							// Individual x and y scale
-							xscale = comp->scales[0];
-							yscale = comp->scales[1];
+					// Find highest node that the rect spans over
+					uint32_m top = 0;
+					uint32_m left = w;
+					for (; n < page->num_nodes; ++n) {
+						if (MUTTA_NODE_Y(page, n) > top) {
+							top = MUTTA_NODE_Y(page, n);
 						}
-						else if (comp->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-							// Full 2x2 affine transformation
-							xscale  = comp->scales[0];
-							scale01 = comp->scales[1];
-							scale10 = comp->scales[2];
-							yscale  = comp->scales[3];
+						if (MUTTA_NODE_W(page, n) >= left) {
+							break;
 						}
+						left -= MUTTA_NODE_W(page, n);
+					}
 
+					*y = top;
+					return MU_TRUE;
+				}
 
-						// Calculate argument1 & argument2 offsets
-						float argument1, argument2;
-						if (comp->flags & MUTT_ARGS_ARE_XY_VALUES) {
-							// Just read the offsets
-							argument1 = comp->argument1;
-							argument2 = comp->argument2;
-							// Possible scaling:
-							if (comp->flags & MUTT_SCALED_COMPONENT_OFFSET) {
-								float n_argument1 = (xscale  * argument1) + (scale10 * argument2);
-								float n_argument2 = (scale01 * argument1) + (yscale  * argument2);
-								argument1 = n_argument1;
-								argument2 = n_argument2;
-								// Possible rounding:
-								if (comp->flags & MUTT_ROUND_XY_TO_GRID) {
-									argument1 = mu_roundf(argument1);
-									argument2 = mu_roundf(argument2);
-								}
-							}
+				// Packs a rect onto a page
+				// Returns MU_FALSE if there's no room for it
+				muBool muttA_SkylinePack(muttAtlasPage* page, uint32_m page_width, uint32_m page_height, uint32_m w, uint32_m h, uint32_m* x, uint32_m* y) {
+					// Find node that places the rect the lowest
+					uint32_m best = page->num_nodes;
+					uint32_m best_y = 0;
+					for (uint32_m n = 0; n < page->num_nodes; ++n) {
+						uint32_m ny;
+						if (!muttA_SkylineFit(page, page_width, n, w, &ny) || ny + h > page_height) {
+							continue;
 						}
-						else {
-							// argument1 is parent (prog->rglyph) point number
-							// argument2 is child (glyph) point number
-							// Offset should align these two points
-
-							// NOTE: phantom points can be used in this process, but
-							// mutt v1.0.0 doesn't have support for gvar (which, as
-							// far as I can tell, is needed to process the phantom
-							// points); composite glyphs that depend on phantom
-							// points will, for now, render incorrectly or possibly
-							// not render successfully at all.
-
-							// - Parent point -
-							// Ensure point number is in range
-							if (comp->argument1 >= prog->rglyph->num_points) {
-								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1;
-							}
-							// Get parent x and y
-							float parent_x = prog->rglyph->points[comp->argument1].x;
-							float parent_y = prog->rglyph->points[comp->argument1].y;
-
-							// - Child point -
-							// Ensure point number is in range
-							if (comp->argument2 >= num_points) {
-								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2;
-							}
-							// Get child x and y
-							float t_child_x = glyph->points[comp->argument2].x;
-							float t_child_y = glyph->points[comp->argument2].y;
-							// Calculate it with scales applied so that point is still
-							// aligned with scales
-							float child_x = (xscale  * t_child_x) + (scale10 * t_child_y);
-							float child_y = (scale01 * t_child_x) + (yscale  * t_child_y);
-
-							// Calcaulte argument1 & argument2 to be offsets that align
-							// the child point to the parent point
-							argument1 = parent_x - child_x;
-							argument2 = parent_y - child_y;
+						if (best == page->num_nodes || ny < best_y) {
+							best = n;
+							best_y = ny;
 						}
+					}
+					if (best == page->num_nodes) {
+						return MU_FALSE;
+					}
 
-						// Loop through each point
-						for (uint16_m p = 0; p < num_points; ++p) {
-							// Calculate scaled point
-							float point_x = glyph->points[p].x;
-							float point_y = glyph->points[p].y;
-							prog->points[p].x = (xscale  * point_x) + (scale10 * point_y);
-							prog->points[p].y = (scale01 * point_x) + (yscale  * point_y);
-							// Add offsets
-							prog->points[p].x += argument1;
-							prog->points[p].y += argument2;
+					*x = MUTTA_NODE_X(page, best);
+					*y = best_y;
 
-							// Flags of this point
-							prog->points[p].flags = (glyph->points[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
+					// Insert new node for the top of the rect
+					for (uint32_m n = page->num_nodes; n > best; --n) {
+						MUTTA_NODE_MOVE(page, n, n-1)
+					}
+					MUTTA_NODE_X(page, best) = *x;
+					MUTTA_NODE_Y(page, best) = best_y + h;
+					MUTTA_NODE_W(page, best) = w;
+					++page->num_nodes;
+
+					// Shrink or remove the nodes that the rect covers
+					uint32_m right = *x + w;
+					uint32_m n = best+1;
+					while (n < page->num_nodes && MUTTA_NODE_X(page, n) < right) {
+						uint32_m node_right = MUTTA_NODE_X(page, n) + MUTTA_NODE_W(page, n);
+						// - Partially covered; shrink
+						if (node_right > right) {
+							MUTTA_NODE_W(page, n) = node_right - right;
+							MUTTA_NODE_X(page, n) = right;
+							break;
 						}
-						// Push progressive points pointer
-						prog->points += num_points;
+						// - Fully covered; remove
+						muttA_SkylineRemove(page, n);
+					}
 
-						// Loop through each contour end
-						for (uint16_m c = 0; c < header->number_of_contours; ++c) {
-							// Each contour end is the glyph-relative contour end
-							// with the offset of all the previous points
-							// I'm bad at explaining numbers
-							prog->contour_ends[c] = prog->rglyph->num_points + glyph->end_pts_of_contours[c];
+					// Merge neighboring nodes of the same height
+					for (uint32_m m = 0; m+1 < page->num_nodes;) {
+						if (MUTTA_NODE_Y(page, m) == MUTTA_NODE_Y(page, m+1)) {
+							MUTTA_NODE_W(page, m) += MUTTA_NODE_W(page, m+1);
+							muttA_SkylineRemove(page, m+1);
+						} else {
+							++m;
 						}
-						// Push progressive contour ends pointer
-						prog->contour_ends += header->number_of_contours;
+					}
 
-						// Add to rglyph
-						prog->rglyph->num_points += num_points;
-						prog->rglyph->num_contours += header->number_of_contours;
-						return MUTT_SUCCESS;
+					return MU_TRUE;
+				}
+
+			/* Pages */
+
+				// Adds a new empty page to an atlas
+				muttResult muttA_PageAdd(muttAtlas* atlas) {
+					// Reallocate pages
+					muttAtlasPage* pages = (muttAtlasPage*)mutt_Realloc(atlas->font->allocator, atlas->pages, (atlas->num_pages+1)*sizeof(muttAtlasPage));
+					if (!pages) {
+						return MUTT_FAILED_REALLOC;
 					}
+					atlas->pages = pages;
+					muttAtlasPage* page = &pages[atlas->num_pages];
 
-					// Processes composite component for CompProg
-					muttResult mutt_component_rglyph(muttFont* font, muttR_CompProg* prog, muttComponentGlyph* comp, uint32_m depth) {
-						muttResult res = MUTT_SUCCESS;
+					// Allocate pixels, filled with out color
+					size_m pixels_size = ((size_m)atlas->info.page_width) * atlas->info.page_height * muttR_ChannelsAdv(atlas->info.channels);
+					page->pixels = (uint8_m*)mutt_Malloc(atlas->font->allocator, pixels_size);
+					if (!page->pixels) {
+						return MUTT_FAILED_MALLOC;
+					}
+					mu_memset(page->pixels, (atlas->info.io_color == MUTTR_BW) ?(0) :(255), pixels_size);
 
-						// Store point stuff BEFORE all points for this component are processed
-						uint16_m prev_num_points = prog->num_points;
-						muttRPoint* prev_points = prog->points;
+					// Allocate skyline nodes
+					// (Every node is at least 1 pixel wide, +1 for insertion)
+					page->nodes = (uint32_m*)mutt_Malloc(atlas->font->allocator, (atlas->info.page_width+1)*3*sizeof(uint32_m));
+					if (!page->nodes) {
+						mutt_Free(atlas->font->allocator, page->pixels);
+						return MUTT_FAILED_MALLOC;
+					}
+					// (Starts with one node spanning the whole page)
+					page->num_nodes = 1;
+					MUTTA_NODE_X(page, 0) = 0;
+					MUTTA_NODE_Y(page, 0) = 0;
+					MUTTA_NODE_W(page, 0) = atlas->info.page_width;
 
-						// Get header of glyph index
-						muttGlyphHeader header;
-						res = mutt_glyph_header(font, comp->glyph_index, &header);
-						if (mutt_result_is_fatal(res)) {
-							return res;
-						}
+					page->dirty = MU_TRUE;
+					++atlas->num_pages;
+					return MUTT_SUCCESS;
+				}
 
-						// Simple glyph with contours:
-						if (header.number_of_contours > 0) {
-							// Get simple glyph
-							muttSimpleGlyph glyph;
-							res = mutt_simple_glyph(font, &header, &glyph, prog->temp_simple_max, 0);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
+			/* Creation / Destruction */
 
-							// Process simple glyph
-							res = mutt_composite_simple_rglyph(prog, &header, &glyph, comp);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
+				MUDEF muttResult mutt_atlas_create(muttFont* font, muttAtlas* atlas, muttAtlasInfo* info) {
+					// Parse needed tables
+					MUTT_LAZY_LOAD(font, MUTT_LAZY_GLYPH | MUTT_LAZY_METRICS)
+					if (!font->maxp) {
+						return (font->maxp_res != MUTT_SUCCESS) ?(font->maxp_res) :(MUTT_FAILED_FIND_TABLE);
+					}
 
-							return res;
-						}
+					// Verify page dimensions
+					if (info->page_width == 0 || info->page_height == 0) {
+						return MUTT_INVALID_ATLAS_PAGE_DIMENSIONS;
+					}
 
-						// Simple glyph with no contours:
-						else if (header.number_of_contours == 0) {
-							// Do nothing for this guy
-							return res;
-						}
+					atlas->info = *info;
+					atlas->font = font;
+					atlas->num_pages = 0;
+					atlas->pages = 0;
+					atlas->num_glyphs = 0;
+					atlas->glyphs = 0;
+					atlas->glyph_capacity = 0;
+					atlas->scratch = MU_ZERO_STRUCT(muttRScratch);
+					atlas->scratch.allocator = font->allocator;
 
-						// Composite glyph
-						else {
-							// Increment depth tracker
-							if (++depth > font->maxp->max_component_depth) {
-								return MUTT_INVALID_RGLYPH_COMPOSITE_DEPTH;
-							}
+					// Allocate glyph lookup
+					atlas->lookup = (uint32_m*)mutt_Malloc(font->allocator, font->maxp->num_glyphs*sizeof(uint32_m));
+					if (!atlas->lookup) {
+						return MUTT_FAILED_MALLOC;
+					}
+					mu_memset(atlas->lookup, 0, font->maxp->num_glyphs*sizeof(uint32_m));
 
-							// Loop through each component
-							uint32_m component_count = 0;
-							muBool no_more = MU_FALSE;
-							muByte* bprog = header.data;
-							while (!no_more) {
-								// Verify incremented component count
-								if (++component_count > font->maxp->max_component_elements) {
-									return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT;
-								}
+					// Allocate rglyph memory
+					atlas->rdata = (muByte*)mutt_Malloc(font->allocator, mutt_header_rglyph_max(font));
+					if (!atlas->rdata) {
+						mutt_Free(font->allocator, atlas->lookup);
+						return MUTT_FAILED_MALLOC;
+					}
 
-								// Get individual component
-								muttComponentGlyph this_component;
-								res = mutt_composite_component(font, &header, &bprog, &this_component, &no_more);
-								if (mutt_result_is_fatal(res)) {
-									return res;
-								}
-								// Process component with this current function
-								// (Scary recursion)
-								res = mutt_component_rglyph(font, prog, &this_component, depth);
-								if (mutt_result_is_fatal(res)) {
-									return res;
-								}
-							}
-						}
+					return MUTT_SUCCESS;
+				}
 
-						// This code is considerably similar to mutt_composite_simple_rglyph
+				MUDEF void mutt_atlas_destroy(muttAtlas* atlas) {
+					// Pages
+					for (uint32_m p = 0; p < atlas->num_pages; ++p) {
+						mutt_Free(atlas->font->allocator, atlas->pages[p].pixels);
+						mutt_Free(atlas->font->allocator, atlas->pages[p].nodes);
+					}
+					if (atlas->pages) {
+						mutt_Free(atlas->font->allocator, atlas->pages);
+					}
+					// Glyphs
+					if (atlas->glyphs) {
+						mutt_Free(atlas->font->allocator, atlas->glyphs);
+					}
+					mutt_Free(atlas->font->allocator, atlas->lookup);
+					// Raster memory
+					mutt_Free(atlas->font->allocator, atlas->rdata);
+					mutt_rscratch_free(&atlas->scratch);
+				}
 
-						// Calculate this component's values
-						uint16_m num_points = prog->num_points - prev_num_points;
+			/* Adding glyphs */
 
-						// Calculate scales
-						float xscale=1.f, scale01=0.f, scale10=0.f, yscale=1.f;
+				// A glyph waiting to be placed
+				struct muttA_Pending {
+					uint16_m glyph_id;
+					uint32_m width;
+					uint32_m height;
+				};
+				typedef struct muttA_Pending muttA_Pending;
 
-						if (comp->flags & MUTT_WE_HAVE_A_SCALE) {
-							// One scale applied to x and y
-							xscale = yscale = comp->scales[0];
-						}
-						else if (comp->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-							// Individual x and y scale
-							xscale = comp->scales[0];
-							yscale = comp->scales[1];
-						}
-						else if (comp->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-							// Full 2x2 affine transformation
-							xscale  = comp->scales[0];
-							scale01 = comp->scales[1];
-							scale10 = comp->scales[2];
-							yscale  = comp->scales[3];
-						}
+				// Used to sort pending glyphs in order of decreasing height
+				int muttA_ComparePending(const void* p, const void* q) {
+					muttA_Pending* p0 = (muttA_Pending*)p;
+					muttA_Pending* p1 = (muttA_Pending*)q;
+					if (p0->height > p1->height) {
+						return -1;
+					} else if (p0->height < p1->height) {
+						return 1;
+					}
+					return 0;
+				}
 
-						// Calculate argument1 and argument2 offsets
-						float argument1, argument2;
-						if (comp->flags & MUTT_ARGS_ARE_XY_VALUES) {
-							// Just read the offsets
-							argument1 = comp->argument1;
-							argument2 = comp->argument2;
-							// Possible scaling:
-							if (comp->flags & MUTT_SCALED_COMPONENT_OFFSET) {
-								float n_argument1 = (xscale  * argument1) + (scale10 * argument2);
-								float n_argument2 = (scale01 * argument1) + (yscale  * argument2);
-								argument1 = n_argument1;
-								argument2 = n_argument2;
-								// Possible rounding:
-								if (comp->flags & MUTT_ROUND_XY_TO_GRID) {
-									argument1 = mu_roundf(argument1);
-									argument2 = mu_roundf(argument2);
-								}
+				// Converts a glyph to an rglyph at the atlas's size
+				muttResult muttA_Rglyph(muttAtlas* atlas, uint16_m glyph_id, muttGlyphHeader* header, muttRGlyph* rglyph) {
+					muttResult res = mutt_glyph_header(atlas->font, glyph_id, header);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+					// (No contours means nothing to convert)
+					if (header->number_of_contours == 0) {
+						rglyph->x_max = rglyph->y_max = 0.f;
+						return res;
+					}
+					return mutt_header_rglyph(atlas->font, header, rglyph, atlas->info.point_size, atlas->info.ppi, atlas->rdata, 0);
+				}
+
+				// Places and rasterizes a pending glyph onto a page
+				muttResult muttA_Place(muttAtlas* atlas, muttA_Pending* pending, muttAtlasGlyph* glyph) {
+					muttResult res;
+					glyph->glyph_id = pending->glyph_id;
+					glyph->page = 0;
+					glyph->x = glyph->y = 0;
+					glyph->width = pending->width;
+					glyph->height = pending->height;
+
+					// Find a spot on a page for non-empty glyphs
+					if (pending->width != 0) {
+						if (pending->width > atlas->info.page_width || pending->height > atlas->info.page_height) {
+							return MUTT_ATLAS_GLYPH_TOO_LARGE;
+						}
+						// (Padding can be cut off by the edge of the page)
+						uint32_m w = pending->width + atlas->info.padding;
+						uint32_m h = pending->height + atlas->info.padding;
+						if (w > atlas->info.page_width) {
+							w = atlas->info.page_width;
+						}
+						if (h > atlas->info.page_height) {
+							h = atlas->info.page_height;
+						}
+
+						// Try each existing page
+						uint32_m p = 0;
+						for (; p < atlas->num_pages; ++p) {
+							if (muttA_SkylinePack(&atlas->pages[p], atlas->info.page_width, atlas->info.page_height, w, h, &glyph->x, &glyph->y)) {
+								break;
 							}
 						}
-						else {
-							// argument1 is parent (rglyph->points, prev_num_points)
-							// argument2 is child (prev_points, num_points)
-
-							// - Parent point -
-							// Ensure point range
-							if (comp->argument1 >= prev_num_points) {
-								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1;
+						// Make new page if none had room
+						if (p == atlas->num_pages) {
+							res = muttA_PageAdd(atlas);
+							if (mutt_result_is_fatal(res)) {
+								return res;
 							}
-							// Get parent x and y
-							float parent_x = prog->rglyph->points[comp->argument1].x;
-							float parent_y = prog->rglyph->points[comp->argument1].y;
+							muttA_SkylinePack(&atlas->pages[p], atlas->info.page_width, atlas->info.page_height, w, h, &glyph->x, &glyph->y);
+						}
+						glyph->page = p;
+					}
 
-							// - Child point -
-							// Ensure point range
-							if (comp->argument2 >= num_points) {
-								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2;
-							}
-							// Get child x and y
-							float t_child_x = prev_points[comp->argument2].x;
-							float t_child_y = prev_points[comp->argument2].y;
-							// Calculate it with scales applied so that point is still
-							// aligned with scales
-							float child_x = (xscale  * t_child_x) + (scale10 * t_child_y);
-							float child_y = (scale01 * t_child_x) + (yscale  * t_child_y);
+					// Convert glyph to rglyph
+					muttGlyphHeader header;
+					muttRGlyph rglyph;
+					res = muttA_Rglyph(atlas, pending->glyph_id, &header, &rglyph);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
 
-							// Calculate argument1 & argument2 to be offsets that align
-							// the child point to the parent point
-							argument1 = parent_x - child_x;
-							argument2 = parent_y - child_y;
+					// Rasterize directly onto page
+					if (pending->width != 0) {
+						muttAtlasPage* page = &atlas->pages[glyph->page];
+						uint8_m adv = muttR_ChannelsAdv(atlas->info.channels);
+						muttRBitmap bitmap;
+						bitmap.width = glyph->width;
+						bitmap.height = glyph->height;
+						bitmap.channels = atlas->info.channels;
+						bitmap.stride = atlas->info.page_width * adv;
+						bitmap.pixels = &page->pixels[(glyph->y*bitmap.stride) + (glyph->x*adv)];
+						bitmap.io_color = atlas->info.io_color;
+
+						muttRInfo rinfo = MU_ZERO_STRUCT(muttRInfo);
+						rinfo.scratch = &atlas->scratch;
+						res = mutt_raster_glyph_info(&rglyph, &bitmap, atlas->info.method, &rinfo);
+						if (mutt_result_is_fatal(res)) {
+							return res;
 						}
+						page->dirty = MU_TRUE;
+					}
 
-						// Loop through each point
-						for (uint16_m p = 0; p < num_points; ++p) {
-							// Calculate scaled point
-							float point_x = prev_points[p].x;
-							float point_y = prev_points[p].y;
-							prev_points[p].x = (xscale  * point_x) + (scale10 * point_y);
-							prev_points[p].y = (scale01 * point_x) + (yscale  * point_y);
-							// Add offsets
-							prev_points[p].x += argument1;
-							prev_points[p].y += argument2;
-						}
+					// Texture coordinates
+					glyph->uv[0] = ((float)glyph->x) / ((float)atlas->info.page_width);
+					glyph->uv[1] = ((float)glyph->y) / ((float)atlas->info.page_height);
+					glyph->uv[2] = ((float)(glyph->x+glyph->width)) / ((float)atlas->info.page_width);
+					glyph->uv[3] = ((float)(glyph->y+glyph->height)) / ((float)atlas->info.page_height);
+
+					// Metrics
+					mutt_rglyph_metrics(atlas->font, &header, pending->glyph_id, &rglyph, atlas->info.point_size, atlas->info.ppi);
+					glyph->x_max = rglyph.x_max;
+					glyph->y_max = rglyph.y_max;
+					glyph->ascender = rglyph.ascender;
+					glyph->descender = rglyph.descender;
+					glyph->lsb = rglyph.lsb;
+					glyph->advance_width = rglyph.advance_width;
+					return res;
+				}
 
+				MUDEF muttResult mutt_atlas_add_glyphs(muttAtlas* atlas, uint16_m* glyph_ids, uint32_m count) {
+					muttResult res = MUTT_SUCCESS;
+					if (count == 0) {
 						return res;
 					}
 
-					// Converts all TrueType-calculated coordinates from a composite-converted rglyph
-					// to pixel coordinates
-					// OR, if convert_to_punits is false, it just calculates the x/y min/max within
-					// prog
-					muttResult mutt_composite_rglyph_coords(muttFont* font, muttR_CompProg* prog, muttRGlyph* rglyph, float point_size, float ppi, muBool convert_to_punits) {
-						// Calculate x/y min/max values
-						prog->x_min = prog->x_max = rglyph->points[0].x;
-						prog->y_min = prog->y_max = rglyph->points[0].y;
-						for (uint16_m p = 1; p < rglyph->num_points; ++p) {
-							// x min/max
-							if (rglyph->points[p].x < prog->x_min) {
-								prog->x_min = rglyph->points[p].x;
-							}
-							if (rglyph->points[p].x > prog->x_max) {
-								prog->x_max = rglyph->points[p].x;
-							}
-							// y min/max
-							if (rglyph->points[p].y < prog->y_min) {
-								prog->y_min = rglyph->points[p].y;
-							}
-							if (rglyph->points[p].y > prog->y_max) {
-								prog->y_max = rglyph->points[p].y;
-							}
-						}
+					// Allocate pending glyphs
+					muttA_Pending* pending = (muttA_Pending*)mutt_Malloc(atlas->font->allocator, count*sizeof(muttA_Pending));
+					if (!pending) {
+						return MUTT_FAILED_MALLOC;
+					}
 
-						// Ensure FUnit range
-						if (prog->x_min < -16384.f || prog->x_min > 16383.f ||
-							prog->x_max < -16384.f || prog->x_max > 16383.f) {
-							return MUTT_INVALID_GLYF_COMPOSITE_X_COORD_FUNITS;
+					// Calculate the bitmap size of each new glyph
+					uint32_m num_pending = 0;
+					for (uint32_m i = 0; i < count; ++i) {
+						uint16_m glyph_id = glyph_ids[i];
+						if (glyph_id >= atlas->font->maxp->num_glyphs) {
+							res = MUTT_INVALID_ATLAS_GLYPH_ID;
+							continue;
 						}
-						if (prog->y_min < -16384.f || prog->y_min > 16383.f ||
-							prog->y_max < -16384.f || prog->y_max > 16383.f) {
-							return MUTT_INVALID_GLYF_COMPOSITE_Y_COORD_FUNITS;
+						// Skip glyphs already added
+						if (atlas->lookup[glyph_id] != 0) {
+							continue;
+						}
+						// Skip duplicates within this call
+						// (Marked in lookup temporarily)
+						atlas->lookup[glyph_id] = 0xFFFFFFFF;
+
+						// Convert to rglyph for size
+						muttGlyphHeader header;
+						muttRGlyph rglyph;
+						muttResult gres = muttA_Rglyph(atlas, glyph_id, &header, &rglyph);
+						if (mutt_result_is_fatal(gres)) {
+							atlas->lookup[glyph_id] = 0;
+							res = gres;
+							continue;
 						}
 
-						// Finish here if conversion to pixel-units is not being performed
-						if (!convert_to_punits) {
-							return MUTT_SUCCESS;
+						pending[num_pending].glyph_id = glyph_id;
+						if (header.number_of_contours == 0) {
+							pending[num_pending].width = pending[num_pending].height = 0;
+						} else {
+							pending[num_pending].width = (uint32_m)mu_ceilf(rglyph.x_max) + 1;
+							pending[num_pending].height = (uint32_m)mu_ceilf(rglyph.y_max) + 1;
 						}
+						++num_pending;
+					}
+					// Unmark pending glyphs
+					for (uint32_m i = 0; i < num_pending; ++i) {
+						atlas->lookup[pending[i].glyph_id] = 0;
+					}
 
-						// Much of this code is considerably similar to mutt_simple_rglyph
-
-						// Calculate point offsets based on glyph's min/max values
-						float px = -mutt_funits_to_punits(font, prog->x_min, point_size, ppi) + 1.f;
-						float py = -mutt_funits_to_punits(font, prog->y_min, point_size, ppi) + 1.f;
+					// Make room for new glyphs
+					if (atlas->num_glyphs + num_pending > atlas->glyph_capacity) {
+						uint32_m capacity = atlas->glyph_capacity*2;
+						if (capacity < atlas->num_glyphs + num_pending) {
+							capacity = atlas->num_glyphs + num_pending;
+						}
+						muttAtlasGlyph* glyphs = (muttAtlasGlyph*)mutt_Realloc(atlas->font->allocator, atlas->glyphs, capacity*sizeof(muttAtlasGlyph));
+						if (!glyphs) {
+							mutt_Free(atlas->font->allocator, pending);
+							return MUTT_FAILED_REALLOC;
+						}
+						atlas->glyphs = glyphs;
+						atlas->glyph_capacity = capacity;
+					}
 
-						// Loop through each point
-						for (uint16_m p = 0; p < rglyph->num_points; ++p) {
-							// X and Y
-							rglyph->points[p].x = px + mutt_funits_to_punits(font, rglyph->points[p].x, point_size, ppi);
-							rglyph->points[p].y = py + mutt_funits_to_punits(font, rglyph->points[p].y, point_size, ppi);
+					// Place each glyph, tallest first
+					mu_qsort(pending, num_pending, sizeof(muttA_Pending), muttA_ComparePending);
+					for (uint32_m i = 0; i < num_pending; ++i) {
+						muttAtlasGlyph* glyph = &atlas->glyphs[atlas->num_glyphs];
+						muttResult gres = muttA_Place(atlas, &pending[i], glyph);
+						if (mutt_result_is_fatal(gres) || gres == MUTT_ATLAS_GLYPH_TOO_LARGE) {
+							res = gres;
+							continue;
 						}
+						atlas->lookup[glyph->glyph_id] = ++atlas->num_glyphs;
+					}
 
-						// Calculate x/y max
-						rglyph->x_max = px + mutt_funits_to_punits(font, prog->x_max, point_size, ppi);
-						rglyph->y_max = py + mutt_funits_to_punits(font, prog->y_max, point_size, ppi);
+					mutt_Free(atlas->font->allocator, pending);
+					return res;
+				}
 
+				MUDEF muttResult mutt_atlas_add_codepoints(muttAtlas* atlas, uint32_m first, uint32_m last) {
+					if (last < first) {
 						return MUTT_SUCCESS;
 					}
 
-					// Composite glyph -> raster glyph
-					// NO mem req abilities unfortunately
-					MUDEF muttResult mutt_composite_rglyph(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data) {
-						muttResult res = MUTT_SUCCESS;
+					// Convert codepoints to glyph IDs
+					uint32_m count = last - first + 1;
+					uint16_m* glyph_ids = (uint16_m*)mutt_Malloc(atlas->font->allocator, count*sizeof(uint16_m));
+					if (!glyph_ids) {
+						return MUTT_FAILED_MALLOC;
+					}
+					for (uint32_m i = 0; i < count; ++i) {
+						glyph_ids[i] = mutt_get_glyph(atlas->font, first+i);
+					}
 
-						// Allocate temp simple max memory
-						// This cannot be allocated within font, as it could lead to
-						// very unpredictable multi-threaded behavior
-						muByte* temp_simple_max = (muByte*)mu_malloc(mutt_simple_glyph_max_size(font));
-						if (!temp_simple_max) {
-							return MUTT_FAILED_MALLOC;
-						}
+					// Add glyph IDs
+					muttResult res = mutt_atlas_add_glyphs(atlas, glyph_ids, count);
+					mutt_Free(atlas->font->allocator, glyph_ids);
+					return res;
+				}
 
-						// Set rglyph data
-						rglyph->contour_ends = (uint16_m*)data;
-						rglyph->points = (muttRPoint*)((data + (((uint32_m)font->maxp->max_composite_contours)*2)));
+			/* Lookup */
 
-						// Initialize CompProg
-						muttR_CompProg prog;
-						muttR_CompProg_init(&prog, rglyph, temp_simple_max, font);
+				MUDEF muttAtlasGlyph* mutt_atlas_get(muttAtlas* atlas, uint16_m glyph_id) {
+					if (glyph_id >= atlas->font->maxp->num_glyphs || atlas->lookup[glyph_id] == 0) {
+						return 0;
+					}
+					return &atlas->glyphs[atlas->lookup[glyph_id]-1];
+				}
 
-						// Loop through each component
-						for (uint16_m c = 0; c < glyph->component_count; ++c) {
-							// Process component
-							res = mutt_component_rglyph(font, &prog, &glyph->components[c], 1);
-							if (mutt_result_is_fatal(res)) {
-								mu_free(temp_simple_max);
-								return res;
-							}
-						}
+		/* Bitmap cache API */
+
+			/* Entries */
+
+				// A cached glyph, followed in memory by its pixels
+				typedef struct muttB_Entry muttB_Entry;
+				struct muttB_Entry {
+					// Given to the user
+					muttCachedGlyph glyph;
+					// Hash of the glyph's key
+					uint32_m hash;
+					// Next entry in the same bucket
+					muttB_Entry* next;
+					// Index within the clock
+					uint32_m index;
+					// Memory taken up by the entry
+					uint32_m size;
+					// Amount of users still using the entry
+					uint32_m refs;
+					// Whether or not the entry was retrieved since the clock hand last passed it
+					muBool referenced;
+					// Whether or not the entry is within the cache
+					muBool cached;
+				};
 
-						// Convert collected TrueType coordinates to pixel coordinates
-						res = mutt_composite_rglyph_coords(font, &prog, rglyph, point_size, ppi, MU_TRUE);
-						if (mutt_result_is_fatal(res)) {
-							mu_free(temp_simple_max);
-							return res;
+				struct muttBitmapCache {
+					muttBitmapCacheInfo info;
+					muttAllocator* allocator;
+					muttLock lock;
+					// Hash table of entries
+					uint32_m num_buckets;
+					muttB_Entry** buckets;
+					// Clock of entries, used for eviction
+					uint32_m num_entries;
+					uint32_m entry_capacity;
+					muttB_Entry** entries;
+					uint32_m hand;
+					muttBitmapCacheStats stats;
+				};
+
+				// Mixes a value into a hash (FNV-1a)
+				uint32_m muttB_Hash(uint32_m hash, const void* value, size_m len) {
+					const muByte* b = (const muByte*)value;
+					for (size_m i = 0; i < len; ++i) {
+						hash = (hash ^ b[i]) * 16777619;
+					}
+					return hash;
+				}
+
+				// Hashes a glyph's key
+				uint32_m muttB_KeyHash(muttFont* font, uint16_m glyph_id, float point_size, float ppi, muttRMethod method, uint32_m subpixel) {
+					uint32_m hash = 2166136261;
+					hash = muttB_Hash(hash, &font, sizeof(font));
+					hash = muttB_Hash(hash, &glyph_id, sizeof(glyph_id));
+					hash = muttB_Hash(hash, &point_size, sizeof(point_size));
+					hash = muttB_Hash(hash, &ppi, sizeof(ppi));
+					hash = muttB_Hash(hash, &method, sizeof(method));
+					hash = muttB_Hash(hash, &subpixel, sizeof(subpixel));
+					return hash;
+				}
+
+				// Finds an entry with the given key
+				muttB_Entry* muttB_Find(muttBitmapCache* cache, uint32_m hash, muttFont* font, uint16_m glyph_id, float point_size, float ppi, muttRMethod method, uint32_m subpixel) {
+					muttB_Entry* entry = cache->buckets[hash & (cache->num_buckets-1)];
+					for (; entry; entry = entry->next) {
+						if (entry->hash == hash && entry->glyph.font == font && entry->glyph.glyph_id == glyph_id
+							&& entry->glyph.point_size == point_size && entry->glyph.ppi == ppi
+							&& entry->glyph.method == method && entry->glyph.subpixel == subpixel
+						) {
+							return entry;
 						}
+					}
+					return 0;
+				}
 
-						// Free temp simple max memory
-						mu_free(temp_simple_max);
-						return res; if (header) {}
+				// Removes an entry from the cache, freeing it if it's not in use
+				void muttB_Remove(muttBitmapCache* cache, muttB_Entry* entry) {
+					// Remove from bucket
+					muttB_Entry** link = &cache->buckets[entry->hash & (cache->num_buckets-1)];
+					while (*link != entry) {
+						link = &(*link)->next;
 					}
+					*link = entry->next;
 
-					// X/Y min/max composite calculator
-					MUDEF muttResult mutt_composite_glyph_min_max(muttFont* font, muttGlyphHeader* header) {
-						muttResult res = MUTT_SUCCESS;
+					// Remove from clock (moving last entry in its place)
+					cache->entries[entry->index] = cache->entries[--cache->num_entries];
+					cache->entries[entry->index]->index = entry->index;
+					if (cache->hand >= cache->num_entries) {
+						cache->hand = 0;
+					}
 
-						// Unfortunately, there's no realistic way to do this without
-						// doing the usual allocation as far as I'm aware.
+					cache->stats.memory -= entry->size;
+					--cache->stats.entries;
+					entry->cached = MU_FALSE;
+					if (entry->refs == 0) {
+						mutt_Free(cache->allocator, entry);
+					}
+				}
 
-						// Much of this code is considerably similar to mutt_composite_rglyph
+				// Evicts entries until the given size fits within the budget
+				// Returns MU_FALSE if not enough entries could be evicted
+				muBool muttB_Evict(muttBitmapCache* cache, uint32_m size) {
+					// (Each entry is passed at most twice: once to clear its reference bit, once to evict)
+					uint32_m steps = cache->num_entries*2;
+					while (cache->stats.memory + size > cache->info.budget) {
+						if (cache->num_entries == 0 || steps-- == 0) {
+							return MU_FALSE;
+						}
+						muttB_Entry* entry = cache->entries[cache->hand];
+						if (entry->refs != 0) {
+							cache->hand = (cache->hand+1) % cache->num_entries;
+						} else if (entry->referenced) {
+							entry->referenced = MU_FALSE;
+							cache->hand = (cache->hand+1) % cache->num_entries;
+						} else {
+							// (Removal moves another entry to the hand)
+							muttB_Remove(cache, entry);
+							++cache->stats.evictions;
+						}
+					}
+					return MU_TRUE;
+				}
 
-						// Allocate composite memory
-						muByte* composite_mem = (muByte*)mu_malloc(mutt_composite_rglyph_max(font));
-						if (!composite_mem) {
-							return MUTT_FAILED_MALLOC;
+				// Adds an entry to the cache
+				// Returns MU_FALSE if it couldn't be added
+				muBool muttB_Add(muttBitmapCache* cache, muttB_Entry* entry) {
+					if (entry->size > cache->info.budget || !muttB_Evict(cache, entry->size)) {
+						return MU_FALSE;
+					}
+
+					// Make room in clock
+					if (cache->num_entries == cache->entry_capacity) {
+						uint32_m capacity = (cache->entry_capacity == 0) ?(64) :(cache->entry_capacity*2);
+						muttB_Entry** entries = (muttB_Entry**)mutt_Realloc(cache->allocator, cache->entries, capacity*sizeof(muttB_Entry*));
+						if (!entries) {
+							return MU_FALSE;
 						}
-						// Allocate temp simple max memory
-						muByte* temp_simple_max = (muByte*)mu_malloc(mutt_simple_glyph_max_size(font));
-						if (!temp_simple_max) {
-							mu_free(composite_mem);
-							return MUTT_FAILED_MALLOC;
+						cache->entries = entries;
+						cache->entry_capacity = capacity;
+					}
+
+					// Grow hash table to keep about one entry per bucket
+					if (cache->num_entries >= cache->num_buckets) {
+						uint32_m num_buckets = cache->num_buckets*2;
+						muttB_Entry** buckets = (muttB_Entry**)mutt_Malloc(cache->allocator, num_buckets*sizeof(muttB_Entry*));
+						if (buckets) {
+							mu_memset(buckets, 0, num_buckets*sizeof(muttB_Entry*));
+							for (uint32_m e = 0; e < cache->num_entries; ++e) {
+								muttB_Entry* other = cache->entries[e];
+								other->next = buckets[other->hash & (num_buckets-1)];
+								buckets[other->hash & (num_buckets-1)] = other;
+							}
+							mutt_Free(cache->allocator, cache->buckets);
+							cache->buckets = buckets;
+							cache->num_buckets = num_buckets;
 						}
+					}
 
-						// Set rglyph data
-						muttRGlyph rglyph;
-						rglyph.contour_ends = (uint16_m*)composite_mem;
-						rglyph.points = (muttRPoint*)((composite_mem + (((uint32_m)font->maxp->max_composite_contours)*2)));
+					// Add to hash table and clock
+					entry->next = cache->buckets[entry->hash & (cache->num_buckets-1)];
+					cache->buckets[entry->hash & (cache->num_buckets-1)] = entry;
+					entry->index = cache->num_entries;
+					cache->entries[cache->num_entries++] = entry;
+					entry->cached = MU_TRUE;
 
-						// Initialize CompProg
-						muttR_CompProg prog;
-						muttR_CompProg_init(&prog, &rglyph, temp_simple_max, font);
+					cache->stats.memory += entry->size;
+					++cache->stats.entries;
+					return MU_TRUE;
+				}
 
-						// Loop through each component
-						uint32_m component_count = 0;
-						muBool no_more = MU_FALSE;
-						muByte* bprog = header->data;
-						while (!no_more) {
-							// Verify incremented component count
-							if (++component_count > font->maxp->max_component_elements) {
-								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT;
-							}
+			/* Rasterization */
 
-							// Get individual component
-							muttComponentGlyph this_component;
-							res = mutt_composite_component(font, header, &bprog, &this_component, &no_more);
-							if (mutt_result_is_fatal(res)) {
-								mu_free(temp_simple_max);
-								mu_free(composite_mem);
-								return res;
-							}
+				// Rasterizes a glyph into a new entry
+				muttResult muttB_Raster(muttBitmapCache* cache, muttFont* font, uint16_m glyph_id, float point_size, float ppi, muttRMethod method, uint32_m subpixel, muttB_Entry** pentry) {
+					// Get glyph header
+					muttGlyphHeader header;
+					muttResult res = mutt_glyph_header(font, glyph_id, &header);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+					float x_offset = ((float)subpixel) / ((float)cache->info.subpixels);
 
-							// Process component
-							res = mutt_component_rglyph(font, &prog, &this_component, 1);
-							if (mutt_result_is_fatal(res)) {
-								mu_free(temp_simple_max);
-								mu_free(composite_mem);
-								return res;
-							}
+					// Convert to rglyph
+					muttRGlyph rglyph;
+					muByte* rdata = 0;
+					if (header.number_of_contours == 0) {
+						rglyph.x_max = rglyph.y_max = 0.f;
+					} else {
+						rdata = (muByte*)mutt_Malloc(cache->allocator, mutt_header_rglyph_max(font));
+						if (!rdata) {
+							return MUTT_FAILED_MALLOC;
 						}
-
-						// Calculate x/y min/max
-						res = mutt_composite_rglyph_coords(font, &prog, &rglyph, 0.f, 0.f, MU_FALSE);
+						res = mutt_header_rglyph(font, &header, &rglyph, point_size, ppi, rdata, 0);
 						if (mutt_result_is_fatal(res)) {
-							mu_free(temp_simple_max);
-							mu_free(composite_mem);
+							mutt_Free(cache->allocator, rdata);
 							return res;
 						}
+						// Move points by subpixel offset
+						for (uint16_m p = 0; p < rglyph.num_points; ++p) {
+							rglyph.points[p].x += x_offset;
+						}
+						rglyph.x_max += x_offset;
+					}
 
-						// Set x/y min/max values
-						header->x_min = mu_ceilf(prog.x_min);
-						header->y_min = mu_ceilf(prog.y_min);
-						header->x_max = mu_ceilf(prog.x_max);
-						header->y_max = mu_ceilf(prog.y_max);
+					// Calculate bitmap size
+					muttRBitmap bitmap;
+					if (header.number_of_contours == 0) {
+						bitmap.width = bitmap.height = 0;
+					} else {
+						bitmap.width = (uint32_m)mu_ceilf(rglyph.x_max) + 1;
+						bitmap.height = (uint32_m)mu_ceilf(rglyph.y_max) + 1;
+					}
+					bitmap.channels = cache->info.channels;
+					bitmap.stride = bitmap.width * muttR_ChannelsAdv(bitmap.channels);
+					bitmap.io_color = cache->info.io_color;
 
-						// Free and return
-						mu_free(temp_simple_max);
-						mu_free(composite_mem);
-						return res;
+					// Allocate entry with pixels, filled with out color
+					size_m pixels_size = ((size_m)bitmap.stride) * bitmap.height;
+					muttB_Entry* entry = (muttB_Entry*)mutt_Malloc(cache->allocator, sizeof(muttB_Entry) + pixels_size);
+					if (!entry) {
+						if (rdata) {
+							mutt_Free(cache->allocator, rdata);
+						}
+						return MUTT_FAILED_MALLOC;
 					}
+					bitmap.pixels = (pixels_size) ?((uint8_m*)(entry+1)) :(0);
+					mu_memset(entry+1, (bitmap.io_color == MUTTR_BW) ?(0) :(255), pixels_size);
 
-					// Memory maximum
-					MUDEF uint32_m mutt_composite_rglyph_max(muttFont* font) {
-						return
-							// contour_ends
-							(sizeof(uint16_m) * font->maxp->max_composite_contours)
-							// points
-							+ (sizeof(muttRPoint) * font->maxp->max_composite_points)
-						;
+					// Rasterize
+					if (rdata) {
+						muttRScratch scratch = MU_ZERO_STRUCT(muttRScratch);
+						scratch.allocator = cache->allocator;
+						muttRInfo rinfo = MU_ZERO_STRUCT(muttRInfo);
+						rinfo.scratch = &scratch;
+						muttResult rres = mutt_raster_glyph_info(&rglyph, &bitmap, method, &rinfo);
+						mutt_rscratch_free(&scratch);
+						mutt_Free(cache->allocator, rdata);
+						if (mutt_result_is_fatal(rres)) {
+							mutt_Free(cache->allocator, entry);
+							return rres;
+						}
+						// (Give the raster result if it's not successful; conversion result otherwise)
+						if (rres != MUTT_SUCCESS) {
+							res = rres;
+						}
+					}
+
+					// Fill in glyph
+					mutt_rglyph_metrics(font, &header, glyph_id, &rglyph, point_size, ppi);
+					entry->glyph.font = font;
+					entry->glyph.glyph_id = glyph_id;
+					entry->glyph.point_size = point_size;
+					entry->glyph.ppi = ppi;
+					entry->glyph.method = method;
+					entry->glyph.subpixel = subpixel;
+					entry->glyph.x_offset = x_offset;
+					entry->glyph.bitmap = bitmap;
+					entry->glyph.x_max = rglyph.x_max;
+					entry->glyph.y_max = rglyph.y_max;
+					entry->glyph.ascender = rglyph.ascender;
+					entry->glyph.descender = rglyph.descender;
+					entry->glyph.lsb = rglyph.lsb;
+					entry->glyph.advance_width = rglyph.advance_width;
+					entry->glyph.result = res;
+					entry->size = (uint32_m)(sizeof(muttB_Entry) + pixels_size);
+					entry->refs = 1;
+					entry->referenced = MU_TRUE;
+					entry->cached = MU_FALSE;
+
+					*pentry = entry;
+					return res;
+				}
+
+			/* Creation / Destruction */
+
+				MUDEF muttResult mutt_bitmap_cache_create(muttBitmapCacheInfo* info, muttAllocator* allocator, muttBitmapCache** cache) {
+					// Allocate cache
+					muttBitmapCache* c = (muttBitmapCache*)mutt_Malloc(allocator, sizeof(muttBitmapCache));
+					if (!c) {
+						return MUTT_FAILED_MALLOC;
 					}
+					c->info = *info;
+					if (c->info.subpixels == 0) {
+						c->info.subpixels = 1;
+					}
+					c->allocator = allocator;
 
-				/* Header */
+					// Allocate buckets
+					c->num_buckets = 64;
+					c->buckets = (muttB_Entry**)mutt_Malloc(allocator, c->num_buckets*sizeof(muttB_Entry*));
+					if (!c->buckets) {
+						mutt_Free(allocator, c);
+						return MUTT_FAILED_MALLOC;
+					}
+					mu_memset(c->buckets, 0, c->num_buckets*sizeof(muttB_Entry*));
 
-					// Glyph header -> raster glyph
-					MUDEF muttResult mutt_header_rglyph(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
-						muttResult res = MUTT_SUCCESS;
-						uint32_m write0 = 0, write1 = 0;
+					// Fill in the rest
+					c->num_entries = 0;
+					c->entry_capacity = 0;
+					c->entries = 0;
+					c->hand = 0;
+					c->stats = MU_ZERO_STRUCT(muttBitmapCacheStats);
+					c->stats.budget = info->budget;
+					mutt_LockInit(&c->lock);
 
-						// Just memory calculations:
-						if (!data) {
-							// Simple:
-							if (header->number_of_contours >= 0) {
-								// Glyph data:
-								res = mutt_simple_glyph(font, header, 0, 0, &write0);
-								if (mutt_result_is_fatal(res)) {
-									return res;
-								}
-								// Rglyph data:
-								res = mutt_simple_rglyph(font, header, 0, 0, point_size, ppi, 0, &write1);
-								if (mutt_result_is_fatal(res)) {
-									return res;
-								}
-							}
-							// Composite:
-							else {
-								// Glyph data:
-								res = mutt_composite_glyph(font, header, 0, 0, &write0);
-								if (mutt_result_is_fatal(res)) {
-									return res;
-								}
-								// Rglyph data:
-								write1 = mutt_composite_rglyph_max(font);
-							}
+					*cache = c;
+					return MUTT_SUCCESS;
+				}
 
-							// Write sum of memory needed
-							*written = write0 + write1;
-							return res;
-						}
+				MUDEF void mutt_bitmap_cache_destroy(muttBitmapCache* cache) {
+					muttAllocator* allocator = cache->allocator;
+					for (uint32_m e = 0; e < cache->num_entries; ++e) {
+						mutt_Free(allocator, cache->entries[e]);
+					}
+					if (cache->entries) {
+						mutt_Free(allocator, cache->entries);
+					}
+					mutt_Free(allocator, cache->buckets);
+					mutt_LockFree(&cache->lock);
+					mutt_Free(allocator, cache);
+				}
 
-						// Simple:
-						if (header->number_of_contours >= 0) {
-							// Load simple glyph
-							muttSimpleGlyph glyph;
-							res = mutt_simple_glyph(font, header, &glyph, data, &write0);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
-							data += write0;
+			/* Retrieval */
 
-							// Convert to rglyph
-							res = mutt_simple_rglyph(font, header, &glyph, rglyph, point_size, ppi, data, &write1);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
+				MUDEF muttResult mutt_bitmap_cache_get(muttBitmapCache* cache, muttFont* font, uint16_m glyph_id, float point_size, float ppi, muttRMethod method, float x_offset, muttCachedGlyph** glyph) {
+					MUTT_LAZY_LOAD(font, MUTT_LOAD_MAXP)
+					if (glyph_id >= font->maxp->num_glyphs) {
+						return MUTT_INVALID_BITMAP_CACHE_GLYPH_ID;
+					}
 
-							//data += write1;
-						}
-						// Composite:
-						else {
-							// Load composite glyph
-							muttCompositeGlyph glyph;
-							res = mutt_composite_glyph(font, header, &glyph, data, &write0);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
-							data += write0;
+					// Quantize subpixel offset
+					float frac = x_offset - mu_floorf(x_offset);
+					uint32_m subpixel = (uint32_m)(frac * (float)cache->info.subpixels);
+					if (subpixel >= cache->info.subpixels) {
+						subpixel = cache->info.subpixels-1;
+					}
+					uint32_m hash = muttB_KeyHash(font, glyph_id, point_size, ppi, method, subpixel);
 
-							// Convert to rglyph
-							// MUDEF muttResult mutt_composite_rglyph(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data)
-							res = mutt_composite_rglyph(font, header, &glyph, rglyph, point_size, ppi, data);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
-							write1 = mutt_composite_rglyph_max(font);
-							//data += write1;
-						}
+					// Look for cached glyph
+					mutt_Lock(&cache->lock);
+					muttB_Entry* entry = muttB_Find(cache, hash, font, glyph_id, point_size, ppi, method, subpixel);
+					if (entry) {
+						++entry->refs;
+						entry->referenced = MU_TRUE;
+						++cache->stats.hits;
+						mutt_Unlock(&cache->lock);
+						*glyph = &entry->glyph;
+						return entry->glyph.result;
+					}
+					++cache->stats.misses;
+					mutt_Unlock(&cache->lock);
 
-						// Write written
-						if (written) {
-							*written = write0 + write1;
-						}
+					// Rasterize (without lock)
+					muttB_Entry* new_entry;
+					muttResult res = muttB_Raster(cache, font, glyph_id, point_size, ppi, method, subpixel, &new_entry);
+					if (mutt_result_is_fatal(res)) {
 						return res;
 					}
+					new_entry->hash = hash;
+
+					// Add to cache
+					mutt_Lock(&cache->lock);
+					// - Use the glyph of another thread that rasterized it in the meantime
+					entry = muttB_Find(cache, hash, font, glyph_id, point_size, ppi, method, subpixel);
+					if (entry) {
+						++entry->refs;
+						entry->referenced = MU_TRUE;
+						mutt_Unlock(&cache->lock);
+						mutt_Free(cache->allocator, new_entry);
+						*glyph = &entry->glyph;
+						return entry->glyph.result;
+					}
+					// - (Uncached glyphs are freed upon release)
+					muttB_Add(cache, new_entry);
+					mutt_Unlock(&cache->lock);
+
+					*glyph = &new_entry->glyph;
+					return res;
+				}
 
-					// Glyph header x/y min/max -> raster x/y max
-					MUDEF void mutt_funits_punits_min_max(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi) {
-						rglyph->x_max = (-mutt_funits_to_punits(font, header->x_min, point_size, ppi) + 1.f)
-							+ mutt_funits_to_punits(font, header->x_max, point_size, ppi);
-						rglyph->y_max = (-mutt_funits_to_punits(font, header->y_min, point_size, ppi) + 1.f)
-							+ mutt_funits_to_punits(font, header->y_max, point_size, ppi);
+				MUDEF void mutt_bitmap_cache_release(muttBitmapCache* cache, muttCachedGlyph* glyph) {
+					// (The glyph is the first member of its entry)
+					muttB_Entry* entry = (muttB_Entry*)glyph;
+					mutt_Lock(&cache->lock);
+					if (--entry->refs == 0 && !entry->cached) {
+						mutt_Free(cache->allocator, entry);
 					}
+					mutt_Unlock(&cache->lock);
+				}
 
-					MUDEF uint32_m mutt_header_rglyph_max(muttFont* font) {
-						// Simple:
-						uint32_m sim = mutt_simple_glyph_max_size(font) + mutt_simple_rglyph_max(font);
-						// Composite:
-						uint32_m com = mutt_composite_glyph_max_size(font) + mutt_composite_rglyph_max(font);
-						// Return greater
-						return (sim > com) ?(sim) :(com);
+				MUDEF void mutt_bitmap_cache_remove_font(muttBitmapCache* cache, muttFont* font) {
+					mutt_Lock(&cache->lock);
+					for (uint32_m e = 0; e < cache->num_entries;) {
+						// (Removal moves another entry to e)
+						if (cache->entries[e]->glyph.font == font) {
+							muttB_Remove(cache, cache->entries[e]);
+						} else {
+							++e;
+						}
 					}
+					mutt_Unlock(&cache->lock);
+				}
+
+				MUDEF void mutt_bitmap_cache_stats(muttBitmapCache* cache, muttBitmapCacheStats* stats) {
+					mutt_Lock(&cache->lock);
+					*stats = cache->stats;
+					mutt_Unlock(&cache->lock);
+				}
 
 		/* Result */
 
@@ -20172,6 +26823,8 @@ All mu libraries included in muSDK have name functions to convert some of their
 					default: return MU_TRUE; break;
 					case MUTT_SUCCESS:
 					case MUTT_INVALID_GLYF_SIMPLE_X_COORD: case MUTT_INVALID_GLYF_SIMPLE_Y_COORD:
+					case MUTT_ATLAS_GLYPH_TOO_LARGE:
+					case MUTT_RASTER_SPANS_FULL:
 						return MU_FALSE; break;
 				}
 			}
@@ -20187,6 +26840,9 @@ All mu libraries included in muSDK have name functions to convert some of their
 					case MUTT_FAILED_MALLOC: return "MUTT_FAILED_MALLOC"; break;
 					case MUTT_FAILED_REALLOC: return "MUTT_FAILED_REALLOC"; break;
 					case MUTT_FAILED_FIND_TABLE: return "MUTT_FAILED_FIND_TABLE"; break;
+					case MUTT_FAILED_OPEN_FILE: return "MUTT_FAILED_OPEN_FILE"; break;
+					case MUTT_FAILED_MAP_FILE: return "MUTT_FAILED_MAP_FILE"; break;
+					case MUTT_TABLE_NOT_LOADED: return "MUTT_TABLE_NOT_LOADED"; break;
 					case MUTT_INVALID_DIRECTORY_LENGTH: return "MUTT_INVALID_DIRECTORY_LENGTH"; break;
 					case MUTT_INVALID_DIRECTORY_SFNT_VERSION: return "MUTT_INVALID_DIRECTORY_SFNT_VERSION"; break;
 					case MUTT_INVALID_DIRECTORY_NUM_TABLES: return "MUTT_INVALID_DIRECTORY_NUM_TABLES"; break;
@@ -20195,6 +26851,9 @@ All mu libraries included in muSDK have name functions to convert some of their
 					case MUTT_INVALID_DIRECTORY_RECORD_CHECKSUM: return "MUTT_INVALID_DIRECTORY_RECORD_CHECKSUM"; break;
 					case MUTT_INVALID_DIRECTORY_RECORD_TABLE_TAG: return "MUTT_INVALID_DIRECTORY_RECORD_TABLE_TAG"; break;
 					case MUTT_MISSING_DIRECTORY_RECORD_TABLE_TAGS: return "MUTT_MISSING_DIRECTORY_RECORD_TABLE_TAGS"; break;
+					case MUTT_INVALID_COLLECTION_LENGTH: return "MUTT_INVALID_COLLECTION_LENGTH"; break;
+					case MUTT_INVALID_COLLECTION_VERSION: return "MUTT_INVALID_COLLECTION_VERSION"; break;
+					case MUTT_INVALID_COLLECTION_FACE_INDEX: return "MUTT_INVALID_COLLECTION_FACE_INDEX"; break;
 					case MUTT_INVALID_MAXP_LENGTH: return "MUTT_INVALID_MAXP_LENGTH"; break;
 					case MUTT_INVALID_MAXP_VERSION: return "MUTT_INVALID_MAXP_VERSION"; break;
 					case MUTT_INVALID_MAXP_NUM_GLYPHS: return "MUTT_INVALID_MAXP_NUM_GLYPHS"; break;
@@ -20274,6 +26933,30 @@ All mu libraries included in muSDK have name functions to convert some of their
 					case MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT: return "MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT"; break;
 					case MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1: return "MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1"; break;
 					case MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2: return "MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2"; break;
+					case MUTT_UNSUPPORTED_SPAN_METHOD: return "MUTT_UNSUPPORTED_SPAN_METHOD"; break;
+					case MUTT_RASTER_SPANS_FULL: return "MUTT_RASTER_SPANS_FULL"; break;
+					case MUTT_ATLAS_GLYPH_TOO_LARGE: return "MUTT_ATLAS_GLYPH_TOO_LARGE"; break;
+					case MUTT_INVALID_ATLAS_PAGE_DIMENSIONS: return "MUTT_INVALID_ATLAS_PAGE_DIMENSIONS"; break;
+					case MUTT_INVALID_ATLAS_GLYPH_ID: return "MUTT_INVALID_ATLAS_GLYPH_ID"; break;
+					case MUTT_INVALID_BITMAP_CACHE_GLYPH_ID: return "MUTT_INVALID_BITMAP_CACHE_GLYPH_ID"; break;
+					case MUTT_INVALID_KERN_LENGTH: return "MUTT_INVALID_KERN_LENGTH"; break;
+					case MUTT_INVALID_KERN_VERSION: return "MUTT_INVALID_KERN_VERSION"; break;
+					case MUTT_INVALID_KERN_SUBTABLE_LENGTH: return "MUTT_INVALID_KERN_SUBTABLE_LENGTH"; break;
+					case MUTT_KERN_REQUIRES_MAXP: return "MUTT_KERN_REQUIRES_MAXP"; break;
+					case MUTT_INVALID_GPOS_LENGTH: return "MUTT_INVALID_GPOS_LENGTH"; break;
+					case MUTT_INVALID_GPOS_VERSION: return "MUTT_INVALID_GPOS_VERSION"; break;
+					case MUTT_INVALID_GPOS_FEATURE_LIST: return "MUTT_INVALID_GPOS_FEATURE_LIST"; break;
+					case MUTT_INVALID_GPOS_LOOKUP_LIST: return "MUTT_INVALID_GPOS_LOOKUP_LIST"; break;
+					case MUTT_INVALID_GPOS_LOOKUP: return "MUTT_INVALID_GPOS_LOOKUP"; break;
+					case MUTT_INVALID_GPOS_PAIR_POS: return "MUTT_INVALID_GPOS_PAIR_POS"; break;
+					case MUTT_INVALID_GPOS_COVERAGE: return "MUTT_INVALID_GPOS_COVERAGE"; break;
+					case MUTT_INVALID_GPOS_CLASS_DEF: return "MUTT_INVALID_GPOS_CLASS_DEF"; break;
+					case MUTT_GPOS_REQUIRES_MAXP: return "MUTT_GPOS_REQUIRES_MAXP"; break;
+					case MUTT_INVALID_POST_LENGTH: return "MUTT_INVALID_POST_LENGTH"; break;
+					case MUTT_INVALID_POST_VERSION: return "MUTT_INVALID_POST_VERSION"; break;
+					case MUTT_INVALID_POST_NUM_GLYPHS: return "MUTT_INVALID_POST_NUM_GLYPHS"; break;
+					case MUTT_INVALID_POST_GLYPH_NAME_INDEX: return "MUTT_INVALID_POST_GLYPH_NAME_INDEX"; break;
+					case MUTT_POST_REQUIRES_MAXP: return "MUTT_POST_REQUIRES_MAXP"; break;
 				}
 			}
 